@@ -56,21 +56,42 @@ ifneq ($(filter $(FULL_TESTS),$(TEST)),)
 include tests/test_common/build.mk
 include $(TEST_PATH)/test.mk
 endif
+ifeq ($(strip $(BENCH)),yes)
+include tests/test_common/build.mk
+include tests/bench/bench_common/build.mk
+include $(TEST_PATH)/bench.mk
+endif
 
 include $(BUILDDEFS_PATH)/common_features.mk
 include $(BUILDDEFS_PATH)/generic_features.mk
 include $(PLATFORM_PATH)/common.mk
 include $(TMK_PATH)/protocol.mk
+include $(QUANTUM_PATH)/adaptive_scan/tests/rules.mk
+include $(QUANTUM_PATH)/audio/tests/rules.mk
+include $(QUANTUM_PATH)/autocorrect/tests/rules.mk
+include $(QUANTUM_PATH)/bus_queue/tests/rules.mk
+include $(QUANTUM_PATH)/deadline/tests/rules.mk
 include $(QUANTUM_PATH)/debounce/tests/rules.mk
 include $(QUANTUM_PATH)/encoder/tests/rules.mk
+include $(QUANTUM_PATH)/expander_matrix/tests/rules.mk
+include $(QUANTUM_PATH)/logging/tests/rules.mk
+include $(QUANTUM_PATH)/low_power_scan/tests/rules.mk
 include $(QUANTUM_PATH)/os_detection/tests/rules.mk
+include $(QUANTUM_PATH)/poll_governor/tests/rules.mk
 include $(QUANTUM_PATH)/sequencer/tests/rules.mk
+include $(QUANTUM_PATH)/split_common/tests/rules.mk
+include $(QUANTUM_PATH)/spsc_ring/tests/rules.mk
+include $(QUANTUM_PATH)/task_profiler/tests/rules.mk
 include $(QUANTUM_PATH)/wear_leveling/tests/rules.mk
 include $(QUANTUM_PATH)/logging/print.mk
 include $(PLATFORM_PATH)/test/rules.mk
 ifneq ($(filter $(FULL_TESTS),$(TEST)),)
 include $(BUILDDEFS_PATH)/build_full_test.mk
 endif
+ifeq ($(strip $(BENCH)),yes)
+include $(BUILDDEFS_PATH)/build_full_test.mk
+$(TEST_OUTPUT)_SRC += $(BENCH_COMMON_SRC)
+endif
 
 $(TEST_OUTPUT)_SRC += \
 	tests/test_common/main.cpp \
@@ -26,10 +26,12 @@ QUANTUM_SRC += \
     $(QUANTUM_DIR)/keymap_common.c \
     $(QUANTUM_DIR)/keycode_config.c \
     $(QUANTUM_DIR)/sync_timer.c \
+    $(QUANTUM_DIR)/deadline/deadline.c \
     $(QUANTUM_DIR)/logging/debug.c \
     $(QUANTUM_DIR)/logging/sendchar.c \
     $(QUANTUM_DIR)/process_keycode/process_default_layer.c \
 
+VPATH += $(QUANTUM_DIR)/deadline
 VPATH += $(QUANTUM_DIR)/logging
 # Fall back to lib/printf if there is no platform provided print
 ifeq ("$(wildcard $(PLATFORM_PATH)/$(PLATFORM_KEY)/printf.mk)","")
@@ -73,6 +75,10 @@ ifeq ($(strip $(AUDIO_ENABLE)), yes)
     SRC += $(PLATFORM_PATH)/$(PLATFORM_KEY)/$(DRIVER_DIR)/audio_$(strip $(AUDIO_DRIVER)).c
     SRC += $(QUANTUM_DIR)/audio/voices.c
     SRC += $(QUANTUM_DIR)/audio/luts.c
+    ifeq ($(strip $(AUDIO_SAMPLE_ENABLE)), yes)
+        OPT_DEFS += -DAUDIO_SAMPLE_ENABLE
+        SRC += $(QUANTUM_DIR)/audio/audio_sample.c
+    endif
 endif
 
 ifeq ($(strip $(SEQUENCER_ENABLE)), yes)
@@ -87,8 +93,6 @@ ifeq ($(strip $(MIDI_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/midi/midi_device.c
     SRC += $(QUANTUM_DIR)/midi/qmk_midi.c
     SRC += $(QUANTUM_DIR)/midi/sysex_tools.c
-    SRC += $(QUANTUM_DIR)/midi/bytequeue/bytequeue.c
-    SRC += $(QUANTUM_DIR)/midi/bytequeue/interrupt_setting.c
     SRC += $(QUANTUM_DIR)/process_keycode/process_midi.c
 endif
 
@@ -639,6 +643,17 @@ ifeq ($(strip $(DYNAMIC_KEYMAP_ENABLE)), yes)
     SEND_STRING_ENABLE := yes
 endif
 
+ifeq ($(strip $(TAP_DANCE_ENABLE)), yes)
+    DEFERRED_EXEC_ENABLE := yes
+endif
+
+ifeq ($(strip $(SEND_STRING_ASYNC_ENABLE)), yes)
+    SEND_STRING_ENABLE := yes
+    DEFERRED_EXEC_ENABLE := yes
+    OPT_DEFS += -DSEND_STRING_ASYNC_ENABLE
+    SRC += $(QUANTUM_DIR)/send_string/send_string_async.c
+endif
+
 VALID_CUSTOM_MATRIX_TYPES:= yes lite no
 
 CUSTOM_MATRIX ?= no
@@ -657,6 +672,29 @@ ifneq ($(strip $(CUSTOM_MATRIX)), yes)
     endif
 endif
 
+VALID_EXPANDER_MATRIX_DRIVER_TYPES := mcp23018 pca9555
+
+ifneq ($(strip $(EXPANDER_MATRIX_DRIVER)),)
+    ifeq ($(filter $(EXPANDER_MATRIX_DRIVER),$(VALID_EXPANDER_MATRIX_DRIVER_TYPES)),)
+        $(call CATASTROPHIC_ERROR,Invalid EXPANDER_MATRIX_DRIVER,EXPANDER_MATRIX_DRIVER="$(EXPANDER_MATRIX_DRIVER)" is not a valid expander matrix driver)
+    endif
+    OPT_DEFS += -DEXPANDER_MATRIX_ENABLE
+    OPT_DEFS += -DEXPANDER_MATRIX_$(strip $(shell echo $(EXPANDER_MATRIX_DRIVER) | tr '[:lower:]' '[:upper:]'))
+    COMMON_VPATH += $(QUANTUM_DIR)/expander_matrix $(DRIVER_PATH)/gpio
+    QUANTUM_SRC += $(QUANTUM_DIR)/expander_matrix/expander_matrix.c
+    SRC += $(strip $(EXPANDER_MATRIX_DRIVER)).c
+    I2C_DRIVER_REQUIRED = yes
+endif
+
+ifeq ($(strip $(LOW_POWER_SCAN_ENABLE)), yes)
+    OPT_DEFS += -DLOW_POWER_SCAN_ENABLE
+    COMMON_VPATH += $(QUANTUM_DIR)/low_power_scan
+    QUANTUM_SRC += $(QUANTUM_DIR)/low_power_scan/low_power_scan.c
+    ifeq ($(strip $(PLATFORM)), CHIBIOS)
+        SRC += low_power_scan_wake.c
+    endif
+endif
+
 # Debounce Modules. Set DEBOUNCE_TYPE=custom if including one manually.
 DEBOUNCE_TYPE ?= sym_defer_g
 ifneq ($(strip $(DEBOUNCE_TYPE)), custom)
@@ -682,7 +720,8 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
     # Determine which (if any) transport files are required
     ifneq ($(strip $(SPLIT_TRANSPORT)), custom)
         QUANTUM_SRC += $(QUANTUM_DIR)/split_common/transport.c \
-                       $(QUANTUM_DIR)/split_common/transactions.c
+                       $(QUANTUM_DIR)/split_common/transactions.c \
+                       $(QUANTUM_DIR)/split_common/split_key_events.c
 
         OPT_DEFS += -DSPLIT_COMMON_TRANSACTIONS
 
@@ -934,6 +973,12 @@ ifeq ($(strip $(DIP_SWITCH_ENABLE)), yes)
     endif
 endif
 
+ifeq ($(strip $(LEADER_ENABLE)), yes)
+    ifeq ($(strip $(LEADER_TABLE_ENABLE)), yes)
+        OPT_DEFS += -DLEADER_TABLE_ENABLE
+    endif
+endif
+
 VALID_WS2812_DRIVER_TYPES := bitbang custom i2c pwm spi vendor
 
 WS2812_DRIVER ?= bitbang
@@ -980,6 +1025,21 @@ ifeq ($(strip $(SPI_DRIVER_REQUIRED)), yes)
     QUANTUM_LIB_SRC += spi_master.c
 endif
 
+ifeq ($(strip $(BUS_QUEUE_ENABLE)), yes)
+    OPT_DEFS += -DBUS_QUEUE_ENABLE
+    COMMON_VPATH += $(QUANTUM_DIR)/bus_queue
+    SRC += $(QUANTUM_DIR)/bus_queue/bus_queue.c
+    ifeq ($(strip $(I2C_DRIVER_REQUIRED)), yes)
+        SRC += $(QUANTUM_DIR)/bus_queue/bus_queue_i2c.c
+    endif
+    ifeq ($(strip $(SPI_DRIVER_REQUIRED)), yes)
+        SRC += $(QUANTUM_DIR)/bus_queue/bus_queue_spi.c
+    endif
+    ifeq ($(strip $(PLATFORM)), CHIBIOS)
+        SRC += bus_queue_worker.c
+    endif
+endif
+
 ifeq ($(strip $(UART_DRIVER_REQUIRED)), yes)
     ifeq ($(strip $(PLATFORM)), CHIBIOS)
         ifneq ($(filter $(MCU_SERIES),RP2040),)
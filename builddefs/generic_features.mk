@@ -19,6 +19,7 @@ SEND_STRING_ENABLE ?= yes
 SPACE_CADET_ENABLE ?= yes
 
 GENERIC_FEATURES = \
+    ADAPTIVE_SCAN \
     AUTO_SHIFT \
     AUTOCORRECT \
     BOOTMAGIC \
@@ -36,12 +37,14 @@ GENERIC_FEATURES = \
     HAPTIC \
     KEY_LOCK \
     KEY_OVERRIDE \
+    KEYSTROKE_TRACE \
     LAYER_LOCK \
     LEADER \
     MAGIC \
     MOUSEKEY \
     MUSIC \
     OS_DETECTION \
+    POLL_GOVERNOR \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
     SECURE \
@@ -50,6 +53,7 @@ GENERIC_FEATURES = \
     SPACE_CADET \
     SWAP_HANDS \
     TAP_DANCE \
+    TASK_PROFILER \
     TRI_LAYER \
     VIA \
     VIRTSER \
@@ -56,6 +56,7 @@ OTHER_OPTION_NAMES = \
   AUTOLOG_ENABLE \
   DEBUG_ENABLE \
   ENCODER_MAP_ENABLE \
+  LEADER_TABLE_ENABLE \
   ENCODER_ENABLE_CUSTOM \
   GERMAN_ENABLE \
   HAPTIC_ENABLE \
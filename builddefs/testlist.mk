@@ -1,10 +1,22 @@
 TEST_LIST = $(sort $(patsubst %/test.mk,%, $(shell find $(ROOT_DIR)tests -type f -name test.mk)))
 FULL_TESTS := $(notdir $(TEST_LIST))
 
+include $(QUANTUM_PATH)/adaptive_scan/tests/testlist.mk
+include $(QUANTUM_PATH)/audio/tests/testlist.mk
+include $(QUANTUM_PATH)/autocorrect/tests/testlist.mk
+include $(QUANTUM_PATH)/bus_queue/tests/testlist.mk
+include $(QUANTUM_PATH)/deadline/tests/testlist.mk
 include $(QUANTUM_PATH)/debounce/tests/testlist.mk
 include $(QUANTUM_PATH)/encoder/tests/testlist.mk
+include $(QUANTUM_PATH)/expander_matrix/tests/testlist.mk
+include $(QUANTUM_PATH)/logging/tests/testlist.mk
+include $(QUANTUM_PATH)/low_power_scan/tests/testlist.mk
 include $(QUANTUM_PATH)/os_detection/tests/testlist.mk
+include $(QUANTUM_PATH)/poll_governor/tests/testlist.mk
 include $(QUANTUM_PATH)/sequencer/tests/testlist.mk
+include $(QUANTUM_PATH)/split_common/tests/testlist.mk
+include $(QUANTUM_PATH)/spsc_ring/tests/testlist.mk
+include $(QUANTUM_PATH)/task_profiler/tests/testlist.mk
 include $(QUANTUM_PATH)/wear_leveling/tests/testlist.mk
 include $(PLATFORM_PATH)/test/testlist.mk
 
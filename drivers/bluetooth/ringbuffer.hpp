@@ -1,38 +1,39 @@
 #pragma once
-// A simple ringbuffer holding Size elements of type T
-template <typename T, uint8_t Size>
+// A single-producer/single-consumer ringbuffer holding up to Size - 1 elements of type T,
+// see quantum/spsc_ring.h for the C equivalent
+template <typename T, uint16_t Size>
 class RingBuffer {
+  static_assert(Size > 1 && Size <= 256 && (Size & (Size - 1)) == 0, "RingBuffer size must be a power of two between 2 and 256");
+  static constexpr uint8_t Mask = Size - 1;
+
  protected:
   T buf_[Size];
   uint8_t head_{0}, tail_{0};
  public:
   inline uint8_t nextPosition(uint8_t position) {
-    return (position + 1) % Size;
+    return (position + 1) & Mask;
   }
 
   inline uint8_t prevPosition(uint8_t position) {
-    if (position == 0) {
-      return Size - 1;
-    }
-    return position - 1;
+    return (position - 1) & Mask;
   }
 
   inline bool enqueue(const T &item) {
-    static_assert(Size > 1, "RingBuffer size must be > 1");
-    uint8_t next = nextPosition(head_);
-    if (next == tail_) {
+    uint8_t head = head_;
+    uint8_t next = nextPosition(head);
+    if (next == __atomic_load_n(&tail_, __ATOMIC_ACQUIRE)) {
       // Full
       return false;
     }
 
-    buf_[head_] = item;
-    head_ = next;
+    buf_[head] = item;
+    __atomic_store_n(&head_, next, __ATOMIC_RELEASE);
     return true;
   }
 
   inline bool get(T &dest, bool commit = true) {
     auto tail = tail_;
-    if (tail == head_) {
+    if (tail == __atomic_load_n(&head_, __ATOMIC_ACQUIRE)) {
       // No more data
       return false;
     }
@@ -41,19 +42,15 @@ class RingBuffer {
     tail = nextPosition(tail);
 
     if (commit) {
-      tail_ = tail;
+      __atomic_store_n(&tail_, tail, __ATOMIC_RELEASE);
     }
     return true;
   }
 
-  inline bool empty() const { return head_ == tail_; }
+  inline bool empty() const { return __atomic_load_n(&head_, __ATOMIC_ACQUIRE) == __atomic_load_n(&tail_, __ATOMIC_ACQUIRE); }
 
   inline uint8_t size() const {
-    int diff = head_ - tail_;
-    if (diff >= 0) {
-      return diff;
-    }
-    return Size + diff;
+    return (__atomic_load_n(&head_, __ATOMIC_ACQUIRE) - __atomic_load_n(&tail_, __ATOMIC_ACQUIRE)) & Mask;
   }
 
   inline T& front() {
@@ -10,12 +10,20 @@
 #define TIMEOUT 100
 
 enum {
-    CMD_IODIRA = 0x00, // i/o direction register
-    CMD_IODIRB = 0x01,
-    CMD_GPPUA  = 0x0C, // GPIO pull-up resistor register
-    CMD_GPPUB  = 0x0D,
-    CMD_GPIOA  = 0x12, // general purpose i/o port register (write modifies OLAT)
-    CMD_GPIOB  = 0x13,
+    CMD_IODIRA   = 0x00, // i/o direction register
+    CMD_IODIRB   = 0x01,
+    CMD_GPINTENA = 0x04, // interrupt-on-change control register
+    CMD_GPINTENB = 0x05,
+    CMD_IOCON    = 0x0A, // expander configuration register
+    CMD_GPPUA    = 0x0C, // GPIO pull-up resistor register
+    CMD_GPPUB    = 0x0D,
+    CMD_GPIOA    = 0x12, // general purpose i/o port register (write modifies OLAT)
+    CMD_GPIOB    = 0x13,
+};
+
+enum {
+    IOCON_ODR    = 0x04, // INT pins are open-drain
+    IOCON_MIRROR = 0x40, // INT pins are internally connected
 };
 
 void mcp23018_init(uint8_t addr) {
@@ -106,3 +114,23 @@ bool mcp23018_read_pins_all(uint8_t slave_addr, uint16_t* out) {
     *out = data.u16;
     return true;
 }
+
+bool mcp23018_set_interrupt_all(uint8_t slave_addr, uint8_t maskA, uint8_t maskB) {
+    uint8_t addr    = SLAVE_TO_ADDR(slave_addr);
+    uint8_t iocon   = IOCON_MIRROR | IOCON_ODR;
+    uint8_t mask[2] = {maskA, maskB};
+
+    i2c_status_t ret = i2c_write_register(addr, CMD_IOCON, &iocon, sizeof(iocon), TIMEOUT);
+    if (ret != I2C_STATUS_SUCCESS) {
+        dprintf("mcp23018_set_interrupt::ioconFAILED::%u\n", ret);
+        return false;
+    }
+
+    ret = i2c_write_register(addr, CMD_GPINTENA, &mask[0], sizeof(mask), TIMEOUT);
+    if (ret != I2C_STATUS_SUCCESS) {
+        dprintf("mcp23018_set_interrupt::gpintenFAILED::%u\n", ret);
+        return false;
+    }
+
+    return true;
+}
@@ -64,6 +64,14 @@ bool mcp23018_read_pins(uint8_t slave_addr, mcp23018_port_t port, uint8_t* ret);
  */
 bool mcp23018_read_pins_all(uint8_t slave_addr, uint16_t* ret);
 
+/**
+ * Enable interrupt-on-change for the given pins of both ports
+ *
+ *  - INTA and INTB are mirrored and open-drain, so either can be wired to an MCU pin with a pull-up
+ *  - the interrupt is cleared by reading the pins
+ */
+bool mcp23018_set_interrupt_all(uint8_t slave_addr, uint8_t maskA, uint8_t maskB);
+
 // DEPRECATED - DO NOT USE
 
 #define mcp23018_readPins mcp23018_read_pins
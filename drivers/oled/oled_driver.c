@@ -22,6 +22,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    if defined(USE_I2C) && defined(SPLIT_KEYBOARD)
 #        include "keyboard.h"
 #    endif
+#    if defined(BUS_QUEUE_ENABLE)
+#        include "bus_queue.h"
+#        define OLED_RENDER_ASYNC
+#    endif
 #endif
 #include "oled_driver.h"
 #include OLED_FONT_H
@@ -185,6 +189,36 @@ uint16_t oled_update_timeout;
 #    endif
 #endif
 
+#if defined(OLED_RENDER_ASYNC)
+// Blocks are rendered in the background, as a command transaction followed by a data transaction
+static bus_transaction_t oled_render_cmd_transaction;
+static bus_transaction_t oled_render_data_transaction;
+static uint8_t           oled_render_cmd[7];
+
+// Any other command has to wait for the block in flight, so that it does not end up between its position and data
+static void oled_render_wait(void) {
+    bus_transaction_wait(&oled_render_cmd_transaction);
+    bus_transaction_wait(&oled_render_data_transaction);
+}
+
+static void oled_render_complete(bus_transaction_t *transaction) {
+    if (transaction->status != I2C_STATUS_SUCCESS) {
+        print("oled_render async failed\n");
+        // Try again with the next render
+        oled_dirty |= (OLED_BLOCK_TYPE)1 << (uintptr_t)transaction->context;
+    }
+}
+
+static bool oled_render_async(uint8_t block, const uint8_t *display_start, uint8_t size) {
+    memcpy(oled_render_cmd, display_start, size);
+    void *context = (void *)(uintptr_t)block;
+    if (!i2c_transmit_async(&oled_render_cmd_transaction, (OLED_DISPLAY_ADDRESS << 1), oled_render_cmd, size, OLED_I2C_TIMEOUT, oled_render_complete, context)) {
+        return false;
+    }
+    return i2c_write_register_async(&oled_render_data_transaction, (OLED_DISPLAY_ADDRESS << 1), I2C_DATA, &oled_buffer[OLED_BLOCK_SIZE * block], OLED_BLOCK_SIZE, OLED_I2C_TIMEOUT, oled_render_complete, context);
+}
+#endif
+
 // Transmit/Write Funcs.
 __attribute__((weak)) bool oled_send_cmd(const uint8_t *data, uint16_t size) {
 #if defined(OLED_TRANSPORT_SPI)
@@ -201,6 +235,9 @@ __attribute__((weak)) bool oled_send_cmd(const uint8_t *data, uint16_t size) {
     spi_stop();
     return true;
 #elif defined(OLED_TRANSPORT_I2C)
+#    if defined(OLED_RENDER_ASYNC)
+    oled_render_wait();
+#    endif
     i2c_status_t status = i2c_transmit((OLED_DISPLAY_ADDRESS << 1), data, size, OLED_I2C_TIMEOUT);
 
     return (status == I2C_STATUS_SUCCESS);
@@ -223,6 +260,9 @@ __attribute__((weak)) bool oled_send_cmd_P(const uint8_t *data, uint16_t size) {
     spi_stop();
     return (status >= 0);
 #    elif defined(OLED_TRANSPORT_I2C)
+#        if defined(OLED_RENDER_ASYNC)
+    oled_render_wait();
+#        endif
 
     i2c_status_t status = i2c_transmit_P((OLED_DISPLAY_ADDRESS << 1), data, size, OLED_I2C_TIMEOUT);
 
@@ -248,6 +288,9 @@ __attribute__((weak)) bool oled_send_data(const uint8_t *data, uint16_t size) {
     spi_stop();
     return true;
 #elif defined(OLED_TRANSPORT_I2C)
+#    if defined(OLED_RENDER_ASYNC)
+    oled_render_wait();
+#    endif
     i2c_status_t status = i2c_write_register((OLED_DISPLAY_ADDRESS << 1), I2C_DATA, data, size, OLED_I2C_TIMEOUT);
     return (status == I2C_STATUS_SUCCESS);
 #endif
@@ -453,6 +496,13 @@ void oled_render_dirty(bool all) {
         return;
     }
 
+#if defined(OLED_RENDER_ASYNC)
+    // The previous block is still being sent, carry on with the next render
+    if (!all && !HAS_FLAGS(oled_rotation, OLED_ROTATION_90) && bus_transaction_is_pending(&oled_render_data_transaction)) {
+        return;
+    }
+#endif
+
     // Turn on display if it is off
     oled_on();
 
@@ -476,6 +526,18 @@ void oled_render_dirty(bool all) {
             calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
         }
 
+#if defined(OLED_RENDER_ASYNC)
+        // Queue a single block, so that the main loop does not wait for the transfer
+        if (!all && !HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+            if (!oled_render_async(update_start, display_start, ARRAY_SIZE(display_start))) {
+                print("oled_render async queue full\n");
+                return;
+            }
+            oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+            return;
+        }
+#endif
+
         // Send column & page position
         if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
             print("oled_render offset command failed\n");
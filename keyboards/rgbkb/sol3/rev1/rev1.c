@@ -32,6 +32,11 @@ RGB rgb_matrix_hsv_to_rgb(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+void rgb_matrix_hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    // Halves the value, as above
+    hsv_to_rgb_batch(hsv, rgb, count, limit_lightning ? 127 : 255);
+}
+
 bool dip_switch_update_kb(uint8_t index, bool active) {
     if (!dip_switch_update_user(index, active))
         return false;
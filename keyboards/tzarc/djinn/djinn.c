@@ -87,22 +87,18 @@ void keyboard_post_init_kb(void) {
 // RGB brightness scaling dependent on USBPD state
 
 #if defined(RGB_MATRIX_ENABLE)
-rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
-    float scale;
-
+// Scale of the value, out of 256
+static uint8_t djinn_rgb_brightness(void) {
 #    ifdef DJINN_SUPPORTS_3A_FUSE
     // The updated BOM on the Djinn has properly-spec'ed fuses -- 1500mA/3000mA hold current
     switch (kb_state.current_setting) {
         default:
         case USBPD_500MA:
-            scale = 0.35f;
-            break;
+            return 89; // 35%
         case USBPD_1500MA:
-            scale = 0.75f;
-            break;
+            return 191; // 75%
         case USBPD_3000MA:
-            scale = 1.0f;
-            break;
+            return 255;
     }
 #    else
     // The original BOM on the Djinn had wrongly-spec'ed fuses -- 750mA/1500mA hold current
@@ -110,16 +106,21 @@ rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
         default:
         case USBPD_500MA:
         case USBPD_1500MA:
-            scale = 0.35f;
-            break;
+            return 89; // 35%
         case USBPD_3000MA:
-            scale = 0.75f;
-            break;
+            return 191; // 75%
     }
 #    endif
+}
+
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
+    rgb_t rgb;
+    hsv_to_rgb_batch(&hsv, &rgb, 1, djinn_rgb_brightness());
+    return rgb;
+}
 
-    hsv.v = (uint8_t)(hsv.v * scale);
-    return hsv_to_rgb(hsv);
+void rgb_matrix_hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    hsv_to_rgb_batch(hsv, rgb, count, djinn_rgb_brightness());
 }
 #endif
 
@@ -39,7 +39,7 @@ static painter_font_handle_t  thintel;
 #        undef RGB_MATRIX_EFFECT
 #    endif // defined(RGB_MATRIX_EFFECT)
 
-#    define RGB_MATRIX_EFFECT(x) RGB_MATRIX_EFFECT_##x,
+#    define RGB_MATRIX_EFFECT(x, ...) RGB_MATRIX_EFFECT_##x,
 enum {
     RGB_MATRIX_EFFECT_NONE,
 #    include "rgb_matrix_effects.inc"
@@ -52,8 +52,8 @@ enum {
 #    undef RGB_MATRIX_EFFECT
 };
 
-#    define RGB_MATRIX_EFFECT(x)    \
-        case RGB_MATRIX_EFFECT_##x: \
+#    define RGB_MATRIX_EFFECT(x, ...) \
+        case RGB_MATRIX_EFFECT_##x:  \
             return #x;
 const char *rgb_matrix_name(uint8_t effect) {
     switch (effect) {
@@ -0,0 +1,205 @@
+"""Functions that help us work with audio sample clips, see quantum/audio/audio_sample.h.
+"""
+import datetime
+import re
+import wave
+from string import Template
+
+from qmk.painter import render_bytes
+
+# The list of valid encodings, matching audio_sample_format_t
+valid_formats = {
+    'pcm8': {
+        'sample_format': 'AUDIO_SAMPLE_FORMAT_PCM_U8',
+        'bits_per_sample': 8,
+    },
+    'adpcm': {
+        'sample_format': 'AUDIO_SAMPLE_FORMAT_IMA_ADPCM',
+        'bits_per_sample': 4,
+    },
+}
+
+_adpcm_index_table = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+_adpcm_step_table = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+]
+
+
+def _adpcm_decode_nibble(state, nibble):
+    """Advances the decoder state exactly like adpcm_decode_nibble() in the firmware.
+    """
+    predictor, index = state
+    step = _adpcm_step_table[index]
+
+    diff = step >> 3
+    if nibble & 4:
+        diff += step
+    if nibble & 2:
+        diff += step >> 1
+    if nibble & 1:
+        diff += step >> 2
+
+    if nibble & 8:
+        predictor = max(-32768, predictor - diff)
+    else:
+        predictor = min(32767, predictor + diff)
+
+    index = min(88, max(0, index + _adpcm_index_table[nibble & 7]))
+    return (predictor, index)
+
+
+def adpcm_encode(samples):
+    """Encodes signed 16bit samples as IMA-ADPCM, low nibble first, starting from a zeroed predictor and step index.
+    """
+    out = bytearray((len(samples) + 1) // 2)
+    state = (0, 0)
+    for i, sample in enumerate(samples):
+        diff = sample - state[0]
+        nibble = 0
+        if diff < 0:
+            nibble = 8
+            diff = -diff
+
+        step = _adpcm_step_table[state[1]]
+        if diff >= step:
+            nibble |= 4
+            diff -= step
+        step >>= 1
+        if diff >= step:
+            nibble |= 2
+            diff -= step
+        step >>= 1
+        if diff >= step:
+            nibble |= 1
+
+        # Track the decoder, so quantization errors do not accumulate
+        state = _adpcm_decode_nibble(state, nibble)
+        out[i // 2] |= (nibble << 4) if (i & 1) else nibble
+
+    return bytes(out)
+
+
+def _decode_frames(frames, width):
+    """Converts raw little-endian PCM data to a list of signed 16bit values.
+    """
+    if width == 1:
+        # 8bit WAVs are unsigned, everything else is signed
+        return [(b - 128) << 8 for b in frames]
+    return [int.from_bytes(frames[i:i + width], 'little', signed=True) >> (8 * (width - 2)) for i in range(0, len(frames), width)]
+
+
+def resample(samples, rate, new_rate):
+    """Linearly interpolates samples from `rate` to `new_rate`.
+    """
+    if rate == new_rate or not samples:
+        return list(samples)
+
+    count = max(1, len(samples) * new_rate // rate)
+    out = []
+    for i in range(count):
+        pos = i * rate / new_rate
+        idx = int(pos)
+        frac = pos - idx
+        a = samples[min(idx, len(samples) - 1)]
+        b = samples[min(idx + 1, len(samples) - 1)]
+        out.append(int(round(a + (b - a) * frac)))
+    return out
+
+
+def load_wav(filename, sample_rate=None):
+    """Loads a WAV file as a list of mono, signed 16bit samples, optionally resampled.
+
+    Returns a tuple of (samples, sample_rate).
+    """
+    with wave.open(str(filename), 'rb') as wav:
+        channels = wav.getnchannels()
+        width = wav.getsampwidth()
+        rate = wav.getframerate()
+        frames = wav.readframes(wav.getnframes())
+
+    values = _decode_frames(frames, width)
+
+    # Downmix to mono
+    samples = [sum(values[i:i + channels]) // channels for i in range(0, len(values), channels)]
+
+    if sample_rate is not None and sample_rate != rate:
+        samples = resample(samples, rate, sample_rate)
+        rate = sample_rate
+
+    return samples, rate
+
+
+def encode_samples(samples, format):
+    """Encodes signed 16bit samples in the requested format, see `valid_formats`.
+    """
+    if format == 'adpcm':
+        return adpcm_encode(samples)
+    elif format == 'pcm8':
+        return bytes(((s >> 8) + 128) & 0xFF for s in samples)
+    raise ValueError(f'Unknown format: {format}')
+
+
+license_template = """\
+// Copyright ${year} QMK -- generated source code only, sample retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk audio-convert-wav`
+"""
+
+header_file_template = """\
+${license}
+#pragma once
+
+#include "audio.h"
+
+extern const audio_sample_t sample_${sane_name};
+"""
+
+source_file_template = """\
+${license}
+// Sample rate: ${sample_rate} Hz
+// Samples: ${sample_count} (${duration_ms} ms)
+// Encoding: ${format}
+
+#include "${header_name}"
+
+// clang-format off
+static const uint8_t sample_${sane_name}_data[${byte_count}] = {
+${bytes_lines}
+};
+// clang-format on
+
+const audio_sample_t sample_${sane_name} = {
+    .format       = ${sample_format},
+    .sample_rate  = ${sample_rate},
+    .sample_count = ${sample_count},
+    .data_length  = ${byte_count},
+    .data         = sample_${sane_name}_data,
+};
+"""
+
+
+def generate_subs(name, header_name, format, sample_rate, sample_count, out_bytes):
+    subs = {
+        'year': datetime.date.today().strftime('%Y'),
+        'sane_name': re.sub(r'[^a-zA-Z0-9]', '_', name),
+        'header_name': header_name,
+        'format': format,
+        'sample_format': valid_formats[format]['sample_format'],
+        'sample_rate': sample_rate,
+        'sample_count': sample_count,
+        'duration_ms': sample_count * 1000 // sample_rate,
+        'byte_count': len(out_bytes),
+        'bytes_lines': render_bytes(out_bytes),
+    }
+    subs['license'] = Template(license_template).substitute(subs)
+    return subs
+
+
+def render_header(subs):
+    return Template(header_file_template).substitute(subs)
+
+
+def render_source(subs):
+    return Template(source_file_template).substitute(subs)
@@ -32,12 +32,14 @@ safe_commands = [
 
 subcommands = [
     'qmk.cli.ci.validate_aliases',
+    'qmk.cli.audio',
     'qmk.cli.bux',
     'qmk.cli.c2json',
     'qmk.cli.cd',
     'qmk.cli.chibios.confmigrate',
     'qmk.cli.clean',
     'qmk.cli.compile',
+    'qmk.cli.decode_log',
     'qmk.cli.docs',
     'qmk.cli.doctor',
     'qmk.cli.find',
@@ -0,0 +1,59 @@
+"""Converts WAV files into sample clips for the audio subsystem.
+"""
+from qmk.path import normpath
+from qmk.audio import encode_samples, generate_subs, load_wav, render_header, render_source, valid_formats
+from milc import cli
+
+
+@cli.argument('-i', '--input', required=True, help='Specify input WAV file.')
+@cli.argument('-o', '--output', default='', help='Specify output directory. Defaults to same directory as input.')
+@cli.argument('-f', '--format', default='adpcm', help=f'Output encoding, valid types: {", ".join(valid_formats.keys())}')
+@cli.argument('-r', '--rate', type=int, default=None, help='Resample to the given sample rate, in Hz. Defaults to the rate of the input file.')
+@cli.argument('-w', '--raw', arg_only=True, action='store_true', help='Writes out the encoded data as a raw file (e.g. for external flash) instead of c/h combo.')
+@cli.subcommand('Converts a WAV file to a sample clip QMK audio can play')
+def audio_convert_wav(cli):
+    """Converts a WAV file to an audio_sample_t definition.
+
+    The input is downmixed to mono, optionally resampled, and encoded as either IMA-ADPCM or 8bit PCM. The generated definitions are written to files next to the input -- `INPUT.sample.c` and `INPUT.sample.h`.
+    """
+    cli.args.input = normpath(cli.args.input)
+    if not cli.args.input.exists():
+        cli.log.error('Input WAV file does not exist!')
+        cli.print_usage()
+        return False
+
+    if len(cli.args.output) == 0:
+        cli.args.output = cli.args.input.parent
+    cli.args.output = normpath(cli.args.output)
+
+    if cli.args.format not in valid_formats.keys():
+        cli.log.error('Output format %s is invalid. Allowed values: %s' % (cli.args.format, ', '.join(valid_formats.keys())))
+        cli.print_usage()
+        return False
+
+    samples, rate = load_wav(cli.args.input, cli.args.rate)
+    if rate > 65535:
+        cli.log.error('Sample rate %d Hz is too high, resample with --rate.', rate)
+        return False
+
+    out_bytes = encode_samples(samples, cli.args.format)
+    cli.log.info('Encoded %d samples at %d Hz into %d bytes.', len(samples), rate, len(out_bytes))
+
+    if cli.args.raw:
+        raw_file = cli.args.output / f"{cli.args.input.stem}.sample"
+        with open(raw_file, 'wb') as raw:
+            raw.write(out_bytes)
+        return
+
+    header_name = f"{cli.args.input.stem}.sample.h"
+    subs = generate_subs(cli.args.input.stem, header_name, cli.args.format, rate, len(samples), out_bytes)
+
+    header_file = cli.args.output / header_name
+    with open(header_file, 'w') as header:
+        print(f"Writing {header_file}...")
+        header.write(render_header(subs))
+
+    source_file = cli.args.output / f"{cli.args.input.stem}.sample.c"
+    with open(source_file, 'w') as source:
+        print(f"Writing {source_file}...")
+        source.write(render_source(subs))
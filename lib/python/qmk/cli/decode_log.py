@@ -0,0 +1,33 @@
+"""Decodes the console output of firmware built with DEFERRED_LOG_ENABLE.
+"""
+import os
+import sys
+
+from milc import cli
+
+from qmk.path import normpath
+from qmk.deferred_log import DeferredLogDecoder, read_log_strings
+
+
+@cli.argument('-e', '--elf', arg_only=True, required=True, type=normpath, help='The ELF file of the firmware, e.g. .build/<keyboard>_<keymap>.elf')
+@cli.argument('input', nargs='?', arg_only=True, default='-', help='Raw console output to decode, e.g. /dev/hidraw3. Defaults to stdin.')
+@cli.subcommand('Decodes the console output of firmware built with DEFERRED_LOG_ENABLE.')
+def decode_log(cli):
+    """Prints the log messages of the keyboard, formatting them with the strings of its ELF file.
+    """
+    if not cli.args.elf.exists():
+        cli.log.error('ELF file %s does not exist', cli.args.elf)
+        return False
+
+    strings, int_size = read_log_strings(cli.args.elf)
+    if not strings:
+        cli.log.warning('%s has no deferred log messages, was it built with DEFERRED_LOG_ENABLE?', cli.args.elf)
+
+    decoder = DeferredLogDecoder(strings, int_size)
+    fd = sys.stdin.fileno() if cli.args.input == '-' else os.open(normpath(cli.args.input), os.O_RDONLY)
+    while True:
+        data = os.read(fd, 1024)
+        if not data:
+            break
+        sys.stdout.write(decoder.feed(data))
+        sys.stdout.flush()
@@ -13,7 +13,7 @@
 # limitations under the License.
 """Python program to make autocorrect_data.h.
 This program reads from a prepared dictionary file and generates a C source file
-"autocorrect_data.h" with a serialized trie embedded as an array. Run this
+"autocorrect_data.h" with a double-array trie embedded as arrays. Run this
 program and pass it as the first argument like:
 $ qmk generate-autocorrect-data autocorrect_dict.txt
 Each line of the dict file defines one typo and its correction with the syntax
@@ -28,7 +28,8 @@ For full documentation, see QMK Docs
 """
 
 import textwrap
-from typing import Any, Dict, Iterator, List, Tuple
+from collections import deque
+from typing import Any, Dict, Iterator, List, Optional, Tuple
 
 from milc import cli
 
@@ -39,15 +40,15 @@ from qmk.keymap import keymap_completer, locate_keymap
 from qmk.path import normpath
 from qmk.util import maybe_exit
 
-KC_A = 4
-KC_SPC = 0x2c
-KC_QUOT = 0x34
+# Symbols the double array is indexed by, see autocorrect_symbol() in quantum/autocorrect/autocorrect.c.
+TYPO_SYMBOLS = dict([(chr(c), c - ord('a') + 1) for c in range(ord('a'), ord('z') + 1)] + [  # Characters a-z.
+    ("'", 27),
+    (':', 28),  # "Word break" character.
+])
 
-TYPO_CHARS = dict([
-    ("'", KC_QUOT),
-    (':', KC_SPC),  # "Word break" character.
-] + [(chr(c), c + KC_A - ord('a')) for c in range(ord('a'),
-                                                  ord('z') + 1)])  # Characters a-z.
+# Marks base table entries pointing into the tail, narrowed to 16 bits when the dictionary is small enough.
+TAIL_FLAG = 0x80000000
+TAIL_FLAG_SMALL = 0x8000
 
 
 def parse_file(file_name: str) -> List[Tuple[str, str]]:
@@ -86,7 +87,7 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
             continue
 
         # Check that `typo` is valid.
-        if not (all([c in TYPO_CHARS for c in typo])):
+        if not (all([c in TYPO_SYMBOLS for c in typo])):
             cli.log.error('{fg_red}Error:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" has characters other than a-z, \' and :.', line_number, typo)
             maybe_exit(1)
         for other_typo in typos:
@@ -165,88 +166,91 @@ def check_typo_against_dictionary(typo: str, line_number: int, correct_words) ->
                 cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
 
 
-def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
-    """Serializes trie and correction data in a form readable by the C code.
+def serialize_double_array(trie: Dict[str, Any]) -> Tuple[List[int], List[int], List[int]]:
+    """Serializes the trie as a double array, in a form readable by the C code.
+  Every state with more than one way on gets a base, and its child for symbol
+  `c` lives in cell `base + c`, with `check` holding `c`. Bases are unique, so
+  the symbol alone identifies the parent and each transition is a single
+  lookup. Once the rest of a typo is unambiguous, the remaining symbols and the
+  correction are stored together in the tail instead.
   Args:
-    autocorrections: List of (typo, correction) tuples.
     trie: Dict of dicts.
   Returns:
-    List of ints in the range 0-255.
+    Tuple of the base, check and tail tables.
   """
-    table = []
-
-    # Traverse trie in depth first order.
-    def traverse(trie_node):
-        if 'LEAF' in trie_node:  # Handle a leaf trie node.
-            typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
-
-            entry = {'data': data, 'links': [], 'byte_offset': 0}
-            table.append(entry)
-        elif len(trie_node) == 1:  # Handle trie node with a single child.
-            c, trie_node = next(iter(trie_node.items()))
-            entry = {'chars': c, 'byte_offset': 0}
-
-            # It's common for a trie to have long chains of single-child nodes. We
-            # find the whole chain so that we can serialize it more efficiently.
-            while len(trie_node) == 1 and 'LEAF' not in trie_node:
-                c, trie_node = next(iter(trie_node.items()))
-                entry['chars'] += c
-
-            table.append(entry)
-            entry['links'] = [traverse(trie_node)]
-        else:  # Handle trie node with multiple children.
-            entry = {'chars': ''.join(sorted(trie_node.keys())), 'byte_offset': 0}
-            table.append(entry)
-            entry['links'] = [traverse(trie_node[c]) for c in entry['chars']]
-        return entry
-
-    traverse(trie)
-
-    def serialize(e: Dict[str, Any]) -> List[int]:
-        if not e['links']:  # Handle a leaf table entry.
-            return e['data']
-        elif len(e['links']) == 1:  # Handle a chain table entry.
-            return [TYPO_CHARS[c] for c in e['chars']] + [0]  # + encode_link(e['links'][0]))
-        else:  # Handle a branch table entry.
-            data = []
-            for c, link in zip(e['chars'], e['links']):
-                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link)
-            return data + [0]
-
-    byte_offset = 0
-    for e in table:  # To encode links, first compute byte offset of each entry.
-        e['byte_offset'] = byte_offset
-        byte_offset += len(serialize(e))
-        assert 0 <= byte_offset <= 0xffff
-
-    return [b for e in table for b in serialize(e)]  # Serialize final table.
-
-
-def encode_link(link: Dict[str, Any]) -> List[int]:
-    """Encodes a node link as two bytes."""
-    byte_offset = link['byte_offset']
-    if not (0 <= byte_offset <= 0xffff):
-        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 64KB limit. Try reducing the autocorrection dict to fewer entries.')
-        maybe_exit(1)
-    return [byte_offset & 255, byte_offset >> 8]
+    base = [0]
+    check = [0]
+    occupied = [True]
+    tail = []
+    used_bases = set()
+    first_free = 1
+
+    queue = deque([(0, trie)])
+    while queue:
+        state, trie_node = queue.popleft()
+
+        chain = tail_chain(trie_node)
+        if chain is not None:  # Handle the rest of a single typo.
+            symbols, (typo, correction) = chain
+            base[state] = TAIL_FLAG | len(tail)
+            tail += [TYPO_SYMBOLS[c] for c in symbols] + [0] + serialize_correction(typo, correction)
+            continue
+
+        symbols = sorted(TYPO_SYMBOLS[c] for c in trie_node)
+        while first_free < len(occupied) and occupied[first_free]:
+            first_free += 1
+
+        # Find the first base where all children fit.
+        offset = max(0, first_free - symbols[0])
+        while offset in used_bases or any(offset + c < len(occupied) and occupied[offset + c] for c in symbols):
+            offset += 1
+        used_bases.add(offset)
+        base[state] = offset
+
+        while len(occupied) <= offset + symbols[-1]:
+            occupied.append(False)
+            base.append(0)
+            check.append(0)
+
+        for c, child in sorted(trie_node.items()):
+            cell = offset + TYPO_SYMBOLS[c]
+            occupied[cell] = True
+            check[cell] = TYPO_SYMBOLS[c]
+            queue.append((cell, child))
+
+    return base, check, tail
+
+
+def tail_chain(trie_node: Dict[str, Any]) -> Optional[Tuple[str, Tuple[str, str]]]:
+    """Returns the remaining characters and the entry, if only a single typo goes through `trie_node`."""
+    chars = ''
+    while 'LEAF' not in trie_node:
+        if len(trie_node) != 1:
+            return None
+        c, trie_node = next(iter(trie_node.items()))
+        chars += c
+
+    return chars, trie_node['LEAF']
+
+
+def serialize_correction(typo: str, correction: str) -> List[int]:
+    """Encodes the number of backspaces and the characters to type instead."""
+    word_boundary_ending = typo[-1] == ':'
+    typo = typo.strip(':')
+    i = 0
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    assert 0 <= backspaces <= 63
+    return [backspaces] + list(bytes(correction[i:], 'ascii')) + [0]
 
 
 def typo_len(e: Tuple[str, str]) -> int:
     return len(e[0])
 
 
-def to_hex(b: int) -> str:
-    return f'0x{b:02X}'
+def to_hex(b: int, digits: int = 2) -> str:
+    return f'0x{b:0{digits}X}'
 
 
 @cli.argument('filename', type=normpath, help='The autocorrection database file')
@@ -258,7 +262,7 @@ def to_hex(b: int) -> str:
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    base, check, tail = serialize_double_array(trie)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -266,7 +270,12 @@ def generate_autocorrect_data(cli):
     if current_keyboard and current_keymap:
         cli.args.output = locate_keymap(current_keyboard, current_keymap).parent / 'autocorrect_data.h'
 
-    assert all(0 <= b <= 255 for b in data)
+    assert all(0 <= b <= 255 for b in check + tail)
+
+    # Small dictionaries get away with 16-bit base entries, which keeps them within reach of AVR.
+    large_dictionary = max(len(base), len(tail)) > TAIL_FLAG_SMALL
+    if not large_dictionary:
+        base = [(b & ~TAIL_FLAG) | TAIL_FLAG_SMALL if b & TAIL_FLAG else b for b in base]
 
     min_typo = min(autocorrections, key=typo_len)[0]
     max_typo = max(autocorrections, key=typo_len)[0]
@@ -279,12 +288,25 @@ def generate_autocorrect_data(cli):
         autocorrect_data_h_lines.append(f'//   {typo:<{len(max_typo)}} -> {correction}')
 
     autocorrect_data_h_lines.append('')
+    autocorrect_data_h_lines.append('#define AUTOCORRECT_DATA_VERSION 2')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
-    autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
+    if large_dictionary:
+        autocorrect_data_h_lines.append('#define AUTOCORRECT_LARGE_DICTIONARY')
+    autocorrect_data_h_lines.append(f'#define AUTOCORRECT_NODE_COUNT {len(base)}')
+    autocorrect_data_h_lines.append(f'#define AUTOCORRECT_TAIL_SIZE {len(tail)}')
+    autocorrect_data_h_lines.append('')
+    autocorrect_data_h_lines.append(f'static const {"uint32_t" if large_dictionary else "uint16_t"} autocorrect_base[AUTOCORRECT_NODE_COUNT] PROGMEM = {{')
+    base_digits = 8 if large_dictionary else 4
+    autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(to_hex(b, base_digits) for b in base)), width=100, subsequent_indent='    '))
+    autocorrect_data_h_lines.append('};')
+    autocorrect_data_h_lines.append('')
+    autocorrect_data_h_lines.append('static const uint8_t autocorrect_check[AUTOCORRECT_NODE_COUNT] PROGMEM = {')
+    autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, check))), width=100, subsequent_indent='    '))
+    autocorrect_data_h_lines.append('};')
     autocorrect_data_h_lines.append('')
-    autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
-    autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
+    autocorrect_data_h_lines.append('static const uint8_t autocorrect_tail[AUTOCORRECT_TAIL_SIZE] PROGMEM = {')
+    autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, tail))), width=100, subsequent_indent='    '))
     autocorrect_data_h_lines.append('};')
 
     # Show the results
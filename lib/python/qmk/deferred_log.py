@@ -0,0 +1,162 @@
+"""Decodes the console output of firmware built with DEFERRED_LOG_ENABLE.
+
+The firmware only sends the ID of each message's format string and its raw arguments, see quantum/logging/deferred_log.h. The format strings are read back from the qmk_log_strings section of the firmware's ELF file.
+"""
+import re
+import struct
+from pathlib import Path
+
+FRAME_START = 0x1E
+FRAME_END = 0x00
+
+ELF_MACHINE_AVR = 83
+
+SECTION_NAME = b'qmk_log_strings'
+
+FORMAT_SPECIFIER = re.compile(r'%([-+ 0#]*)(\d*)(?:\.(\d+))?(hh|h|ll|l|z|j|t)?([diuxXocsbp%])')
+
+
+def read_log_strings(elf_file):
+    """Returns the format strings of the ELF file by their ID, and the width of int in bytes.
+    """
+    data = Path(elf_file).read_bytes()
+    if data[:4] != b'\x7fELF':
+        raise ValueError(f'{elf_file} is not an ELF file')
+
+    is_64bit = data[4] == 2
+    endian = '<' if data[5] == 1 else '>'
+    machine = struct.unpack_from(endian + 'H', data, 18)[0]
+
+    if is_64bit:
+        section_offset, = struct.unpack_from(endian + 'Q', data, 0x28)
+        entry_size, count, names_index = struct.unpack_from(endian + 'HHH', data, 0x3A)
+        header_format = endian + 'IIQQQQ'
+    else:
+        section_offset, = struct.unpack_from(endian + 'I', data, 0x20)
+        entry_size, count, names_index = struct.unpack_from(endian + 'HHH', data, 0x2E)
+        header_format = endian + 'IIIIII'
+
+    sections = [struct.unpack_from(header_format, data, section_offset + i * entry_size) for i in range(count)]
+    names_offset = sections[names_index][4]
+
+    strings = {}
+    for name, _, _, _, offset, size in sections:
+        end = data.index(b'\0', names_offset + name)
+        if data[names_offset + name:end] != SECTION_NAME:
+            continue
+
+        # Each string starts right after the end of the previous one
+        position = 0
+        for string in data[offset:offset + size].split(b'\0')[:-1]:
+            # Empty ones are padding between the strings of different files
+            if string:
+                strings[position] = string.decode('utf-8', errors='replace')
+            position += len(string) + 1
+
+    return strings, (2 if machine == ELF_MACHINE_AVR else 4)
+
+
+def _cobs_decode(data):
+    output = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        output += data[i + 1:i + code]
+        i += code
+        if i < len(data):
+            output.append(0)
+    return bytes(output)
+
+
+class _Arguments:
+    def __init__(self, data):
+        self.data = data
+        self.position = 0
+
+    def varint(self):
+        value = 0
+        shift = 0
+        while True:
+            if self.position >= len(self.data):
+                raise IndexError('truncated')
+            byte = self.data[self.position]
+            self.position += 1
+            value |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                return value
+
+    def string(self):
+        length = self.varint()
+        string = self.data[self.position:self.position + length]
+        self.position += length
+        return string.decode('utf-8', errors='replace')
+
+
+class DeferredLogDecoder:
+    """Turns console output back into text, passing through anything that is not a deferred log message.
+    """
+    def __init__(self, strings, int_size=4):
+        self.strings = strings
+        self.int_size = int_size
+        self._frame = None
+
+    def feed(self, data):
+        """Decodes the next chunk of console output, returning the text it completes.
+        """
+        text = bytearray()
+        for byte in data:
+            if self._frame is not None:
+                if byte == FRAME_END:
+                    text += self.decode_frame(bytes(self._frame)).encode('utf-8')
+                    self._frame = None
+                else:
+                    self._frame.append(byte)
+            elif byte == FRAME_START:
+                self._frame = bytearray()
+            elif byte != 0:
+                # Plain text, without the padding of the HID reports
+                text.append(byte)
+
+        return text.decode('utf-8', errors='replace')
+
+    def decode_frame(self, frame):
+        """Formats a single message, given the contents of its frame.
+        """
+        arguments = _Arguments(_cobs_decode(frame))
+        try:
+            string_id = arguments.varint()
+        except IndexError:
+            return ''
+        if string_id not in self.strings:
+            return f'<unknown log message {string_id}>\n'
+
+        try:
+            return FORMAT_SPECIFIER.sub(lambda match: self._format(match, arguments), self.strings[string_id])
+        except IndexError:
+            return f'{self.strings[string_id].rstrip()} <truncated>\n'
+
+    def _format(self, match, arguments):
+        flags, width, precision, length, conversion = match.groups()
+        if conversion == '%':
+            return '%'
+        if conversion == 's':
+            return f'%{flags}{width}s' % arguments.string()
+
+        bits = 32 if length in ('l', 'll', 'z', 'j', 't') or conversion == 'p' else self.int_size * 8
+        value = arguments.varint() & ((1 << bits) - 1)
+        if conversion in 'di' and value & (1 << (bits - 1)):
+            value -= 1 << bits
+
+        if conversion == 'c':
+            return f'%{flags}{width}c' % chr(value)
+        if conversion == 'b':
+            digits = format(value, 'b')
+            if '0' in flags and '-' not in flags:
+                return digits.rjust(int(width or 0), '0')
+            return digits.ljust(int(width or 0)) if '-' in flags else digits.rjust(int(width or 0))
+        if conversion == 'p':
+            return f'0x{value:x}'
+
+        precision = f'.{precision}' if precision is not None else ''
+        return f'%{flags}{width}{precision}{"d" if conversion == "u" else conversion}' % value
@@ -818,6 +818,12 @@ def _matrix_size(info_data):
             info_data['matrix_size']['cols'] = len(info_data['matrix_pins']['cols'])
             info_data['matrix_size']['rows'] = len(info_data['matrix_pins']['rows'])
 
+        # Expander rows follow the ones wired to MCU pins
+        if 'expander' in info_data['matrix_pins']:
+            expander = info_data['matrix_pins']['expander']
+            info_data['matrix_size'].setdefault('cols', len(expander['cols']))
+            info_data['matrix_size']['rows'] = info_data['matrix_size'].get('rows', 0) + len(expander['rows'])
+
         # Assumption of split common
         if 'split' in info_data:
             if info_data['split'].get('enabled', False):
@@ -850,10 +856,14 @@ def _check_matrix(info_data):
         elif 'cols' in info_data['matrix_pins'] and 'rows' in info_data['matrix_pins']:
             col_count = len(info_data['matrix_pins']['cols'])
             row_count = len(info_data['matrix_pins']['rows'])
-        elif 'cols' not in info_data['matrix_pins'] and 'rows' not in info_data['matrix_pins']:
+        elif 'cols' not in info_data['matrix_pins'] and 'rows' not in info_data['matrix_pins'] and 'expander' not in info_data['matrix_pins']:
             # This case caters for custom matrix implementations where normal rows/cols are specified
             return
 
+        if 'expander' in info_data['matrix_pins']:
+            col_count = col_count or len(info_data['matrix_pins']['expander']['cols'])
+            row_count += len(info_data['matrix_pins']['expander']['rows'])
+
         if col_count != actual_col_count and col_count != (actual_col_count / 2):
             # FIXME: once we can we should detect if split is enabled to do the actual_col_count/2 check.
             _log_error(info_data, f'MATRIX_COLS is inconsistent with the size of MATRIX_COL_PINS: {col_count} != {actual_col_count}')
@@ -32,6 +32,7 @@ __INCLUDES__
 
 __KEYMAP_GOES_HERE__
 __ENCODER_MAP_GOES_HERE__
+__LEADER_TRIE_GOES_HERE__
 __MACRO_OUTPUT_GOES_HERE__
 
 #ifdef OTHER_KEYMAP_C
@@ -66,6 +67,31 @@ def _generate_encodermap_table(keymap_json):
     return lines
 
 
+def _generate_leader_trie(keymap_json):
+    """Compiles the leader sequences into a trie, laid out breadth first so that the children of each node are next to each other.
+    """
+    root = {'action': 'KC_NO', 'children': {}}
+    for entry in keymap_json['leader_sequences']:
+        node = root
+        for keycode in entry['sequence']:
+            node = node['children'].setdefault(_strip_any(keycode), {'action': 'KC_NO', 'children': {}})
+        node['action'] = _strip_any(entry['keycode'])
+
+    lines = [
+        '#if defined(LEADER_ENABLE) && defined(LEADER_TABLE_ENABLE)',
+        'const leader_node_t PROGMEM leader_trie[] = {',
+    ]
+    nodes = [('KC_NO', root, [])]
+    for index, (keycode, node, sequence) in enumerate(nodes):
+        children = len(nodes) if node['children'] else 0
+        for child_keycode, child in node['children'].items():
+            nodes.append((child_keycode, child, sequence + [child_keycode]))
+        lines.append(f'    [{index}] = {{{keycode}, {node["action"]}, {children}, {len(node["children"])}}}, // {" ".join(sequence) or "root"}')
+    lines.append('};')
+    lines.append('#endif')
+    return lines
+
+
 def _generate_macros_function(keymap_json):
     macro_txt = [
         'bool process_record_user(uint16_t keycode, keyrecord_t *record) {',
@@ -271,6 +297,9 @@ def generate_c(keymap_json):
 
         macros
             A sequence of strings containing macros to implement for this keyboard.
+
+        leader_sequences
+            A sequence of objects mapping a leader `sequence` of keycodes to the `keycode` to tap.
     """
     new_keymap = DEFAULT_KEYMAP_C
 
@@ -286,6 +315,12 @@ def generate_c(keymap_json):
         encodermap = '\n'.join(encoder_txt)
     new_keymap = new_keymap.replace('__ENCODER_MAP_GOES_HERE__', encodermap)
 
+    leader_trie = ''
+    if 'leader_sequences' in keymap_json and keymap_json['leader_sequences'] is not None:
+        leader_txt = _generate_leader_trie(keymap_json)
+        leader_trie = '\n'.join(leader_txt)
+    new_keymap = new_keymap.replace('__LEADER_TRIE_GOES_HERE__', leader_trie)
+
     macros = ''
     if 'macros' in keymap_json and keymap_json['macros'] is not None:
         macro_txt = _generate_macros_function(keymap_json)
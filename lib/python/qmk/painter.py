@@ -454,3 +454,64 @@ def compress_bytes_qmk_rle(bytearray):
                 temp = []
                 repeat = False
     return output
+
+
+def compress_bytes_qmk_lz(bytearray):
+    """Compresses the supplied bytes as a sequence of literal runs and back-references into the previous 256 bytes of output.
+
+    See docs/quantum_painter_lz.md for the format.
+    """
+    window_size = 256
+    min_match = 3
+    max_match = 130
+    max_literals = 128
+    max_candidates = 64
+
+    data = bytes(bytearray)
+    output = []
+    literals = []
+    candidates = {}
+
+    def flush_literals():
+        if literals:
+            output.append(len(literals) - 1)
+            output.extend(literals)
+            literals.clear()
+
+    def remember(pos):
+        if pos + min_match <= len(data):
+            candidates.setdefault(data[pos:pos + min_match], []).append(pos)
+
+    n = 0
+    while n < len(data):
+        # Find the longest earlier occurrence within the window, most recent first so that ties get the shortest distance
+        best_length = 0
+        best_distance = 0
+        for pos in reversed(candidates.get(data[n:n + min_match], [])[-max_candidates:]):
+            distance = n - pos
+            if distance > window_size:
+                break
+            length = 0
+            # Matches may overlap the bytes being produced, which covers repeated runs
+            while length < max_match and n + length < len(data) and data[pos + length] == data[n + length]:
+                length += 1
+            if length > best_length:
+                best_length = length
+                best_distance = distance
+
+        if best_length >= min_match:
+            flush_literals()
+            output.append(128 + best_length - min_match)
+            output.append(best_distance - 1)
+            for pos in range(n, n + best_length):
+                remember(pos)
+            n += best_length
+        else:
+            literals.append(data[n])
+            if len(literals) == max_literals:
+                flush_literals()
+            remember(n)
+            n += 1
+
+    flush_literals()
+    return output
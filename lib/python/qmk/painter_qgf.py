@@ -260,27 +260,53 @@ def _for_all_frames(x: FunctionType, /, images):
             frame_num += 1
 
 
-def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwargs):
+def _encode_bytes(data, *, use_rle, use_lz):
+    """Picks the smallest of the raw data and its enabled compressed forms.
+
+    Returns the compression scheme (see qp.h, painter_compression_t) and the encoded bytes.
+    """
+    best = (0x00, data)
+    if use_rle:
+        rle_data = qmk.painter.compress_bytes_qmk_rle(data)
+        if len(rle_data) < len(best[1]):
+            best = (0x01, rle_data)
+    if use_lz:
+        lz_data = qmk.painter.compress_bytes_qmk_lz(data)
+        if len(lz_data) < len(best[1]):
+            best = (0x02, lz_data)
+    return best
+
+
+def _visible_difference_bbox(frame, last_frame, format_):
+    """Works out the area that changes between frames once both are converted to the output format.
+
+    Differences which are lost to the conversion (e.g. subtle shading on a grayscale display) do not grow the delta frame.
+    """
+    def visible(im):
+        converted = qmk.painter.convert_requested_format(im, format_).convert("RGB")
+        if format_['image_format'] == 'IMAGE_FORMAT_GRAYSCALE':
+            return converted.point(lambda v: qmk.painter.rescale_byte(v, format_['num_colors'] - 1))
+        if format_['image_format'] == 'IMAGE_FORMAT_RGB565':
+            return converted.point([v >> 3 for v in range(256)] + [v >> 2 for v in range(256)] + [v >> 3 for v in range(256)])
+        return converted
+
+    return ImageChops.difference(visible(frame), visible(last_frame)).getbbox()
+
+
+def _compress_image(frame, last_frame, *, use_rle, use_lz, use_deltas, format_, **_kwargs):
     # Convert the original frame so we can do comparisons
     converted = qmk.painter.convert_requested_format(frame, format_)
     graphic_data = qmk.painter.convert_image_bytes(converted, format_)
 
-    # Convert the raw data to RLE-encoded if requested
-    raw_data = graphic_data[1]
-    if use_rle:
-        rle_data = qmk.painter.compress_bytes_qmk_rle(graphic_data[1])
-    use_raw_this_frame = not use_rle or len(raw_data) <= len(rle_data)
-    image_data = raw_data if use_raw_this_frame else rle_data
+    # Compress the raw data if requested, and if it ends up smaller
+    compression, image_data = _encode_bytes(graphic_data[1], use_rle=use_rle, use_lz=use_lz)
 
     # Work out if a delta frame is smaller than injecting it directly
     use_delta_this_frame = False
     bbox = None
     if use_deltas and last_frame is not None:
-        # If we want to use deltas, then find the difference
-        diff = ImageChops.difference(frame, last_frame)
-
-        # Get the bounding box of those differences
-        bbox = diff.getbbox()
+        # If we want to use deltas, then find the bounding box of the differences
+        bbox = _visible_difference_bbox(frame, last_frame, format_)
 
         # If we have a valid bounding box...
         if bbox:
@@ -292,11 +318,7 @@ def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwarg
             delta_graphic_data = qmk.painter.convert_image_bytes(delta_converted, format_)
 
             # Work out how large the delta frame is going to be with compression etc.
-            delta_raw_data = delta_graphic_data[1]
-            if use_rle:
-                delta_rle_data = qmk.painter.compress_bytes_qmk_rle(delta_graphic_data[1])
-            delta_use_raw_this_frame = not use_rle or len(delta_raw_data) <= len(delta_rle_data)
-            delta_image_data = delta_raw_data if delta_use_raw_this_frame else delta_rle_data
+            delta_compression, delta_image_data = _encode_bytes(delta_graphic_data[1], use_rle=use_rle, use_lz=use_lz)
 
             # If the size of the delta frame (plus delta descriptor) is smaller than the original, use that instead
             # This ensures that if a non-delta is overall smaller in size, we use that in preference due to flash
@@ -304,9 +326,7 @@ def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwarg
             if (len(delta_image_data) + QGFFrameDeltaDescriptorV1.length) < len(image_data):
                 # Copy across all the delta equivalents so that the rest of the processing acts on those
                 graphic_data = delta_graphic_data
-                raw_data = delta_raw_data
-                rle_data = delta_rle_data
-                use_raw_this_frame = delta_use_raw_this_frame
+                compression = delta_compression
                 image_data = delta_image_data
                 use_delta_this_frame = True
 
@@ -319,10 +339,10 @@ def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwarg
 
     return {
         "bbox": bbox,
+        "compression": compression,
         "graphic_data": graphic_data,
         "image_data": image_data,
         "use_delta_this_frame": use_delta_this_frame,
-        "use_raw_this_frame": use_raw_this_frame,
     }
 
 
@@ -332,13 +352,12 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
     # This would cause an issue with `_compress_image(**kwargs)` missing an argument
     format_ = kwargs["format_"]
 
-    # (potentially) Apply RLE and/or delta, and work out output image's information
+    # (potentially) Apply compression and/or delta, and work out output image's information
     outputs = _compress_image(frame, last_frame, **kwargs)
     bbox = outputs["bbox"]
     graphic_data = outputs["graphic_data"]
     image_data = outputs["image_data"]
     use_delta_this_frame = outputs["use_delta_this_frame"]
-    use_raw_this_frame = outputs["use_raw_this_frame"]
 
     # Write out the frame descriptor
     frame_offsets.frame_offsets[idx] = fp.tell()
@@ -347,7 +366,7 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
     frame_descriptor.is_delta = use_delta_this_frame
     frame_descriptor.is_transparent = False
     frame_descriptor.format = format_['image_format_byte']
-    frame_descriptor.compression = 0x00 if use_raw_this_frame else 0x01  # See qp.h, painter_compression_t
+    frame_descriptor.compression = outputs["compression"]  # See qp.h, painter_compression_t
     frame_descriptor.delay = frame.info.get('duration', 1000)  # If we're not an animation, just pretend we're delaying for 1000ms
     frame_descriptor.write(fp)
 
@@ -437,7 +456,9 @@ def _save(im, fp, _filename):
     frame_offsets.write(fp)
 
     # Iterate over each if the input frames, writing it to the output in the process
-    write_frame = functools.partial(_write_frame, format_=encoderinfo["qmk_format"], fp=fp, use_deltas=encoderinfo.get("use_deltas", True), use_rle=encoderinfo.get("use_rle", True), frame_offsets=frame_offsets, metadata=metadata)
+    write_frame = functools.partial(
+        _write_frame, format_=encoderinfo["qmk_format"], fp=fp, use_deltas=encoderinfo.get("use_deltas", True), use_rle=encoderinfo.get("use_rle", True), use_lz=encoderinfo.get("use_lz", True), frame_offsets=frame_offsets, metadata=metadata
+    )
     for_all_frames(write_frame)
 
     # Go back and update the graphics descriptor now that we can determine the final file size
@@ -0,0 +1,78 @@
+import struct
+
+from qmk.deferred_log import DeferredLogDecoder, read_log_strings
+
+STRINGS = b'boot\0\0\0\0matrix scan rate: %lu\n\0row %u code %04X diff %d key %s\n\0%08b %c %5s|%-3u|\0'
+BOOT, SCAN_RATE, KEY, MISC = 0, 8, 31, 71
+
+
+def _varint(value):
+    output = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        output.append(byte | (0x80 if value else 0))
+        if not value:
+            return bytes(output)
+
+
+def _frame(string_id, *arguments):
+    body = _varint(string_id)
+    for argument in arguments:
+        if isinstance(argument, str):
+            body += _varint(len(argument)) + argument.encode()
+        else:
+            body += _varint(argument)
+
+    # COBS, the same as the firmware
+    frame = bytearray([0x1E])
+    for chunk in body.split(b'\0'):
+        frame.append(len(chunk) + 1)
+        frame += chunk
+    frame.append(0)
+    return bytes(frame)
+
+
+def _elf(tmp_path, machine):
+    names = b'\0qmk_log_strings\0.shstrtab\0'
+    sections = [(0, 0, 0, 0, 0, 0), (1, 1, 0, 0, 52, len(STRINGS)), (17, 3, 0, 0, 52 + len(STRINGS), len(names))]
+    header = b'\x7fELF\x01\x01\x01' + bytes(9) + struct.pack('<HHIIIIIHHHHHH', 2, machine, 1, 0, 0, 52 + len(STRINGS) + len(names), 0, 52, 0, 0, 40, len(sections), 2)
+    section_headers = b''.join(struct.pack('<IIIIIIIIII', *section, 0, 0, 1, 0) for section in sections)
+
+    elf_file = tmp_path / 'firmware.elf'
+    elf_file.write_bytes(header + STRINGS + names + section_headers)
+    return elf_file
+
+
+def test_read_log_strings(tmp_path):
+    strings, int_size = read_log_strings(_elf(tmp_path, 40))
+    assert strings[BOOT] == 'boot'
+    assert strings[SCAN_RATE] == 'matrix scan rate: %lu\n'
+    assert strings[KEY] == 'row %u code %04X diff %d key %s\n'
+    assert len(strings) == 4
+    assert int_size == 4
+
+    _, int_size = read_log_strings(_elf(tmp_path, 83))
+    assert int_size == 2
+
+
+def test_decode():
+    decoder = DeferredLogDecoder({BOOT: 'boot\n', SCAN_RATE: 'matrix scan rate: %lu\n', KEY: 'row %u code %04X diff %d key %s\n'}, int_size=2)
+
+    # Text and the padding of the HID reports are passed through, frames can span reports
+    frame = _frame(KEY, 3, 0xAB, 0xFFFE, 'KC_A')
+    assert decoder.feed(b'text\n\0\0' + frame[:4]) == 'text\n'
+    assert decoder.feed(frame[4:] + b'\0\0\0') == 'row 3 code 00AB diff -2 key KC_A\n'
+
+    assert decoder.feed(_frame(SCAN_RATE, 0) + _frame(BOOT)) == 'matrix scan rate: 0\nboot\n'
+
+
+def test_decode_conversions():
+    decoder = DeferredLogDecoder({MISC: '%08b %c %5s|%-3u|%%'})
+    assert decoder.feed(_frame(MISC, 5, ord('x'), 'ab', 7)) == '00000101 x    ab|7  |%'
+
+
+def test_decode_errors():
+    decoder = DeferredLogDecoder({BOOT: 'value %u\n'})
+    assert decoder.feed(_frame(99)) == '<unknown log message 99>\n'
+    assert decoder.feed(_frame(BOOT)) == 'value %u <truncated>\n'
@@ -27,12 +27,33 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
 
 
 
+
 #ifdef OTHER_KEYMAP_C
 #    include OTHER_KEYMAP_C
 #endif // OTHER_KEYMAP_C
 """
 
 
+def test_generate_c_leader_sequences():
+    keymap_json = {
+        'keyboard': 'handwired/pytest/basic',
+        'layout': 'LAYOUT',
+        'layers': [['QK_LEAD']],
+        'leader_sequences': [
+            {'sequence': ['KC_A', 'KC_B'], 'keycode': 'KC_2'},
+            {'sequence': ['KC_A'], 'keycode': 'KC_1'},
+            {'sequence': ['KC_C'], 'keycode': 'ANY(LCTL(KC_C))'},
+        ],
+    }
+    templ = qmk.keymap.generate_c(keymap_json)
+    assert """const leader_node_t PROGMEM leader_trie[] = {
+    [0] = {KC_NO, KC_NO, 1, 2}, // root
+    [1] = {KC_A, KC_1, 3, 1}, // KC_A
+    [2] = {KC_C, LCTL(KC_C), 0, 0}, // KC_C
+    [3] = {KC_B, KC_2, 0, 0}, // KC_A KC_B
+};""" in templ
+
+
 def test_generate_json_pytest_basic():
     templ = qmk.keymap.generate_json('default', 'handwired/pytest/basic', 'LAYOUT', [['KC_A']])
     assert templ == {"keyboard": "handwired/pytest/basic", "keymap": "default", "layout": "LAYOUT", "layers": [["KC_A"]]}
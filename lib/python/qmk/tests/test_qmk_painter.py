@@ -0,0 +1,72 @@
+import random
+
+from qmk.painter import compress_bytes_qmk_lz
+
+
+def _decompress_lz(compressed):
+    """Decodes as described in docs/quantum_painter_lz.md, checking the limits the firmware relies on.
+    """
+    output = bytearray()
+    n = 0
+    while n < len(compressed):
+        marker = compressed[n]
+        if marker < 128:
+            length = marker + 1
+            assert len(compressed) >= n + 1 + length
+            output += bytes(compressed[n + 1:n + 1 + length])
+            n += 1 + length
+        else:
+            length = marker - 125
+            distance = compressed[n + 1] + 1
+            assert 3 <= length <= 130
+            assert 1 <= distance <= min(256, len(output))
+            for _ in range(length):
+                output.append(output[-distance])
+            n += 2
+    return bytes(output)
+
+
+def _round_trip(data):
+    compressed = compress_bytes_qmk_lz(data)
+    assert _decompress_lz(compressed) == bytes(data)
+    return compressed
+
+
+def test_lz_empty():
+    assert _round_trip(b'') == []
+
+
+def test_lz_literals():
+    data = bytes(range(256))
+    compressed = _round_trip(data)
+    # Only literal runs of at most 128 bytes, with one marker each
+    assert len(compressed) == len(data) + 2
+
+
+def test_lz_long_run():
+    data = b'\x42' * 1000
+    compressed = _round_trip(data)
+    # One literal, then back-references overlapping their own output
+    assert len(compressed) < 20
+
+
+def test_lz_repeat_at_window_end():
+    pattern = bytes(random.Random(1).randrange(256) for _ in range(256))
+    compressed = _round_trip(pattern * 4)
+    assert len(compressed) < 300
+
+
+def test_lz_repeat_past_window():
+    pattern = bytes(random.Random(2).randrange(256) for _ in range(257))
+    _round_trip(pattern * 3)
+
+
+def test_lz_random():
+    rng = random.Random(3)
+    for size in [1, 2, 3, 127, 128, 129, 130, 131, 4096]:
+        # Runs of random lengths, similar to artwork
+        data = bytearray()
+        while len(data) < size:
+            data += bytes([rng.randrange(4)]) * rng.randrange(1, 40)
+        _round_trip(data[:size])
+        _round_trip(bytes(rng.randrange(256) for _ in range(size)))
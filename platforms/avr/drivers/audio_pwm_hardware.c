@@ -19,9 +19,9 @@
 #include "gpio.h"
 #include <avr/interrupt.h>
 
-extern bool    playing_note;
-extern bool    playing_melody;
-extern uint8_t note_timbre;
+extern volatile bool playing_note;
+extern bool          playing_melody;
+extern uint8_t       note_timbre;
 
 #define CPU_PRESCALER 8
 
@@ -196,6 +196,13 @@ static void dac_end(DACDriver *dacp) {
         sample_p += AUDIO_DAC_BUFFER_SIZE / 2; // 'half_index'
     }
 
+#ifdef AUDIO_SAMPLE_ENABLE
+    /* decode the next chunk of the active sample clip, if any, to be mixed
+     * with the synthesized tones below */
+    static int16_t pcm_buffer[AUDIO_DAC_BUFFER_SIZE / 2];
+    bool           pcm_active = (OUTPUT_OFF > state) && audio_sample_render(pcm_buffer, AUDIO_DAC_BUFFER_SIZE / 2, AUDIO_DAC_SAMPLE_RATE) > 0;
+#endif
+
     for (uint8_t s = 0; s < AUDIO_DAC_BUFFER_SIZE / 2; s++) {
         if (OUTPUT_OFF <= state) {
             sample_p[s] = AUDIO_DAC_OFF_VALUE;
@@ -204,6 +211,20 @@ static void dac_end(DACDriver *dacp) {
             sample_p[s] = dac_value_generate();
         }
 
+#ifdef AUDIO_SAMPLE_ENABLE
+        if (pcm_active) {
+            // both signals are centered around AUDIO_DAC_OFF_VALUE; with tones playing each gets half the range
+            int32_t pcm   = ((int32_t)pcm_buffer[s] * (AUDIO_DAC_SAMPLE_MAX / 2)) / 32768;
+            int32_t mixed = AUDIO_DAC_OFF_VALUE;
+            if (active_tones_snapshot_length > 0) {
+                mixed += ((int32_t)sample_p[s] - AUDIO_DAC_OFF_VALUE + pcm) / 2;
+            } else {
+                mixed += pcm;
+            }
+            sample_p[s] = (dacsample_t)MAX(0, MIN((int32_t)AUDIO_DAC_SAMPLE_MAX, mixed));
+        }
+#endif
+
         /* zero crossing (or approach, whereas zero == DAC_OFF_VALUE, which can be configured to anything from 0 to DAC_SAMPLE_MAX)
          * ============================*=*========================== AUDIO_DAC_SAMPLE_MAX
          *                          *       *
@@ -221,7 +242,11 @@ static void dac_end(DACDriver *dacp) {
         if (((sample_p[s] + (AUDIO_DAC_SAMPLE_MAX / 100)) > AUDIO_DAC_OFF_VALUE) && // value approaches from below
             (sample_p[s] < (AUDIO_DAC_OFF_VALUE + (AUDIO_DAC_SAMPLE_MAX / 100)))    // or above
         ) {
-            if ((OUTPUT_SHOULD_START == state) && (active_tones_snapshot_length > 0)) {
+            if ((OUTPUT_SHOULD_START == state) && ((active_tones_snapshot_length > 0)
+#ifdef AUDIO_SAMPLE_ENABLE
+                                                   || audio_sample_is_active()
+#endif
+                                                       )) {
                 state = OUTPUT_RUN_NORMALLY;
             } else if (OUTPUT_TONES_CHANGED == state) {
                 state = OUTPUT_REACHED_ZERO_BEFORE_TONE_CHANGE;
@@ -247,7 +272,11 @@ static void dac_end(DACDriver *dacp) {
                 }
             }
 
-            if ((0 == active_tones_snapshot_length) && (OUTPUT_REACHED_ZERO_BEFORE_OFF == state)) {
+            if ((0 == active_tones_snapshot_length) && (OUTPUT_REACHED_ZERO_BEFORE_OFF == state)
+#ifdef AUDIO_SAMPLE_ENABLE
+                && !audio_sample_is_active()
+#endif
+            ) {
                 state = OUTPUT_OFF;
             }
             if (OUTPUT_REACHED_ZERO_BEFORE_TONE_CHANGE == state) {
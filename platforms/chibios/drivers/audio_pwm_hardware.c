@@ -28,9 +28,9 @@
 #    define AUDIO_PWM_OUTPUT_MODE PWM_COMPLEMENTARY_OUTPUT_ACTIVE_HIGH
 #endif
 
-extern bool    playing_note;
-extern bool    playing_melody;
-extern uint8_t note_timbre;
+extern volatile bool playing_note;
+extern bool          playing_melody;
+extern uint8_t       note_timbre;
 
 static PWMConfig pwmCFG = {.frequency = AUDIO_PWM_COUNTER_FREQUENCY, /* PWM clock frequency  */
                            .period    = 2,
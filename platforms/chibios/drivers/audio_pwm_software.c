@@ -30,9 +30,9 @@ this driver uses the chibios-PWM system to produce a square-wave on any given ou
 #if !defined(AUDIO_PIN)
 #    error "Audio feature enabled, but no pin selected - see docs/feature_audio under the ARM PWM settings"
 #endif
-extern bool    playing_note;
-extern bool    playing_melody;
-extern uint8_t note_timbre;
+extern volatile bool playing_note;
+extern bool          playing_melody;
+extern uint8_t       note_timbre;
 
 static void pwm_audio_period_callback(PWMDriver *pwmp);
 static void pwm_audio_channel_interrupt_callback(PWMDriver *pwmp);
@@ -0,0 +1,54 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <ch.h>
+#include <hal.h>
+
+#include "bus_queue.h"
+
+// The worker shares the buses with synchronous transfers made from the main loop
+#if (HAL_USE_I2C == TRUE) && (I2C_USE_MUTUAL_EXCLUSION != TRUE)
+#    error "BUS_QUEUE_ENABLE requires I2C_USE_MUTUAL_EXCLUSION to be TRUE in halconf.h"
+#endif
+#if (HAL_USE_SPI == TRUE) && (SPI_USE_MUTUAL_EXCLUSION != TRUE)
+#    error "BUS_QUEUE_ENABLE requires SPI_USE_MUTUAL_EXCLUSION to be TRUE in halconf.h"
+#endif
+
+#ifndef BUS_QUEUE_THREAD_STACK_SIZE
+// The I2C register writes copy their data onto the stack
+#    define BUS_QUEUE_THREAD_STACK_SIZE 512
+#endif
+
+#ifndef BUS_QUEUE_THREAD_PRIORITY
+// Above the main loop, so that the next transfer starts as soon as the previous one completes
+#    define BUS_QUEUE_THREAD_PRIORITY (NORMALPRIO + 1)
+#endif
+
+static binary_semaphore_t bus_queue_wakeup;
+
+/**
+ * @brief Performs the queued transfers. The HAL drivers suspend this thread
+ * while the peripheral, or its DMA, moves the data, so the main loop runs in
+ * the meantime.
+ */
+static THD_WORKING_AREA(waBusQueueThread, BUS_QUEUE_THREAD_STACK_SIZE);
+static THD_FUNCTION(BusQueueThread, arg) {
+    (void)arg;
+    chRegSetThreadName("bus_queue");
+
+    while (true) {
+        chBSemWait(&bus_queue_wakeup);
+        while (bus_queue_run_next()) {
+        }
+    }
+}
+
+void bus_queue_init_worker(void) {
+    chBSemObjectInit(&bus_queue_wakeup, true);
+    chThdCreateStatic(waBusQueueThread, sizeof(waBusQueueThread), BUS_QUEUE_THREAD_PRIORITY, BusQueueThread, NULL);
+}
+
+bool bus_queue_notify_worker(void) {
+    chBSemSignal(&bus_queue_wakeup);
+    return true;
+}
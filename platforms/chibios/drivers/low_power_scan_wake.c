@@ -0,0 +1,48 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <ch.h>
+#include <hal.h>
+
+#include "low_power_scan.h"
+
+#if PAL_USE_CALLBACKS != TRUE
+#    error "LOW_POWER_SCAN_ENABLE requires PAL_USE_CALLBACKS to be TRUE in halconf.h"
+#endif
+
+static binary_semaphore_t low_power_scan_wakeup;
+static bool               initialized = false;
+
+static void low_power_scan_wake_callback(void *arg) {
+    low_power_scan_wake();
+
+    chSysLockFromISR();
+    chBSemSignalI(&low_power_scan_wakeup);
+    chSysUnlockFromISR();
+}
+
+void low_power_scan_wake_enable(pin_t pin) {
+    if (!initialized) {
+        chBSemObjectInit(&low_power_scan_wakeup, true);
+        initialized = true;
+    }
+    // Drop a wake left over from the previous idle period
+    chBSemReset(&low_power_scan_wakeup, true);
+
+    palEnableLineEvent(pin, PAL_EVENT_MODE_BOTH_EDGES);
+    palSetLineCallback(pin, low_power_scan_wake_callback, NULL);
+}
+
+void low_power_scan_wake_disable(pin_t pin) {
+    palDisableLineEvent(pin);
+}
+
+/**
+ * @brief Suspends the main loop. With nothing else to run, the idle thread
+ * halts the core until the next interrupt, see CORTEX_ENABLE_WFI_IDLE.
+ */
+void low_power_scan_sleep(uint32_t timeout_ms) {
+    if (initialized) {
+        chBSemWaitTimeout(&low_power_scan_wakeup, TIME_MS2I(timeout_ms));
+    }
+}
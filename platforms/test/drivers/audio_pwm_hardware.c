@@ -15,6 +15,13 @@
 
 #include "audio.h"
 
+// Lets the tests tell whether the driver is running
+bool audio_driver_running = false;
+
 void audio_driver_initialize_impl(void) {}
-void audio_driver_start_impl() {}
-void audio_driver_stop_impl() {}
+void audio_driver_start_impl() {
+    audio_driver_running = true;
+}
+void audio_driver_stop_impl() {
+    audio_driver_running = false;
+}
@@ -305,8 +305,14 @@ void send_nkro_report(void) {
 
     static report_nkro_t last_report;
 
-    /* Only send the report if there are changes to propagate to the host. */
-    if (memcmp(nkro_report, &last_report, sizeof(report_nkro_t)) != 0) {
+    /* Only send the report if there are changes to propagate to the host.
+     * The key bits are only compared if any key was added or removed since,
+     * which keeps mods-only and idle calls cheap. */
+    bool changed = nkro_report->mods != last_report.mods;
+    if (nkro_report_take_changes() && !nkro_bits_equal(nkro_report, &last_report)) {
+        changed = true;
+    }
+    if (changed) {
         memcpy(&last_report, nkro_report, sizeof(report_nkro_t));
         host_nkro_send(nkro_report);
     }
@@ -0,0 +1,31 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "adaptive_scan.h"
+#include "keyboard.h"
+#include "deadline.h"
+#include "timer.h"
+
+static uint32_t last_scan = 0;
+static bool     keys_held = false;
+
+__attribute__((weak)) bool adaptive_scan_keep_active_user(void) {
+    return false;
+}
+
+__attribute__((weak)) bool adaptive_scan_keep_active_kb(void) {
+    return adaptive_scan_keep_active_user();
+}
+
+bool adaptive_scan_is_active(void) {
+    return keys_held || deadline_any_armed() || last_input_activity_elapsed() < ADAPTIVE_SCAN_ACTIVE_TIMEOUT || adaptive_scan_keep_active_kb();
+}
+
+bool adaptive_scan_due(void) {
+    return adaptive_scan_is_active() || timer_elapsed32(last_scan) >= ADAPTIVE_SCAN_IDLE_INTERVAL;
+}
+
+void adaptive_scan_update(bool keys_down) {
+    last_scan = timer_read32();
+    keys_held = keys_down;
+}
@@ -0,0 +1,52 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Scans the matrix on every iteration of the main loop while the keyboard is
+    in use, and only every ADAPTIVE_SCAN_IDLE_INTERVAL once it has been left
+    alone. The iterations in between still run every other task, leaving more
+    time for lighting effects and display updates.
+
+    The keyboard counts as in use while a key is held, while a timeout is
+    pending (tap dances, combos, leader sequences... see deadline.h), and for
+    ADAPTIVE_SCAN_ACTIVE_TIMEOUT after the last input. The first key press
+    after that is picked up at most ADAPTIVE_SCAN_IDLE_INTERVAL late.
+*/
+
+// How long the matrix keeps being scanned at the full rate after the last input
+#ifndef ADAPTIVE_SCAN_ACTIVE_TIMEOUT
+#    define ADAPTIVE_SCAN_ACTIVE_TIMEOUT 1000
+#endif
+
+// Time between two scans while idle, which bounds the latency it adds
+#ifndef ADAPTIVE_SCAN_IDLE_INTERVAL
+#    define ADAPTIVE_SCAN_IDLE_INTERVAL 5
+#endif
+
+/**
+ * @brief Checks whether the matrix should be scanned now.
+ */
+bool adaptive_scan_due(void);
+
+/**
+ * @brief Records a matrix scan.
+ *
+ * @param keys_down whether the scan found any key pressed
+ */
+void adaptive_scan_update(bool keys_down);
+
+/**
+ * @brief Whether the matrix is currently scanned at the full rate.
+ */
+bool adaptive_scan_is_active(void);
+
+/**
+ * @brief Keeps the matrix scanned at the full rate while returning true.
+ */
+bool adaptive_scan_keep_active_kb(void);
+bool adaptive_scan_keep_active_user(void);
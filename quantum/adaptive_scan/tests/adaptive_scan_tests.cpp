@@ -0,0 +1,115 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "adaptive_scan.h"
+#include "deadline.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+namespace {
+
+uint32_t last_input  = 0;
+bool     keep_active = false;
+
+} // namespace
+
+extern "C" {
+uint32_t last_input_activity_elapsed(void) {
+    return timer_elapsed32(last_input);
+}
+
+bool adaptive_scan_keep_active_user(void) {
+    return keep_active;
+}
+}
+
+class AdaptiveScan : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        last_input  = 0;
+        keep_active = false;
+        for (uint8_t id = 0; id < DEADLINE_COUNT; id++) {
+            deadline_clear((deadline_id_t)id);
+        }
+        adaptive_scan_update(false);
+    }
+
+    // Runs the main loop for the given time, one iteration per millisecond, returning the number of scans
+    unsigned run(uint32_t ms, bool keys_down = false) {
+        unsigned scans = 0;
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            if (adaptive_scan_due()) {
+                adaptive_scan_update(keys_down);
+                scans++;
+            }
+        }
+        return scans;
+    }
+
+    void go_idle() {
+        run(ADAPTIVE_SCAN_ACTIVE_TIMEOUT);
+        ASSERT_FALSE(adaptive_scan_is_active());
+    }
+};
+
+TEST_F(AdaptiveScan, FullRateAfterInput) {
+    EXPECT_TRUE(adaptive_scan_is_active());
+    EXPECT_EQ(run(ADAPTIVE_SCAN_ACTIVE_TIMEOUT - 1), ADAPTIVE_SCAN_ACTIVE_TIMEOUT - 1);
+    EXPECT_TRUE(adaptive_scan_is_active());
+}
+
+TEST_F(AdaptiveScan, ReducedRateWhenIdle) {
+    go_idle();
+    EXPECT_EQ(run(ADAPTIVE_SCAN_IDLE_INTERVAL * 10), 10u);
+}
+
+TEST_F(AdaptiveScan, IdleLatencyIsBounded) {
+    go_idle();
+    run(1);
+    // The longest a key press can wait for the next scan
+    uint32_t waited = 0;
+    do {
+        advance_time(1);
+        waited++;
+    } while (!adaptive_scan_due());
+    EXPECT_LE(waited, (uint32_t)ADAPTIVE_SCAN_IDLE_INTERVAL);
+}
+
+TEST_F(AdaptiveScan, HeldKeyKeepsFullRate) {
+    EXPECT_EQ(run(ADAPTIVE_SCAN_ACTIVE_TIMEOUT * 2, true), ADAPTIVE_SCAN_ACTIVE_TIMEOUT * 2);
+
+    // The release is scanned at the full rate too, then the keyboard goes idle
+    adaptive_scan_update(false);
+    EXPECT_FALSE(adaptive_scan_is_active());
+}
+
+TEST_F(AdaptiveScan, PendingTimeoutKeepsFullRate) {
+    go_idle();
+    deadline_set(DEADLINE_COMBO, 50);
+    EXPECT_EQ(run(100), 100u);
+
+    deadline_clear(DEADLINE_COMBO);
+    EXPECT_FALSE(adaptive_scan_is_active());
+}
+
+TEST_F(AdaptiveScan, InputWakesFullRate) {
+    go_idle();
+    // An encoder turned or a pointing device moved
+    last_input = timer_read32();
+    EXPECT_TRUE(adaptive_scan_is_active());
+    EXPECT_EQ(run(10), 10u);
+}
+
+TEST_F(AdaptiveScan, KeepActiveCallback) {
+    go_idle();
+    keep_active = true;
+    EXPECT_EQ(run(10), 10u);
+}
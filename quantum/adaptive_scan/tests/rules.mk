@@ -0,0 +1,10 @@
+adaptive_scan_SRC := \
+    $(QUANTUM_PATH)/adaptive_scan/tests/adaptive_scan_tests.cpp \
+    $(QUANTUM_PATH)/adaptive_scan/adaptive_scan.c \
+    $(QUANTUM_PATH)/deadline/deadline.c \
+    $(PLATFORM_PATH)/timer.c \
+    $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+adaptive_scan_INC := \
+    $(QUANTUM_PATH)/adaptive_scan \
+    $(QUANTUM_PATH)/deadline
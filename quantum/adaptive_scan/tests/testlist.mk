@@ -0,0 +1 @@
+TEST_LIST += adaptive_scan
@@ -77,9 +77,9 @@
 uint8_t        active_tones = 0;            // number of tones pushed onto the stack by audio_play_tone - might be more than the hardware is able to reproduce at any single time
 musical_tone_t tones[AUDIO_TONE_STACKSIZE]; // stack of currently active tones
 
-bool playing_melody = false; // playing a SONG?
-bool playing_note   = false; // or (possibly multiple simultaneous) tones
-bool state_changed  = false; // global flag, which is set if anything changes with the active_tones
+bool          playing_melody = false; // playing a SONG?
+volatile bool playing_note   = false; // or (possibly multiple simultaneous) tones
+bool          state_changed  = false; // global flag, which is set if anything changes with the active_tones
 
 // melody/SONG related state variables
 float (*notes_pointer)[][2];                           // SONG, an array of MUSICAL_NOTEs
@@ -118,9 +118,11 @@ float startup_song[][2]   = STARTUP_SONG;
 float audio_on_song[][2]  = AUDIO_ON_SONG;
 float audio_off_song[][2] = AUDIO_OFF_SONG;
 
-static bool    audio_initialized    = false;
-static bool    audio_driver_stopped = true;
-audio_config_t audio_config;
+static bool          audio_initialized    = false;
+static volatile bool audio_driver_stopped = true;
+// set by audio_update_state and audio_stop_tone, which may run in the driver's interrupt, and handled by audio_task
+static volatile bool audio_driver_stop_pending = false;
+audio_config_t       audio_config;
 
 #ifndef AUDIO_POWER_CONTROL_PIN_ON_STATE
 #    define AUDIO_POWER_CONTROL_PIN_ON_STATE 1
@@ -225,6 +227,10 @@ bool audio_is_on(void) {
 }
 
 void audio_stop_all(void) {
+#ifdef AUDIO_SAMPLE_ENABLE
+    audio_sample_stop();
+#endif
+
     if (audio_driver_stopped) {
         return;
     }
@@ -277,10 +283,13 @@ void audio_stop_tone(float pitch) {
             tone_multiplexing_index_shift = 0;
         }
 #endif
-        if (active_tones == 0) {
-            audio_driver_stop();
-            audio_driver_stopped = true;
-            playing_note         = false;
+        if (active_tones == 0
+#ifdef AUDIO_SAMPLE_ENABLE
+            && !audio_sample_is_active()
+#endif
+        ) {
+            playing_note              = false;
+            audio_driver_stop_pending = true;
         }
     }
 }
@@ -393,6 +402,36 @@ void  audio_play_click(uint16_t delay, float pitch, uint16_t duration) {
     }
 }
 
+#ifdef AUDIO_SAMPLE_ENABLE
+void audio_play_sample(const audio_sample_t *sample) {
+    if (!audio_config.enable) {
+        return;
+    }
+
+    if (!audio_initialized) {
+        audio_init();
+    }
+
+    audio_sample_start(sample);
+    if (!audio_sample_is_active()) {
+        return;
+    }
+
+    if (audio_driver_stopped) {
+        audio_driver_start();
+        audio_driver_stopped = false;
+    }
+}
+
+void audio_stop_sample(void) {
+    audio_sample_stop();
+}
+
+bool audio_is_playing_sample(void) {
+    return audio_sample_is_active();
+}
+#endif
+
 bool audio_is_playing_note(void) {
     return playing_note;
 }
@@ -433,8 +472,35 @@ float audio_get_processed_frequency(uint8_t tone_index) {
     return voice_envelope(tones[index].pitch);
 }
 
+void audio_task(void) {
+#ifdef AUDIO_SAMPLE_ENABLE
+    audio_sample_task();
+#endif
+
+    if (!audio_driver_stop_pending) {
+        return;
+    }
+    audio_driver_stop_pending = false;
+
+    // checked again, as a tone or sample may have been started since
+    if (active_tones == 0 && !playing_melody && !audio_driver_stopped
+#ifdef AUDIO_SAMPLE_ENABLE
+        && !audio_sample_is_active()
+#endif
+    ) {
+        audio_driver_stop();
+        audio_driver_stopped = true;
+    }
+}
+
 bool audio_update_state(void) {
     if (!playing_note && !playing_melody) {
+#ifdef AUDIO_SAMPLE_ENABLE
+        // a sample-only playback has ended: nothing keeps the driver busy anymore
+        if (!audio_sample_is_active()) {
+            audio_driver_stop_pending = true;
+        }
+#endif
         return false;
     }
 
@@ -21,6 +21,9 @@
 #include "musical_notes.h"
 #include "song_list.h"
 #include "voices.h"
+#ifdef AUDIO_SAMPLE_ENABLE
+#    include "audio_sample.h"
+#endif
 
 #if defined(AUDIO_DRIVER_PWM)
 #    include "audio_pwm.h"
@@ -69,6 +72,14 @@ void eeconfig_update_audio_current(void);
 void audio_init(void);
 void audio_startup(void);
 
+/**
+ * @brief called from the main loop, stops the hardware once nothing is playing anymore
+ *
+ * @details the end of playback is noticed by audio_update_state, which may run
+ *          in the driver's interrupt, so the driver is only stopped from here
+ */
+void audio_task(void);
+
 /**
  * @brief en-/disable audio output, save this choice to the eeprom
  */
@@ -170,6 +181,30 @@ bool audio_is_playing_note(void);
  */
 bool audio_is_playing_melody(void);
 
+#ifdef AUDIO_SAMPLE_ENABLE
+/**
+ * @brief play a PCM/ADPCM sample clip
+ *
+ * @details streams the clip through the audio driver, mixed with any tones
+ *          or melody that play at the same time; a clip already playing is
+ *          replaced. the driver is kept running until both the clip and all
+ *          tones have finished.
+ *
+ * @param[in] sample the clip to play, has to stay valid during playback
+ */
+void audio_play_sample(const audio_sample_t *sample);
+
+/**
+ * @brief stop playback of the current sample clip
+ */
+void audio_stop_sample(void);
+
+/**
+ * @brief query if a sample clip is playing
+ */
+bool audio_is_playing_sample(void);
+#endif
+
 // These macros are used to allow audio_play_melody to play an array of indeterminate
 // length. This works around the limitation of C's sizeof operation on pointers.
 // The global float array for the song must be used here.
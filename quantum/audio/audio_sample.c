@@ -0,0 +1,236 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "audio_sample.h"
+
+#ifndef AUDIO_SAMPLE_PREFETCH_SIZE
+#    define AUDIO_SAMPLE_PREFETCH_SIZE 256
+#endif
+
+#if (AUDIO_SAMPLE_PREFETCH_SIZE & (AUDIO_SAMPLE_PREFETCH_SIZE - 1)) != 0 || AUDIO_SAMPLE_PREFETCH_SIZE > 32768
+#    error "AUDIO_SAMPLE_PREFETCH_SIZE must be a power of two, no larger than 32768"
+#endif
+
+static const int8_t adpcm_index_table[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+static const uint16_t adpcm_step_table[89] = {
+    7,    8,    9,    10,   11,   12,   13,   14,   16,    17,    19,    21,    23,    25,    28,    31,    34,    37,    41,    45,    50,   55,   60,   66,   73,   80,   88,   97,   107,  118,
+    130,  143,  157,  173,  190,  209,  230,  253,  279,   307,   337,   371,   408,   449,   494,   544,   598,   658,   724,   796,   876,  963,  1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871,  5358,  5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+int16_t adpcm_decode_nibble(adpcm_state_t *state, uint8_t nibble) {
+    uint16_t step = adpcm_step_table[state->step_index];
+
+    int32_t diff = step >> 3;
+    if (nibble & 4) diff += step;
+    if (nibble & 2) diff += step >> 1;
+    if (nibble & 1) diff += step >> 2;
+
+    int32_t predictor = state->predictor;
+    if (nibble & 8) {
+        predictor -= diff;
+        if (predictor < INT16_MIN) predictor = INT16_MIN;
+    } else {
+        predictor += diff;
+        if (predictor > INT16_MAX) predictor = INT16_MAX;
+    }
+    state->predictor = predictor;
+
+    int8_t index = state->step_index + adpcm_index_table[nibble & 7];
+    if (index < 0) index = 0;
+    if (index > 88) index = 88;
+    state->step_index = index;
+
+    return state->predictor;
+}
+
+void adpcm_decode_block(adpcm_state_t *state, const uint8_t *in, int16_t *out, size_t count) {
+    for (size_t i = 0; i < count / 2; i++) {
+        *out++ = adpcm_decode_nibble(state, in[i] & 0x0F);
+        *out++ = adpcm_decode_nibble(state, in[i] >> 4);
+    }
+    if (count & 1) {
+        *out = adpcm_decode_nibble(state, in[count / 2] & 0x0F);
+    }
+}
+
+// Playback state; owned by the driver callback once 'active' is set
+static const audio_sample_t *current      = NULL;
+static volatile bool          active       = false;
+static adpcm_state_t          adpcm        = {0};
+static uint32_t               decoded      = 0; // number of samples decoded so far
+static uint32_t               byte_index   = 0; // number of encoded bytes consumed so far
+static uint8_t                pending_byte = 0; // holds the high nibble of the last ADPCM byte
+static int32_t                position     = 0; // index of the sample held in 'previous'
+static uint32_t               phase        = 0; // 16.16 fixed point position between 'previous' and 'latest'
+static int16_t                previous     = 0;
+static int16_t                latest       = 0;
+
+// Prefetch ring for clips pulled through a read callback: filled by
+// audio_sample_task (main loop), drained by audio_sample_render (interrupt)
+static uint8_t           prefetch[AUDIO_SAMPLE_PREFETCH_SIZE];
+static volatile uint16_t prefetch_head   = 0; // written by the producer only
+static volatile uint16_t prefetch_tail   = 0; // written by the consumer only
+static uint32_t          prefetch_offset = 0; // next clip offset to be read into the ring
+
+void audio_sample_start(const audio_sample_t *sample) {
+    active = false;
+
+    current         = sample;
+    adpcm           = (adpcm_state_t){0};
+    decoded         = 0;
+    byte_index      = 0;
+    pending_byte    = 0;
+    position        = -2;
+    phase           = 2UL << 16; // forces the first two samples to be decoded right away
+    previous        = 0;
+    latest          = 0;
+    prefetch_head   = 0;
+    prefetch_tail   = 0;
+    prefetch_offset = 0;
+
+    if (sample == NULL || sample->sample_count == 0) {
+        return;
+    }
+
+    // prime the ring, so playback does not start with an underrun
+    audio_sample_task();
+
+    active = true;
+}
+
+void audio_sample_stop(void) {
+    active = false;
+}
+
+bool audio_sample_is_active(void) {
+    return active;
+}
+
+void audio_sample_task(void) {
+    const audio_sample_t *sample = current;
+    if (sample == NULL || sample->data != NULL || sample->read == NULL) {
+        return;
+    }
+
+    while (prefetch_offset < sample->data_length) {
+        uint16_t head = prefetch_head;
+        uint16_t used = head - prefetch_tail;
+        if (used >= AUDIO_SAMPLE_PREFETCH_SIZE) {
+            break;
+        }
+
+        // largest contiguous chunk: bounded by free space, the end of the ring and the end of the clip
+        uint16_t start = head & (AUDIO_SAMPLE_PREFETCH_SIZE - 1);
+        uint32_t len   = AUDIO_SAMPLE_PREFETCH_SIZE - used;
+        if (len > AUDIO_SAMPLE_PREFETCH_SIZE - start) {
+            len = AUDIO_SAMPLE_PREFETCH_SIZE - start;
+        }
+        if (len > sample->data_length - prefetch_offset) {
+            len = sample->data_length - prefetch_offset;
+        }
+
+        if (!sample->read(prefetch_offset, &prefetch[start], len, sample->arg)) {
+            break;
+        }
+        prefetch_offset += len;
+        prefetch_head = head + len;
+    }
+}
+
+static inline bool fetch_byte(uint8_t *byte) {
+    if (byte_index >= current->data_length) {
+        return false;
+    }
+
+    if (current->data != NULL) {
+        *byte = current->data[byte_index++];
+        return true;
+    }
+
+    uint16_t tail = prefetch_tail;
+    if (tail == prefetch_head) {
+        return false; // underrun, the main loop did not keep up
+    }
+    *byte         = prefetch[tail & (AUDIO_SAMPLE_PREFETCH_SIZE - 1)];
+    prefetch_tail = tail + 1;
+    byte_index++;
+    return true;
+}
+
+static inline bool decode_next(int16_t *out) {
+    uint8_t byte;
+    switch (current->format) {
+        case AUDIO_SAMPLE_FORMAT_PCM_U8:
+            if (!fetch_byte(&byte)) {
+                return false;
+            }
+            *out = ((int16_t)byte - 128) << 8;
+            break;
+        case AUDIO_SAMPLE_FORMAT_IMA_ADPCM:
+            if (decoded & 1) {
+                byte = pending_byte >> 4;
+            } else {
+                if (!fetch_byte(&pending_byte)) {
+                    return false;
+                }
+                byte = pending_byte & 0x0F;
+            }
+            *out = adpcm_decode_nibble(&adpcm, byte);
+            break;
+        default:
+            return false;
+    }
+    decoded++;
+    return true;
+}
+
+size_t audio_sample_render(int16_t *buffer, size_t count, uint32_t output_rate) {
+    size_t rendered = 0;
+
+    if (active && output_rate > 0) {
+        const uint32_t step = ((uint32_t)current->sample_rate << 16) / output_rate;
+
+        while (rendered < count) {
+            // advance through the clip, linearly interpolating between the two most recent samples
+            bool underrun = false;
+            while (phase >= (1UL << 16)) {
+                if (position + 1 >= (int32_t)current->sample_count) {
+                    active = false;
+                    break;
+                }
+                int16_t next = latest; // past the last sample, hold it for the final interpolation step
+                if (decoded < current->sample_count && !decode_next(&next)) {
+                    if (current->data != NULL || prefetch_offset >= current->data_length) {
+                        active = false; // truncated clip
+                        break;
+                    }
+                    // data not available yet, hold the output rather than skipping ahead
+                    underrun = true;
+                    break;
+                }
+                position++;
+                previous = latest;
+                latest   = next;
+                phase -= 1UL << 16;
+            }
+            if (!active) {
+                break;
+            }
+            if (underrun) {
+                buffer[rendered++] = latest;
+                continue;
+            }
+
+            buffer[rendered++] = previous + (((int32_t)(latest - previous) * (int32_t)(phase >> 1)) >> 15);
+            phase += step;
+        }
+    }
+
+    for (size_t i = rendered; i < count; i++) {
+        buffer[i] = 0;
+    }
+
+    return rendered;
+}
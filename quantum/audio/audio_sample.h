@@ -0,0 +1,113 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Sample playback
+ *
+ * Streams short PCM/IMA-ADPCM clips through the audio driver, next to the
+ * tones handled by audio.c. Clips are decoded incrementally: the driver asks
+ * for one (half-)buffer worth of output samples at a time from within its
+ * DMA callback, so only the decoder state and a small prefetch buffer live
+ * in RAM, regardless of the clip length.
+ *
+ * Clip data may either be memory mapped (internal flash, `data` set), or be
+ * pulled through a read callback (e.g. external SPI flash, `read` set). The
+ * latter is prefetched from the main loop by audio_sample_task(), as the
+ * driver callback runs in interrupt context where bus transfers are off-limits.
+ */
+
+/**
+ * The sample encodings understood by the decoder.
+ */
+typedef enum {
+    AUDIO_SAMPLE_FORMAT_PCM_U8    = 0, //< unsigned 8bit PCM, one byte per sample
+    AUDIO_SAMPLE_FORMAT_IMA_ADPCM = 1, //< 4bit IMA-ADPCM, low nibble first, predictor and step index starting at zero
+} audio_sample_format_t;
+
+/**
+ * Callback used to fetch clip data from non memory mapped storage.
+ *
+ * @param offset byte offset from the start of the clip data
+ * @param buf destination buffer
+ * @param len number of bytes to read
+ * @param arg user argument, taken from audio_sample_t::arg
+ * @return true on success
+ */
+typedef bool (*audio_sample_read_t)(uint32_t offset, void *buf, size_t len, void *arg);
+
+typedef struct {
+    audio_sample_format_t format;       // encoding of the clip data
+    uint16_t              sample_rate;  // in Hz
+    uint32_t              sample_count; // number of (decoded) samples in the clip
+    uint32_t              data_length;  // number of (encoded) bytes in the clip
+    const uint8_t        *data;         // memory mapped clip data, or NULL if `read` should be used
+    audio_sample_read_t   read;         // callback used if `data` is NULL
+    void                 *arg;          // passed on to `read`
+} audio_sample_t;
+
+/**
+ * IMA-ADPCM decoder state.
+ */
+typedef struct {
+    int16_t predictor;
+    uint8_t step_index;
+} adpcm_state_t;
+
+/**
+ * Decodes a single 4bit IMA-ADPCM code, advancing the decoder state.
+ *
+ * @return the decoded 16bit signed sample
+ */
+int16_t adpcm_decode_nibble(adpcm_state_t *state, uint8_t nibble);
+
+/**
+ * Decodes 'count' samples (= nibbles, low nibble first) from 'in' into 'out'.
+ */
+void adpcm_decode_block(adpcm_state_t *state, const uint8_t *in, int16_t *out, size_t count);
+
+/**
+ * Starts streaming the given clip, replacing any clip currently playing.
+ *
+ * Note: this only sets up the decoder; use audio_play_sample from audio.h to
+ *       also get the audio driver running.
+ */
+void audio_sample_start(const audio_sample_t *sample);
+
+/**
+ * Stops the current clip, if any.
+ */
+void audio_sample_stop(void);
+
+/**
+ * @return true while a clip is being streamed
+ */
+bool audio_sample_is_active(void);
+
+/**
+ * Renders the next 'count' output samples of the current clip into 'buffer',
+ * resampling from the clip's sample rate to 'output_rate'. Positions past the
+ * end of the clip (or with no clip playing) are filled with silence.
+ *
+ * Intended to be called by the audio driver, once per DMA half-buffer.
+ *
+ * @return the number of samples taken from the clip
+ */
+size_t audio_sample_render(int16_t *buffer, size_t count, uint32_t output_rate);
+
+/**
+ * Refills the prefetch buffer for clips read through audio_sample_t::read.
+ * Called from the main loop; a no-op for memory mapped clips.
+ */
+void audio_sample_task(void);
+
+#ifdef __cplusplus
+}
+#endif
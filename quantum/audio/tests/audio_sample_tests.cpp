@@ -0,0 +1,229 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "audio_sample.h"
+}
+
+namespace {
+
+static const uint16_t step_table[89] = {
+    7,    8,    9,    10,   11,   12,   13,   14,   16,   17,   19,   21,   23,   25,   28,   31,    34,    37,    41,    45,    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,  143,  157,  173,  190,  209,  230,  253,  279,  307,  337,  371,  408,  449,  494,  544,   598,   658,   724,   796,   876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+// Reference IMA-ADPCM encoder, mirroring what `qmk audio-convert-wav` generates
+std::vector<uint8_t> adpcm_encode(const std::vector<int16_t> &pcm) {
+    std::vector<uint8_t> out((pcm.size() + 1) / 2, 0);
+    adpcm_state_t        state = {0, 0};
+    for (size_t i = 0; i < pcm.size(); i++) {
+        int32_t diff   = pcm[i] - state.predictor;
+        uint8_t nibble = 0;
+        if (diff < 0) {
+            nibble = 8;
+            diff   = -diff;
+        }
+        int32_t step = step_table[state.step_index];
+        if (diff >= step) {
+            nibble |= 4;
+            diff -= step;
+        }
+        step >>= 1;
+        if (diff >= step) {
+            nibble |= 2;
+            diff -= step;
+        }
+        step >>= 1;
+        if (diff >= step) {
+            nibble |= 1;
+        }
+        adpcm_decode_nibble(&state, nibble);
+        out[i / 2] |= (i & 1) ? (nibble << 4) : nibble;
+    }
+    return out;
+}
+
+std::vector<int16_t> sine(size_t count, float frequency, float rate, float amplitude = 12000.0f) {
+    std::vector<int16_t> pcm(count);
+    for (size_t i = 0; i < count; i++) {
+        pcm[i] = (int16_t)(amplitude * sinf(2.0f * (float)M_PI * frequency * i / rate));
+    }
+    return pcm;
+}
+
+struct flash_mock {
+    const std::vector<uint8_t> *data;
+    size_t                      max_chunk;
+    size_t                      reads;
+};
+
+bool flash_mock_read(uint32_t offset, void *buf, size_t len, void *arg) {
+    auto *mock = static_cast<flash_mock *>(arg);
+    EXPECT_LE(offset + len, mock->data->size());
+    EXPECT_LE(len, mock->max_chunk);
+    memcpy(buf, mock->data->data() + offset, len);
+    mock->reads++;
+    return true;
+}
+
+} // namespace
+
+class AudioSample : public ::testing::Test {
+   protected:
+    void TearDown() override {
+        audio_sample_stop();
+    }
+};
+
+TEST_F(AudioSample, AdpcmRoundTripTracksSource) {
+    auto pcm     = sine(4096, 440.0f, 16000.0f);
+    auto encoded = adpcm_encode(pcm);
+
+    std::vector<int16_t> decoded(pcm.size());
+    adpcm_state_t        state = {0, 0};
+    adpcm_decode_block(&state, encoded.data(), decoded.data(), decoded.size());
+
+    // after the step size has settled, the error stays well below the signal amplitude
+    int32_t max_error = 0;
+    for (size_t i = 64; i < pcm.size(); i++) {
+        max_error = std::max(max_error, std::abs((int32_t)pcm[i] - decoded[i]));
+    }
+    EXPECT_LT(max_error, 1200);
+}
+
+TEST_F(AudioSample, AdpcmDecodeBlockOddCount) {
+    const uint8_t in[] = {0x73, 0x1F};
+    int16_t       a[3], b[3];
+    adpcm_state_t s1 = {0, 0}, s2 = {0, 0};
+
+    adpcm_decode_block(&s1, in, a, 3);
+    b[0] = adpcm_decode_nibble(&s2, 0x3);
+    b[1] = adpcm_decode_nibble(&s2, 0x7);
+    b[2] = adpcm_decode_nibble(&s2, 0xF);
+    EXPECT_EQ(0, memcmp(a, b, sizeof(a)));
+}
+
+TEST_F(AudioSample, RenderAtNativeRateMatchesDecoder) {
+    auto pcm     = sine(1000, 440.0f, 8000.0f);
+    auto encoded = adpcm_encode(pcm);
+
+    audio_sample_t clip = {
+        .format       = AUDIO_SAMPLE_FORMAT_IMA_ADPCM,
+        .sample_rate  = 8000,
+        .sample_count = (uint32_t)pcm.size(),
+        .data_length  = (uint32_t)encoded.size(),
+        .data         = encoded.data(),
+    };
+
+    std::vector<int16_t> reference(pcm.size());
+    adpcm_state_t        state = {0, 0};
+    adpcm_decode_block(&state, encoded.data(), reference.data(), reference.size());
+
+    audio_sample_start(&clip);
+    ASSERT_TRUE(audio_sample_is_active());
+
+    // consume in 'half-buffer' sized chunks, as the driver would
+    std::vector<int16_t> rendered;
+    int16_t              chunk[64];
+    size_t               n;
+    while ((n = audio_sample_render(chunk, 64, 8000)) > 0) {
+        rendered.insert(rendered.end(), chunk, chunk + n);
+    }
+    EXPECT_FALSE(audio_sample_is_active());
+    ASSERT_EQ(rendered.size(), reference.size());
+    EXPECT_EQ(rendered, reference);
+}
+
+TEST_F(AudioSample, RenderResamplesToOutputRate) {
+    std::vector<uint8_t> pcm8(800, 128);
+    audio_sample_t       clip = {
+              .format       = AUDIO_SAMPLE_FORMAT_PCM_U8,
+              .sample_rate  = 8000,
+              .sample_count = (uint32_t)pcm8.size(),
+              .data_length  = (uint32_t)pcm8.size(),
+              .data         = pcm8.data(),
+    };
+
+    audio_sample_start(&clip);
+    size_t  total = 0, n;
+    int16_t chunk[128];
+    while ((n = audio_sample_render(chunk, 128, 44100)) > 0) {
+        total += n;
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_EQ(chunk[i], 0);
+        }
+    }
+    // 100ms of audio, give or take the interpolation tail
+    EXPECT_NEAR(total, 4410, 8);
+}
+
+TEST_F(AudioSample, SilenceWhenIdle) {
+    int16_t chunk[16];
+    memset(chunk, 0x55, sizeof(chunk));
+    EXPECT_EQ(audio_sample_render(chunk, 16, 44100), 0u);
+    for (auto v : chunk) {
+        EXPECT_EQ(v, 0);
+    }
+}
+
+TEST_F(AudioSample, StreamsFromReadCallback) {
+    auto pcm     = sine(3000, 1000.0f, 16000.0f);
+    auto encoded = adpcm_encode(pcm);
+
+    flash_mock     mock = {&encoded, 256, 0};
+    audio_sample_t clip = {
+        .format       = AUDIO_SAMPLE_FORMAT_IMA_ADPCM,
+        .sample_rate  = 16000,
+        .sample_count = (uint32_t)pcm.size(),
+        .data_length  = (uint32_t)encoded.size(),
+        .data         = NULL,
+        .read         = flash_mock_read,
+        .arg          = &mock,
+    };
+
+    std::vector<int16_t> reference(pcm.size());
+    adpcm_state_t        state = {0, 0};
+    adpcm_decode_block(&state, encoded.data(), reference.data(), reference.size());
+
+    audio_sample_start(&clip);
+    std::vector<int16_t> rendered;
+    int16_t              chunk[128];
+    size_t               n;
+    // the 'main loop' refills the prefetch buffer between two driver callbacks
+    while ((n = audio_sample_render(chunk, 128, 16000)) > 0) {
+        rendered.insert(rendered.end(), chunk, chunk + n);
+        audio_sample_task();
+    }
+    EXPECT_EQ(rendered, reference);
+    EXPECT_GT(mock.reads, 1u);
+}
+
+TEST_F(AudioSample, UnderrunHoldsInsteadOfEnding) {
+    auto pcm     = sine(4000, 1000.0f, 16000.0f);
+    auto encoded = adpcm_encode(pcm);
+
+    flash_mock     mock = {&encoded, 256, 0};
+    audio_sample_t clip = {
+        .format       = AUDIO_SAMPLE_FORMAT_IMA_ADPCM,
+        .sample_rate  = 16000,
+        .sample_count = (uint32_t)pcm.size(),
+        .data_length  = (uint32_t)encoded.size(),
+        .data         = NULL,
+        .read         = flash_mock_read,
+        .arg          = &mock,
+    };
+
+    audio_sample_start(&clip);
+    int16_t chunk[1024];
+    // without audio_sample_task running, only the primed 256 bytes (512 samples) are available
+    EXPECT_EQ(audio_sample_render(chunk, 1024, 16000), 1024u);
+    EXPECT_TRUE(audio_sample_is_active());
+    EXPECT_EQ(chunk[1023], chunk[600]);
+}
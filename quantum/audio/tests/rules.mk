@@ -0,0 +1,6 @@
+audio_sample_DEFS := -DAUDIO_SAMPLE_ENABLE
+audio_sample_INC := $(QUANTUM_PATH)/audio
+
+audio_sample_SRC := \
+	$(QUANTUM_PATH)/audio/tests/audio_sample_tests.cpp \
+	$(QUANTUM_PATH)/audio/audio_sample.c
@@ -0,0 +1,135 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "autocorrect.h"
+#include "keycodes.h"
+
+#if !__has_include("autocorrect_data.h")
+#    pragma message "Autocorrect is using the default library."
+#endif
+
+void autocorrect_buffer_push(autocorrect_buffer_t *buffer, uint8_t keycode) {
+    if (buffer->size < AUTOCORRECT_MAX_LENGTH) {
+        uint8_t position = buffer->start + buffer->size++;
+        if (position >= AUTOCORRECT_MAX_LENGTH) {
+            position -= AUTOCORRECT_MAX_LENGTH;
+        }
+        buffer->keycodes[position] = keycode;
+        return;
+    }
+
+    // Overwrite the oldest keycode, the next one becomes the start.
+    buffer->keycodes[buffer->start] = keycode;
+    if (++buffer->start >= AUTOCORRECT_MAX_LENGTH) {
+        buffer->start = 0;
+    }
+}
+
+bool autocorrect_find_trie(const uint8_t *data, uint16_t data_size, const autocorrect_buffer_t *buffer, autocorrect_match_t *match) {
+    uint16_t state = 0;
+    uint8_t  code  = pgm_read_byte(data + state);
+    for (int8_t i = buffer->size - 1; i >= 0; --i) {
+        uint8_t const key_i = autocorrect_buffer_get(buffer, i);
+
+        if (code & 64) { // Check for match in node with multiple children.
+            code &= 63;
+            for (; code != key_i; code = pgm_read_byte(data + (state += 3))) {
+                if (!code) return false;
+            }
+            // Follow link to child node.
+            state = (pgm_read_byte(data + state + 1) | pgm_read_byte(data + state + 2) << 8);
+            // Check for match in node with single child.
+        } else if (code != key_i) {
+            return false;
+        } else if (!(code = pgm_read_byte(data + (++state)))) {
+            ++state;
+        }
+
+        // Stop if `state` becomes an invalid index. This should not normally
+        // happen, it is a safeguard in case of a bug, data corruption, etc.
+        if (state >= data_size) {
+            return false;
+        }
+
+        code = pgm_read_byte(data + state);
+
+        if (code & 128) { // A typo was found!
+            match->backspaces = code & 63;
+            match->changes    = (const char *)(data + state + 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+#ifdef AUTOCORRECT_DATA_VERSION
+
+#    define AUTOCORRECT_SYMBOL_QUOTE 27
+#    define AUTOCORRECT_SYMBOL_SPACE 28
+
+#    ifdef AUTOCORRECT_LARGE_DICTIONARY
+typedef uint32_t autocorrect_state_t;
+#        define AUTOCORRECT_TAIL_FLAG 0x80000000UL
+#        define autocorrect_read_base(state) pgm_read_dword(&autocorrect_base[state])
+#    else
+typedef uint16_t autocorrect_state_t;
+#        define AUTOCORRECT_TAIL_FLAG 0x8000U
+#        define autocorrect_read_base(state) pgm_read_word(&autocorrect_base[state])
+#    endif
+
+/**
+ * \brief Maps a buffered keycode to the symbol the double array is indexed by.
+ *
+ * This must match TYPO_SYMBOLS in lib/python/qmk/cli/generate/autocorrect_data.py.
+ */
+static inline uint8_t autocorrect_symbol(uint8_t keycode) {
+    switch (keycode) {
+        case KC_QUOTE:
+            return AUTOCORRECT_SYMBOL_QUOTE;
+        case KC_SPACE:
+            return AUTOCORRECT_SYMBOL_SPACE;
+        default:
+            return keycode - KC_A + 1;
+    }
+}
+
+bool autocorrect_find(const autocorrect_buffer_t *buffer, autocorrect_match_t *match) {
+    autocorrect_state_t state = 0;
+    int8_t              i     = buffer->size - 1;
+
+    for (;;) {
+        autocorrect_state_t base = autocorrect_read_base(state);
+
+        if (base & AUTOCORRECT_TAIL_FLAG) {
+            // Only a single typo goes on from here, compare the rest of it in one go.
+            const uint8_t *tail = autocorrect_tail + (base & ~AUTOCORRECT_TAIL_FLAG);
+            for (uint8_t symbol; (symbol = pgm_read_byte(tail)) != 0; ++tail, --i) {
+                if (i < 0 || autocorrect_symbol(autocorrect_buffer_get(buffer, i)) != symbol) {
+                    return false;
+                }
+            }
+            match->backspaces = pgm_read_byte(tail + 1);
+            match->changes    = (const char *)(tail + 2);
+            return true;
+        }
+
+        if (i < 0) {
+            return false;
+        }
+
+        uint8_t symbol = autocorrect_symbol(autocorrect_buffer_get(buffer, i--));
+        state          = base + symbol;
+        // Bases are unique, so a matching symbol also proves the cell belongs to this state.
+        if (state >= AUTOCORRECT_NODE_COUNT || pgm_read_byte(&autocorrect_check[state]) != symbol) {
+            return false;
+        }
+    }
+}
+
+#else
+
+bool autocorrect_find(const autocorrect_buffer_t *buffer, autocorrect_match_t *match) {
+    return autocorrect_find_trie(autocorrect_data, DICTIONARY_SIZE, buffer, match);
+}
+
+#endif
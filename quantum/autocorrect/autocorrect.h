@@ -0,0 +1,88 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/**
+ * \file
+ *
+ * \defgroup autocorrect Autocorrect dictionary lookup
+ *
+ * \brief Matches recently typed keycodes against the autocorrect dictionary.
+ *
+ * The dictionary is a trie of the reversed typos, stored as a double array: the child of a state for a given symbol
+ * is found at a fixed offset from the state's base, so every typed character costs a single lookup regardless of how
+ * many typos branch off at that point. Once only a single typo remains, its remaining characters and its correction
+ * are stored together in a tail, see the appendix of the autocorrect documentation.
+ * \{
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "progmem.h"
+
+#if __has_include("autocorrect_data.h")
+#    include "autocorrect_data.h"
+#else
+#    include "autocorrect_data_default.h"
+#endif
+
+/**
+ * \brief Recently typed keycodes, oldest first.
+ *
+ * Kept as a ring so that typing into a full buffer drops the oldest keycode without moving the others.
+ */
+typedef struct {
+    uint8_t keycodes[AUTOCORRECT_MAX_LENGTH];
+    uint8_t start;
+    uint8_t size;
+} autocorrect_buffer_t;
+
+/**
+ * \brief A typo found at the end of the buffer.
+ */
+typedef struct {
+    uint8_t     backspaces;
+    const char *changes; // PROGMEM
+} autocorrect_match_t;
+
+/**
+ * \brief Returns the keycode at `index`, counting from the oldest one in the buffer.
+ */
+static inline uint8_t autocorrect_buffer_get(const autocorrect_buffer_t *buffer, uint8_t index) {
+    uint8_t position = buffer->start + index;
+    if (position >= AUTOCORRECT_MAX_LENGTH) {
+        position -= AUTOCORRECT_MAX_LENGTH;
+    }
+    return buffer->keycodes[position];
+}
+
+/**
+ * \brief Appends a keycode to the buffer, dropping the oldest one if it is full.
+ */
+void autocorrect_buffer_push(autocorrect_buffer_t *buffer, uint8_t keycode);
+
+/**
+ * \brief Searches the dictionary for a typo the buffer ends with.
+ *
+ * \param buffer The recently typed keycodes: KC_A to KC_Z, KC_QUOTE, and KC_SPACE for word boundaries.
+ * \param match Receives the correction if a typo was found.
+ * \return true if a typo was found.
+ */
+bool autocorrect_find(const autocorrect_buffer_t *buffer, autocorrect_match_t *match);
+
+/**
+ * \brief Searches a dictionary in the original byte-packed trie format for a typo the buffer ends with.
+ *
+ * Used for `autocorrect_data.h` files generated before the double-array format was introduced.
+ *
+ * \param data The serialized trie.
+ * \param data_size The size of `data`, in bytes.
+ * \param buffer The recently typed keycodes.
+ * \param match Receives the correction if a typo was found.
+ * \return true if a typo was found.
+ */
+bool autocorrect_find_trie(const uint8_t *data, uint16_t data_size, const autocorrect_buffer_t *buffer, autocorrect_match_t *match);
+
+/** \} */
@@ -0,0 +1,157 @@
+// Generated code.
+
+#pragma once
+
+// Autocorrection dictionary (70 entries):
+//   :guage     -> gauge
+//   :the:the:  -> the
+//   :thier     -> their
+//   :ture      -> true
+//   accomodate -> accommodate
+//   acommodate -> accommodate
+//   aparent    -> apparent
+//   aparrent   -> apparent
+//   apparant   -> apparent
+//   apparrent  -> apparent
+//   aquire     -> acquire
+//   becuase    -> because
+//   cauhgt     -> caught
+//   cheif      -> chief
+//   choosen    -> chosen
+//   cieling    -> ceiling
+//   collegue   -> colleague
+//   concensus  -> consensus
+//   contians   -> contains
+//   cosnt      -> const
+//   dervied    -> derived
+//   fales      -> false
+//   fasle      -> false
+//   fitler     -> filter
+//   flase      -> false
+//   foward     -> forward
+//   frequecy   -> frequency
+//   gaurantee  -> guarantee
+//   guaratee   -> guarantee
+//   heigth     -> height
+//   heirarchy  -> hierarchy
+//   inclued    -> include
+//   interator  -> iterator
+//   intput     -> input
+//   invliad    -> invalid
+//   lenght     -> length
+//   liasion    -> liaison
+//   libary     -> library
+//   listner    -> listener
+//   looses:    -> loses
+//   looup      -> lookup
+//   manefist   -> manifest
+//   namesapce  -> namespace
+//   namespcae  -> namespace
+//   occassion  -> occasion
+//   occured    -> occurred
+//   ouptut     -> output
+//   ouput      -> output
+//   overide    -> override
+//   postion    -> position
+//   priviledge -> privilege
+//   psuedo     -> pseudo
+//   recieve    -> receive
+//   refered    -> referred
+//   relevent   -> relevant
+//   repitition -> repetition
+//   retrun     -> return
+//   retun      -> return
+//   reuslt     -> result
+//   reutrn     -> return
+//   saftey     -> safety
+//   seperate   -> separate
+//   singed     -> signed
+//   stirng     -> string
+//   strign     -> string
+//   swithc     -> switch
+//   swtich     -> switch
+//   thresold   -> threshold
+//   udpate     -> update
+//   widht      -> width
+
+#define AUTOCORRECT_DATA_VERSION 2
+#define AUTOCORRECT_MIN_LENGTH 5 // ":ture"
+#define AUTOCORRECT_MAX_LENGTH 10 // "accomodate"
+#define AUTOCORRECT_NODE_COUNT 124
+#define AUTOCORRECT_TAIL_SIZE 758
+
+static const uint16_t autocorrect_base[AUTOCORRECT_NODE_COUNT] PROGMEM = {
+    0x0000, 0x0000, 0x004D, 0x8000, 0x000C, 0x001C, 0x800A, 0x0007, 0x0013, 0x802A, 0x0057, 0x0012,
+    0x0055, 0x803F, 0x0024, 0x8014, 0x8020, 0x003E, 0x0015, 0x0027, 0x0033, 0x002B, 0x80AD, 0x8034,
+    0x804B, 0x003B, 0x0043, 0x0000, 0x0004, 0x8064, 0x8058, 0x8071, 0x807F, 0x000E, 0x0056, 0x0029,
+    0x80E0, 0x005C, 0x0058, 0x80B8, 0x808B, 0x80C1, 0x818A, 0x80CC, 0x80F1, 0x8194, 0x002F, 0x0001,
+    0x0009, 0x8094, 0x80A1, 0x0002, 0x81B4, 0x80F9, 0x80D5, 0x0035, 0x81A0, 0x0037, 0x8116, 0x004E,
+    0x8106, 0x81C1, 0x8139, 0x8120, 0x8145, 0x0049, 0x005B, 0x814F, 0x81AC, 0x816C, 0x812B, 0x8176,
+    0x0044, 0x81CB, 0x8208, 0x81D4, 0x81DB, 0x8161, 0x0048, 0x81E4, 0x0051, 0x81EE, 0x81F9, 0x8181,
+    0x004B, 0x8200, 0x8225, 0x8237, 0x821B, 0x8252, 0x0062, 0x0028, 0x8213, 0x8294, 0x827A, 0x8284,
+    0x828C, 0x82A7, 0x825A, 0x82C0, 0x8242, 0x006B, 0x822E, 0x8264, 0x82CB, 0x826E, 0x82DA, 0x82B6,
+    0x82E6, 0x0000, 0x0000, 0x829D, 0x0000, 0x0000, 0x0000, 0x0000, 0x000B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x82EF
+};
+
+static const uint8_t autocorrect_check[AUTOCORRECT_NODE_COUNT] PROGMEM = {
+    0x00, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x05, 0x01, 0x09, 0x01, 0x01, 0x0E, 0x0F,
+    0x10, 0x05, 0x12, 0x13, 0x14, 0x0E, 0x03, 0x13, 0x0C, 0x19, 0x05, 0x00, 0x1C, 0x01, 0x12, 0x03,
+    0x04, 0x05, 0x14, 0x07, 0x0F, 0x13, 0x14, 0x14, 0x0C, 0x05, 0x01, 0x07, 0x05, 0x04, 0x12, 0x13,
+    0x14, 0x15, 0x16, 0x0F, 0x09, 0x0E, 0x12, 0x0F, 0x09, 0x15, 0x07, 0x08, 0x15, 0x12, 0x03, 0x0C,
+    0x05, 0x0E, 0x0D, 0x08, 0x15, 0x07, 0x13, 0x09, 0x15, 0x12, 0x01, 0x14, 0x09, 0x12, 0x05, 0x0C,
+    0x12, 0x0E, 0x04, 0x15, 0x10, 0x07, 0x05, 0x01, 0x14, 0x0C, 0x12, 0x04, 0x13, 0x01, 0x16, 0x14,
+    0x15, 0x09, 0x15, 0x01, 0x0E, 0x10, 0x15, 0x10, 0x0D, 0x12, 0x0F, 0x13, 0x01, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+};
+
+static const uint8_t autocorrect_tail[AUTOCORRECT_TAIL_SIZE] PROGMEM = {
+    0x08, 0x14, 0x09, 0x17, 0x13, 0x00, 0x01, 0x63, 0x68, 0x00, 0x09, 0x05, 0x08, 0x03, 0x00, 0x02,
+    0x69, 0x65, 0x66, 0x00, 0x04, 0x05, 0x15, 0x13, 0x10, 0x00, 0x03, 0x65, 0x75, 0x64, 0x6F, 0x00,
+    0x15, 0x0F, 0x0F, 0x0C, 0x00, 0x01, 0x6B, 0x75, 0x70, 0x00, 0x08, 0x14, 0x1C, 0x05, 0x08, 0x14,
+    0x1C, 0x00, 0x04, 0x00, 0x05, 0x13, 0x0F, 0x0F, 0x0C, 0x00, 0x04, 0x73, 0x65, 0x73, 0x00, 0x09,
+    0x0C, 0x16, 0x0E, 0x09, 0x00, 0x03, 0x61, 0x6C, 0x69, 0x64, 0x00, 0x0F, 0x13, 0x05, 0x12, 0x08,
+    0x14, 0x00, 0x02, 0x68, 0x6F, 0x6C, 0x64, 0x00, 0x01, 0x17, 0x0F, 0x06, 0x00, 0x03, 0x72, 0x77,
+    0x61, 0x72, 0x64, 0x00, 0x03, 0x10, 0x13, 0x05, 0x0D, 0x01, 0x0E, 0x00, 0x02, 0x61, 0x63, 0x65,
+    0x00, 0x10, 0x01, 0x13, 0x05, 0x0D, 0x01, 0x0E, 0x00, 0x03, 0x70, 0x61, 0x63, 0x65, 0x00, 0x09,
+    0x12, 0x05, 0x16, 0x0F, 0x00, 0x02, 0x72, 0x69, 0x64, 0x65, 0x00, 0x13, 0x01, 0x06, 0x00, 0x02,
+    0x6C, 0x73, 0x65, 0x00, 0x07, 0x05, 0x0C, 0x0C, 0x0F, 0x03, 0x00, 0x02, 0x61, 0x67, 0x75, 0x65,
+    0x00, 0x05, 0x09, 0x03, 0x05, 0x12, 0x00, 0x03, 0x65, 0x69, 0x76, 0x65, 0x00, 0x09, 0x14, 0x17,
+    0x13, 0x00, 0x03, 0x69, 0x74, 0x63, 0x68, 0x00, 0x07, 0x09, 0x05, 0x08, 0x00, 0x01, 0x68, 0x74,
+    0x00, 0x13, 0x0F, 0x0F, 0x08, 0x03, 0x00, 0x03, 0x73, 0x65, 0x6E, 0x00, 0x09, 0x12, 0x14, 0x13,
+    0x00, 0x01, 0x6E, 0x67, 0x00, 0x14, 0x15, 0x05, 0x12, 0x00, 0x03, 0x74, 0x75, 0x72, 0x6E, 0x00,
+    0x14, 0x01, 0x12, 0x05, 0x14, 0x0E, 0x09, 0x00, 0x07, 0x74, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72,
+    0x00, 0x0C, 0x01, 0x06, 0x00, 0x01, 0x73, 0x65, 0x00, 0x01, 0x09, 0x14, 0x0E, 0x0F, 0x03, 0x00,
+    0x03, 0x61, 0x69, 0x6E, 0x73, 0x00, 0x13, 0x0E, 0x05, 0x03, 0x0E, 0x0F, 0x03, 0x00, 0x05, 0x73,
+    0x65, 0x6E, 0x73, 0x75, 0x73, 0x00, 0x08, 0x15, 0x01, 0x03, 0x00, 0x02, 0x67, 0x68, 0x74, 0x00,
+    0x13, 0x15, 0x05, 0x12, 0x00, 0x03, 0x73, 0x75, 0x6C, 0x74, 0x00, 0x09, 0x06, 0x05, 0x0E, 0x01,
+    0x0D, 0x00, 0x04, 0x69, 0x66, 0x65, 0x73, 0x74, 0x00, 0x05, 0x15, 0x11, 0x05, 0x12, 0x06, 0x00,
+    0x01, 0x6E, 0x63, 0x79, 0x00, 0x14, 0x06, 0x01, 0x13, 0x00, 0x02, 0x65, 0x74, 0x79, 0x00, 0x03,
+    0x12, 0x01, 0x12, 0x09, 0x05, 0x08, 0x00, 0x07, 0x69, 0x65, 0x72, 0x61, 0x72, 0x63, 0x68, 0x79,
+    0x00, 0x01, 0x02, 0x09, 0x0C, 0x00, 0x02, 0x72, 0x61, 0x72, 0x79, 0x00, 0x0E, 0x09, 0x13, 0x00,
+    0x03, 0x67, 0x6E, 0x65, 0x64, 0x00, 0x16, 0x12, 0x05, 0x04, 0x00, 0x03, 0x69, 0x76, 0x65, 0x64,
+    0x00, 0x0C, 0x03, 0x0E, 0x09, 0x00, 0x01, 0x64, 0x65, 0x00, 0x15, 0x07, 0x1C, 0x00, 0x03, 0x61,
+    0x75, 0x67, 0x65, 0x00, 0x05, 0x0C, 0x09, 0x16, 0x09, 0x12, 0x10, 0x00, 0x02, 0x67, 0x65, 0x00,
+    0x15, 0x11, 0x01, 0x00, 0x04, 0x63, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x14, 0x1C, 0x00, 0x02,
+    0x72, 0x75, 0x65, 0x00, 0x0C, 0x05, 0x09, 0x03, 0x00, 0x05, 0x65, 0x69, 0x6C, 0x69, 0x6E, 0x67,
+    0x00, 0x09, 0x14, 0x13, 0x00, 0x03, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x14, 0x05, 0x12, 0x00, 0x02,
+    0x75, 0x72, 0x6E, 0x00, 0x05, 0x12, 0x00, 0x00, 0x72, 0x6E, 0x00, 0x08, 0x14, 0x1C, 0x00, 0x02,
+    0x65, 0x69, 0x72, 0x00, 0x14, 0x09, 0x06, 0x00, 0x03, 0x6C, 0x74, 0x65, 0x72, 0x00, 0x14, 0x13,
+    0x09, 0x0C, 0x00, 0x02, 0x65, 0x6E, 0x65, 0x72, 0x00, 0x09, 0x17, 0x00, 0x01, 0x74, 0x68, 0x00,
+    0x0E, 0x05, 0x0C, 0x00, 0x01, 0x74, 0x68, 0x00, 0x12, 0x01, 0x10, 0x10, 0x01, 0x00, 0x02, 0x65,
+    0x6E, 0x74, 0x00, 0x0F, 0x03, 0x00, 0x02, 0x6E, 0x73, 0x74, 0x00, 0x10, 0x15, 0x0F, 0x00, 0x03,
+    0x74, 0x70, 0x75, 0x74, 0x00, 0x06, 0x05, 0x12, 0x00, 0x01, 0x72, 0x65, 0x64, 0x00, 0x03, 0x03,
+    0x0F, 0x00, 0x01, 0x72, 0x65, 0x64, 0x00, 0x12, 0x01, 0x15, 0x07, 0x00, 0x02, 0x6E, 0x74, 0x65,
+    0x65, 0x00, 0x01, 0x12, 0x15, 0x01, 0x07, 0x00, 0x07, 0x75, 0x61, 0x72, 0x61, 0x6E, 0x74, 0x65,
+    0x65, 0x00, 0x06, 0x00, 0x03, 0x61, 0x6C, 0x73, 0x65, 0x00, 0x03, 0x05, 0x02, 0x00, 0x03, 0x61,
+    0x75, 0x73, 0x65, 0x00, 0x04, 0x15, 0x00, 0x04, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00, 0x05, 0x10,
+    0x05, 0x13, 0x00, 0x04, 0x61, 0x72, 0x61, 0x74, 0x65, 0x00, 0x05, 0x0C, 0x05, 0x12, 0x00, 0x02,
+    0x61, 0x6E, 0x74, 0x00, 0x0E, 0x09, 0x00, 0x03, 0x70, 0x75, 0x74, 0x00, 0x0F, 0x00, 0x02, 0x74,
+    0x70, 0x75, 0x74, 0x00, 0x09, 0x0C, 0x00, 0x03, 0x69, 0x73, 0x6F, 0x6E, 0x00, 0x01, 0x03, 0x03,
+    0x0F, 0x00, 0x03, 0x69, 0x6F, 0x6E, 0x00, 0x14, 0x09, 0x10, 0x05, 0x12, 0x00, 0x06, 0x65, 0x74,
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0F, 0x10, 0x00, 0x03, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00,
+    0x10, 0x01, 0x00, 0x04, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x0F, 0x03, 0x01, 0x00, 0x07,
+    0x63, 0x6F, 0x6D, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x03, 0x03, 0x01, 0x00, 0x04, 0x6D,
+    0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x05, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x01,
+    0x00, 0x03, 0x65, 0x6E, 0x74, 0x00
+};
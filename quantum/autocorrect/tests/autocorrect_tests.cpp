@@ -0,0 +1,163 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "keycodes.h"
+#include "autocorrect.h"
+}
+
+// The default dictionary in the byte-packed trie format it was shipped in before.
+namespace legacy {
+#include "autocorrect_data_legacy.h"
+}
+
+namespace {
+
+void type(autocorrect_buffer_t *buffer, const char *text) {
+    for (; *text; ++text) {
+        switch (*text) {
+            case ' ':
+                autocorrect_buffer_push(buffer, KC_SPACE);
+                break;
+            case '\'':
+                autocorrect_buffer_push(buffer, KC_QUOTE);
+                break;
+            default:
+                autocorrect_buffer_push(buffer, KC_A + *text - 'a');
+                break;
+        }
+    }
+}
+
+autocorrect_buffer_t fresh_buffer() {
+    autocorrect_buffer_t buffer = {};
+    autocorrect_buffer_push(&buffer, KC_SPACE);
+    return buffer;
+}
+
+bool find_legacy(const autocorrect_buffer_t *buffer, autocorrect_match_t *match) {
+    return autocorrect_find_trie(legacy::autocorrect_data, DICTIONARY_SIZE, buffer, match);
+}
+
+// Words from the default dictionary, spelled correctly and as typos.
+const std::vector<std::string> WORDS = {
+    "the",      "their",  "thier",    "false",      "fales",     "flase",    "length",  "lenght",  "output", "ouput",
+    "ouptut",   "loses",  "looses",   "accomodate", "apparent",  "aparrent", "because", "becuase", "width",  "widht",
+    "ture",     "true",   "guage",    "return",     "retrun",    "reutrn",   "switch",  "swtich",  "string", "strign",
+    "occassion", "occured", "recieve", "seperate",  "threshold", "thresold", "update",  "udpate",  "don't",  "signed",
+};
+
+std::vector<std::string> random_text(size_t words, unsigned seed) {
+    std::mt19937                          rng(seed);
+    std::uniform_int_distribution<size_t> pick(0, WORDS.size() - 1);
+    std::vector<std::string>              text;
+    for (size_t i = 0; i < words; i++) {
+        text.push_back(WORDS[pick(rng)]);
+    }
+    return text;
+}
+
+/*
+ * Types `text` a character at a time, looking up the buffer after each one
+ * like process_autocorrect() does, and records where typos were found.
+ */
+template <typename Find>
+std::vector<std::pair<size_t, std::string>> run(const std::vector<std::string> &text, Find find) {
+    std::vector<std::pair<size_t, std::string>> found;
+    autocorrect_buffer_t                        buffer    = fresh_buffer();
+    size_t                                      keystroke = 0;
+    for (const auto &word : text) {
+        std::string typed = word + " ";
+        for (char c : typed) {
+            char one[2] = {c, 0};
+            type(&buffer, one);
+            keystroke++;
+            autocorrect_match_t match;
+            if (buffer.size >= AUTOCORRECT_MIN_LENGTH && find(&buffer, &match)) {
+                found.emplace_back(keystroke, std::to_string(match.backspaces) + match.changes);
+                buffer = c == ' ' ? fresh_buffer() : autocorrect_buffer_t{};
+            }
+        }
+    }
+    return found;
+}
+
+} // namespace
+
+TEST(AutocorrectLookup, BufferKeepsNewestWhenFull) {
+    autocorrect_buffer_t buffer = {};
+
+    for (uint8_t i = 0; i < AUTOCORRECT_MAX_LENGTH + 3; i++) {
+        autocorrect_buffer_push(&buffer, KC_A + i);
+    }
+    EXPECT_EQ(buffer.size, AUTOCORRECT_MAX_LENGTH);
+    for (uint8_t i = 0; i < AUTOCORRECT_MAX_LENGTH; i++) {
+        EXPECT_EQ(autocorrect_buffer_get(&buffer, i), KC_A + 3 + i);
+    }
+
+    // dropping keycodes from the end, as backspace does, keeps the rest in place
+    buffer.size -= 2;
+    autocorrect_buffer_push(&buffer, KC_Z);
+    EXPECT_EQ(autocorrect_buffer_get(&buffer, AUTOCORRECT_MAX_LENGTH - 2), KC_Z);
+    EXPECT_EQ(autocorrect_buffer_get(&buffer, 0), KC_A + 3);
+}
+
+TEST(AutocorrectLookup, FindsTypoAtEndOfBuffer) {
+    autocorrect_buffer_t buffer = fresh_buffer();
+    autocorrect_match_t  match;
+
+    type(&buffer, "fale");
+    EXPECT_FALSE(autocorrect_find(&buffer, &match));
+    type(&buffer, "s");
+    ASSERT_TRUE(autocorrect_find(&buffer, &match));
+    EXPECT_EQ(match.backspaces, 1);
+    EXPECT_STREQ(match.changes, "se");
+}
+
+TEST(AutocorrectLookup, RespectsWordBoundaries) {
+    autocorrect_buffer_t buffer = fresh_buffer();
+    autocorrect_match_t  match;
+
+    // ":thier" only triggers at the start of a word
+    type(&buffer, "xthier");
+    EXPECT_FALSE(autocorrect_find(&buffer, &match));
+    buffer = fresh_buffer();
+    type(&buffer, "thier");
+    EXPECT_TRUE(autocorrect_find(&buffer, &match));
+
+    // "looses:" only triggers once the word is complete
+    buffer = fresh_buffer();
+    type(&buffer, "looses");
+    EXPECT_FALSE(autocorrect_find(&buffer, &match));
+    type(&buffer, " ");
+    ASSERT_TRUE(autocorrect_find(&buffer, &match));
+    EXPECT_EQ(match.backspaces, 4);
+    EXPECT_STREQ(match.changes, "ses");
+}
+
+TEST(AutocorrectLookup, FindsTypoAcrossBufferWrap) {
+    autocorrect_buffer_t buffer = fresh_buffer();
+    autocorrect_match_t  match;
+
+    type(&buffer, "abcdefghi widht");
+    EXPECT_NE(buffer.start, 0);
+    ASSERT_TRUE(autocorrect_find(&buffer, &match));
+    EXPECT_STREQ(match.changes, "th");
+}
+
+TEST(AutocorrectLookup, MatchesLegacyFormat) {
+    auto text = random_text(20000, 1);
+
+    auto found        = run(text, autocorrect_find);
+    auto found_legacy = run(text, find_legacy);
+
+    EXPECT_GT(found.size(), 1000u);
+    EXPECT_EQ(found, found_legacy);
+}
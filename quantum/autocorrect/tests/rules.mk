@@ -0,0 +1,6 @@
+autocorrect_lookup_SRC := \
+    $(QUANTUM_PATH)/autocorrect/tests/autocorrect_tests.cpp \
+    $(QUANTUM_PATH)/autocorrect/autocorrect.c
+
+autocorrect_lookup_INC := \
+    $(QUANTUM_PATH)/autocorrect
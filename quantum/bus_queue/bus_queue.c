@@ -0,0 +1,80 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bus_queue.h"
+#include "spsc_ring.h"
+
+// Submitted by the main loop, taken by the worker
+SPSC_RING_DECLARE(bus_queue_ring, bus_transaction_t *, SPSC_RING_ROUND_UP(BUS_QUEUE_SIZE + 1));
+
+static bus_queue_ring_t queued;
+// Completed by the worker, handed back to the main loop
+static bus_queue_ring_t finished;
+// Transactions in either ring, only touched by the main loop. Bounding it keeps the worker from ever finding `finished` full.
+static uint8_t outstanding;
+static bool    has_worker;
+
+__attribute__((weak)) void bus_queue_init_worker(void) {}
+
+__attribute__((weak)) bool bus_queue_notify_worker(void) {
+    return false;
+}
+
+void bus_queue_init(void) {
+    bus_queue_ring_init(&queued);
+    bus_queue_ring_init(&finished);
+    outstanding = 0;
+    has_worker  = false;
+    bus_queue_init_worker();
+}
+
+bool bus_queue_submit(bus_transaction_t *transaction, bus_transaction_callback_t callback, void *context) {
+    if (bus_transaction_is_pending(transaction) || outstanding >= BUS_QUEUE_SIZE) {
+        return false;
+    }
+
+    transaction->callback = callback;
+    transaction->context  = context;
+    __atomic_store_n(&transaction->state, BUS_TRANSACTION_QUEUED, __ATOMIC_RELAXED);
+    bus_queue_ring_push(&queued, transaction);
+    outstanding++;
+
+    has_worker = bus_queue_notify_worker();
+    return true;
+}
+
+bool bus_queue_run_next(void) {
+    bus_transaction_t *transaction;
+    if (!bus_queue_ring_pop(&queued, &transaction)) {
+        return false;
+    }
+
+    transaction->status = transaction->transfer(transaction);
+    __atomic_store_n(&transaction->state, BUS_TRANSACTION_FINISHED, __ATOMIC_RELEASE);
+    bus_queue_ring_push(&finished, transaction);
+    return true;
+}
+
+void bus_queue_task(void) {
+    if (!has_worker) {
+        while (bus_queue_run_next()) {
+        }
+    }
+
+    bus_transaction_t *transaction;
+    while (bus_queue_ring_pop(&finished, &transaction)) {
+        outstanding--;
+        // Idle before the callback, so that it can submit the transaction again
+        __atomic_store_n(&transaction->state, BUS_TRANSACTION_IDLE, __ATOMIC_RELEASE);
+        if (transaction->callback) {
+            transaction->callback(transaction);
+        }
+    }
+}
+
+int16_t bus_transaction_wait(bus_transaction_t *transaction) {
+    while (bus_transaction_is_pending(transaction)) {
+        bus_queue_task();
+    }
+    return transaction->status;
+}
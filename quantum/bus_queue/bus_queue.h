@@ -0,0 +1,157 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * \file
+ *
+ * \defgroup bus_queue Bus Transaction Queue
+ *
+ * \brief Queues I2C and SPI transactions, so that the main loop does not have to wait for them to complete.
+ *
+ * Transactions are owned by the caller, and must stay valid along with their buffers until they have completed. They
+ * are transferred one at a time, in the order they were submitted. On ChibiOS a worker thread performs the transfers
+ * while the main loop carries on, elsewhere they are performed from bus_queue_task(). Completion callbacks are always
+ * invoked from bus_queue_task(), on the main loop.
+ *
+ * Transactions must only be submitted from the main loop.
+ * \{
+ */
+
+#ifndef BUS_QUEUE_SIZE
+#    define BUS_QUEUE_SIZE 16
+#endif
+
+typedef struct bus_transaction_t bus_transaction_t;
+
+/**
+ * \brief Performs the transfer of a transaction using the blocking driver API, returning its status.
+ */
+typedef int16_t (*bus_transaction_transfer_t)(bus_transaction_t *transaction);
+
+/**
+ * \brief Invoked from bus_queue_task() once a transaction has completed.
+ */
+typedef void (*bus_transaction_callback_t)(bus_transaction_t *transaction);
+
+typedef enum {
+    BUS_TRANSACTION_IDLE,     // Not submitted, or completed and its callback has been invoked
+    BUS_TRANSACTION_QUEUED,   // Waiting for, or in the middle of, its transfer
+    BUS_TRANSACTION_FINISHED, // Transferred, waiting for bus_queue_task() to invoke its callback
+} bus_transaction_state_t;
+
+// Forward declaration of spi_start_config_t so that SPI does not have to be enabled
+struct spi_start_config_t;
+
+struct bus_transaction_t {
+    bus_transaction_transfer_t transfer;
+    bus_transaction_callback_t callback;
+    void                      *context;
+
+    union {
+        struct {
+            uint8_t  address;
+            uint8_t  regaddr;
+            uint16_t timeout;
+        } i2c;
+        const struct spi_start_config_t *spi;
+    };
+
+    const uint8_t *tx_data;
+    uint8_t       *rx_data;
+    uint16_t       length;
+
+    volatile int16_t status;
+    volatile uint8_t state;
+};
+
+/**
+ * \brief Sets up the queue, and the worker thread where there is one.
+ */
+void bus_queue_init(void);
+
+/**
+ * \brief Invokes the callbacks of completed transactions, performing the queued transfers first where there is no worker thread.
+ */
+void bus_queue_task(void);
+
+/**
+ * \brief Queues a transaction whose `transfer`, parameters and buffers have been set up.
+ *
+ * \return `false` if the transaction is still pending or the queue is full, in which case nothing was queued.
+ */
+bool bus_queue_submit(bus_transaction_t *transaction, bus_transaction_callback_t callback, void *context);
+
+/**
+ * \brief Whether a transaction has been submitted and its callback has not been invoked yet.
+ */
+static inline bool bus_transaction_is_pending(const bus_transaction_t *transaction) {
+    return __atomic_load_n(&transaction->state, __ATOMIC_ACQUIRE) != BUS_TRANSACTION_IDLE;
+}
+
+/**
+ * \brief Waits for a transaction to complete, invoking the callbacks of any completed transactions meanwhile.
+ *
+ * \return The status of the transfer.
+ */
+int16_t bus_transaction_wait(bus_transaction_t *transaction);
+
+/**
+ * \brief Performs the oldest queued transfer. Called by the worker thread, or by bus_queue_task() if there is none.
+ *
+ * \return `false` if nothing was queued.
+ */
+bool bus_queue_run_next(void);
+
+/**
+ * \brief Platform hook, invoked from bus_queue_init() to start the worker thread.
+ */
+void bus_queue_init_worker(void);
+
+/**
+ * \brief Platform hook, invoked whenever a transaction has been queued.
+ *
+ * \return `true` if a worker thread has been woken up to perform the transfer, `false` to perform it from bus_queue_task().
+ */
+bool bus_queue_notify_worker(void);
+
+/**
+ * \brief Queues an i2c_transmit().
+ */
+bool i2c_transmit_async(bus_transaction_t *transaction, uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout, bus_transaction_callback_t callback, void *context);
+
+/**
+ * \brief Queues an i2c_receive().
+ */
+bool i2c_receive_async(bus_transaction_t *transaction, uint8_t address, uint8_t *data, uint16_t length, uint16_t timeout, bus_transaction_callback_t callback, void *context);
+
+/**
+ * \brief Queues an i2c_write_register().
+ */
+bool i2c_write_register_async(bus_transaction_t *transaction, uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout, bus_transaction_callback_t callback, void *context);
+
+/**
+ * \brief Queues an i2c_read_register().
+ */
+bool i2c_read_register_async(bus_transaction_t *transaction, uint8_t devaddr, uint8_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout, bus_transaction_callback_t callback, void *context);
+
+/**
+ * \brief Queues an spi_start_extended(), spi_transmit() and spi_stop().
+ *
+ * \param config The bus configuration, which must stay valid until the transaction has completed.
+ */
+bool spi_transmit_async(bus_transaction_t *transaction, const struct spi_start_config_t *config, const uint8_t *data, uint16_t length, bus_transaction_callback_t callback, void *context);
+
+/**
+ * \brief Queues an spi_start_extended(), spi_receive() and spi_stop().
+ *
+ * \param config The bus configuration, which must stay valid until the transaction has completed.
+ */
+bool spi_receive_async(bus_transaction_t *transaction, const struct spi_start_config_t *config, uint8_t *data, uint16_t length, bus_transaction_callback_t callback, void *context);
+
+/** \} */
@@ -0,0 +1,52 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bus_queue.h"
+#include "i2c_master.h"
+
+static int16_t transmit(bus_transaction_t *transaction) {
+    return i2c_transmit(transaction->i2c.address, transaction->tx_data, transaction->length, transaction->i2c.timeout);
+}
+
+static int16_t receive(bus_transaction_t *transaction) {
+    return i2c_receive(transaction->i2c.address, transaction->rx_data, transaction->length, transaction->i2c.timeout);
+}
+
+static int16_t write_register(bus_transaction_t *transaction) {
+    return i2c_write_register(transaction->i2c.address, transaction->i2c.regaddr, transaction->tx_data, transaction->length, transaction->i2c.timeout);
+}
+
+static int16_t read_register(bus_transaction_t *transaction) {
+    return i2c_read_register(transaction->i2c.address, transaction->i2c.regaddr, transaction->rx_data, transaction->length, transaction->i2c.timeout);
+}
+
+static bool submit(bus_transaction_t *transaction, bus_transaction_transfer_t transfer, uint8_t address, uint8_t regaddr, const uint8_t *tx_data, uint8_t *rx_data, uint16_t length, uint16_t timeout, bus_transaction_callback_t callback, void *context) {
+    if (bus_transaction_is_pending(transaction)) {
+        return false;
+    }
+
+    transaction->transfer    = transfer;
+    transaction->i2c.address = address;
+    transaction->i2c.regaddr = regaddr;
+    transaction->i2c.timeout = timeout;
+    transaction->tx_data     = tx_data;
+    transaction->rx_data     = rx_data;
+    transaction->length      = length;
+    return bus_queue_submit(transaction, callback, context);
+}
+
+bool i2c_transmit_async(bus_transaction_t *transaction, uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout, bus_transaction_callback_t callback, void *context) {
+    return submit(transaction, transmit, address, 0, data, NULL, length, timeout, callback, context);
+}
+
+bool i2c_receive_async(bus_transaction_t *transaction, uint8_t address, uint8_t *data, uint16_t length, uint16_t timeout, bus_transaction_callback_t callback, void *context) {
+    return submit(transaction, receive, address, 0, NULL, data, length, timeout, callback, context);
+}
+
+bool i2c_write_register_async(bus_transaction_t *transaction, uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout, bus_transaction_callback_t callback, void *context) {
+    return submit(transaction, write_register, devaddr, regaddr, data, NULL, length, timeout, callback, context);
+}
+
+bool i2c_read_register_async(bus_transaction_t *transaction, uint8_t devaddr, uint8_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout, bus_transaction_callback_t callback, void *context) {
+    return submit(transaction, read_register, devaddr, regaddr, NULL, data, length, timeout, callback, context);
+}
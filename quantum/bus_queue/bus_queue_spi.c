@@ -0,0 +1,44 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bus_queue.h"
+#include "spi_master.h"
+
+static int16_t transmit(bus_transaction_t *transaction) {
+    if (!spi_start_extended((spi_start_config_t *)transaction->spi)) {
+        return SPI_STATUS_ERROR;
+    }
+    spi_status_t status = spi_transmit(transaction->tx_data, transaction->length);
+    spi_stop();
+    return status;
+}
+
+static int16_t receive(bus_transaction_t *transaction) {
+    if (!spi_start_extended((spi_start_config_t *)transaction->spi)) {
+        return SPI_STATUS_ERROR;
+    }
+    spi_status_t status = spi_receive(transaction->rx_data, transaction->length);
+    spi_stop();
+    return status;
+}
+
+static bool submit(bus_transaction_t *transaction, bus_transaction_transfer_t transfer, const spi_start_config_t *config, const uint8_t *tx_data, uint8_t *rx_data, uint16_t length, bus_transaction_callback_t callback, void *context) {
+    if (bus_transaction_is_pending(transaction)) {
+        return false;
+    }
+
+    transaction->transfer = transfer;
+    transaction->spi      = config;
+    transaction->tx_data  = tx_data;
+    transaction->rx_data  = rx_data;
+    transaction->length   = length;
+    return bus_queue_submit(transaction, callback, context);
+}
+
+bool spi_transmit_async(bus_transaction_t *transaction, const spi_start_config_t *config, const uint8_t *data, uint16_t length, bus_transaction_callback_t callback, void *context) {
+    return submit(transaction, transmit, config, data, NULL, length, callback, context);
+}
+
+bool spi_receive_async(bus_transaction_t *transaction, const spi_start_config_t *config, uint8_t *data, uint16_t length, bus_transaction_callback_t callback, void *context) {
+    return submit(transaction, receive, config, NULL, data, length, callback, context);
+}
@@ -0,0 +1,273 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "bus_queue.h"
+#include "i2c_master.h"
+#include "spi_master.h"
+}
+
+namespace {
+
+// Mock bus, recording every transfer in the order it reached the bus
+std::mutex               bus_mutex;
+std::vector<std::string> bus_log;
+uint8_t                  failing_address = 0;
+std::chrono::microseconds transfer_time{0};
+
+int16_t record(const std::string &entry, uint8_t address = 0) {
+    std::this_thread::sleep_for(transfer_time);
+    std::lock_guard<std::mutex> lock(bus_mutex);
+    bus_log.push_back(entry);
+    return address != 0 && address == failing_address ? I2C_STATUS_ERROR : I2C_STATUS_SUCCESS;
+}
+
+std::vector<std::string> bus_transfers() {
+    std::lock_guard<std::mutex> lock(bus_mutex);
+    return bus_log;
+}
+
+// Worker thread standing in for the ChibiOS one
+bool                    use_worker = false;
+std::thread             worker;
+std::mutex              worker_mutex;
+std::condition_variable worker_wake;
+bool                    worker_pending = false;
+bool                    worker_stop    = false;
+
+void worker_main() {
+    std::unique_lock<std::mutex> lock(worker_mutex);
+    while (!worker_stop) {
+        worker_wake.wait(lock, [] { return worker_pending || worker_stop; });
+        worker_pending = false;
+        lock.unlock();
+        while (bus_queue_run_next()) {
+        }
+        lock.lock();
+    }
+}
+
+std::vector<std::string>     completions;
+std::vector<std::thread::id> completion_threads;
+
+void on_complete(bus_transaction_t *transaction) {
+    completions.push_back(std::string(static_cast<const char *>(transaction->context)) + ":" + std::to_string(transaction->status));
+    completion_threads.push_back(std::this_thread::get_id());
+}
+
+} // namespace
+
+extern "C" {
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    return record("i2c tx " + std::to_string(address) + " " + std::to_string(length), address);
+}
+
+i2c_status_t i2c_receive(uint8_t address, uint8_t *data, uint16_t length, uint16_t timeout) {
+    for (uint16_t i = 0; i < length; i++) {
+        data[i] = address + i;
+    }
+    return record("i2c rx " + std::to_string(address) + " " + std::to_string(length), address);
+}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    return record("i2c write " + std::to_string(devaddr) + "@" + std::to_string(regaddr) + " " + std::to_string(length), devaddr);
+}
+
+i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout) {
+    return record("i2c read " + std::to_string(devaddr) + "@" + std::to_string(regaddr) + " " + std::to_string(length), devaddr);
+}
+
+bool spi_start_extended(spi_start_config_t *start_config) {
+    record("spi start " + std::to_string(start_config->slave_pin));
+    return true;
+}
+
+spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    return record("spi tx " + std::to_string(length));
+}
+
+spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    return record("spi rx " + std::to_string(length));
+}
+
+void spi_stop(void) {
+    record("spi stop");
+}
+
+void bus_queue_init_worker(void) {
+    if (use_worker) {
+        worker_stop = false;
+        worker      = std::thread(worker_main);
+    }
+}
+
+bool bus_queue_notify_worker(void) {
+    if (use_worker) {
+        std::lock_guard<std::mutex> lock(worker_mutex);
+        worker_pending = true;
+        worker_wake.notify_one();
+    }
+    return use_worker;
+}
+
+} // extern "C"
+
+class BusQueue : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        bus_log.clear();
+        completions.clear();
+        completion_threads.clear();
+        failing_address = 0;
+        transfer_time   = std::chrono::microseconds(0);
+        bus_queue_init();
+    }
+
+    void TearDown() override {
+        if (worker.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(worker_mutex);
+                worker_stop = true;
+                worker_wake.notify_one();
+            }
+            worker.join();
+        }
+        use_worker = false;
+    }
+};
+
+TEST_F(BusQueue, TransfersInOrderFromTask) {
+    bus_transaction_t t1 = {}, t2 = {}, t3 = {};
+    uint8_t           data[4] = {};
+
+    EXPECT_TRUE(i2c_transmit_async(&t1, 0x10, data, 4, 100, on_complete, (void *)"t1"));
+    EXPECT_TRUE(i2c_write_register_async(&t2, 0x20, 0x40, data, 2, 100, on_complete, (void *)"t2"));
+    EXPECT_TRUE(i2c_receive_async(&t3, 0x30, data, 3, 100, on_complete, (void *)"t3"));
+
+    // nothing reaches the bus before the task runs
+    EXPECT_TRUE(bus_transfers().empty());
+    EXPECT_TRUE(bus_transaction_is_pending(&t1));
+
+    bus_queue_task();
+    EXPECT_EQ(bus_transfers(), (std::vector<std::string>{"i2c tx 16 4", "i2c write 32@64 2", "i2c rx 48 3"}));
+    EXPECT_EQ(completions, (std::vector<std::string>{"t1:0", "t2:0", "t3:0"}));
+    EXPECT_FALSE(bus_transaction_is_pending(&t1));
+    EXPECT_FALSE(bus_transaction_is_pending(&t2));
+    EXPECT_FALSE(bus_transaction_is_pending(&t3));
+    EXPECT_EQ(data[0], 0x30);
+    EXPECT_EQ(data[2], 0x32);
+}
+
+TEST_F(BusQueue, ReportsTransferStatus) {
+    bus_transaction_t good = {}, bad = {};
+    uint8_t           data[2] = {};
+    failing_address           = 0x22;
+
+    EXPECT_TRUE(i2c_read_register_async(&bad, 0x22, 0x01, data, 2, 100, on_complete, (void *)"bad"));
+    EXPECT_TRUE(i2c_read_register_async(&good, 0x11, 0x01, data, 2, 100, on_complete, (void *)"good"));
+
+    EXPECT_EQ(bus_transaction_wait(&bad), I2C_STATUS_ERROR);
+    EXPECT_EQ(bus_transaction_wait(&good), I2C_STATUS_SUCCESS);
+    EXPECT_EQ(completions, (std::vector<std::string>{"bad:-1", "good:0"}));
+}
+
+TEST_F(BusQueue, RejectsPendingTransactionsAndFullQueue) {
+    bus_transaction_t transactions[BUS_QUEUE_SIZE + 1] = {};
+    uint8_t           data                             = 0;
+
+    EXPECT_TRUE(i2c_transmit_async(&transactions[0], 0x10, &data, 1, 100, NULL, NULL));
+    EXPECT_FALSE(i2c_transmit_async(&transactions[0], 0x10, &data, 1, 100, NULL, NULL));
+    for (int i = 1; i < BUS_QUEUE_SIZE; i++) {
+        EXPECT_TRUE(i2c_transmit_async(&transactions[i], 0x10, &data, 1, 100, NULL, NULL));
+    }
+    EXPECT_FALSE(i2c_transmit_async(&transactions[BUS_QUEUE_SIZE], 0x10, &data, 1, 100, NULL, NULL));
+
+    bus_queue_task();
+    EXPECT_EQ(bus_transfers().size(), BUS_QUEUE_SIZE);
+    EXPECT_TRUE(i2c_transmit_async(&transactions[BUS_QUEUE_SIZE], 0x10, &data, 1, 100, NULL, NULL));
+    EXPECT_TRUE(i2c_transmit_async(&transactions[0], 0x10, &data, 1, 100, NULL, NULL));
+}
+
+TEST_F(BusQueue, CallbackCanSubmitAgain) {
+    static bus_transaction_t transaction = {};
+    static uint8_t           data[8]     = {};
+    static int               remaining   = 3;
+
+    auto again = [](bus_transaction_t *t) {
+        completions.push_back("again");
+        if (--remaining > 0) {
+            EXPECT_TRUE(i2c_transmit_async(t, 0x10, data, sizeof(data), 100, t->callback, NULL));
+        }
+    };
+
+    EXPECT_TRUE(i2c_transmit_async(&transaction, 0x10, data, sizeof(data), 100, again, NULL));
+    bus_queue_task();
+    EXPECT_EQ(bus_transfers().size(), 1u);
+    bus_queue_task();
+    bus_queue_task();
+    bus_queue_task();
+    EXPECT_EQ(bus_transfers().size(), 3u);
+    EXPECT_EQ(completions.size(), 3u);
+    EXPECT_FALSE(bus_transaction_is_pending(&transaction));
+}
+
+TEST_F(BusQueue, SpiTransactionsSelectTheDevice) {
+    spi_start_config_t config = {};
+    config.slave_pin          = 7;
+    bus_transaction_t tx = {}, rx = {};
+    uint8_t           data[5] = {};
+
+    EXPECT_TRUE(spi_transmit_async(&tx, &config, data, 5, on_complete, (void *)"tx"));
+    EXPECT_TRUE(spi_receive_async(&rx, &config, data, 2, on_complete, (void *)"rx"));
+    bus_transaction_wait(&rx);
+
+    EXPECT_EQ(bus_transfers(), (std::vector<std::string>{"spi start 7", "spi tx 5", "spi stop", "spi start 7", "spi rx 2", "spi stop"}));
+    EXPECT_EQ(completions, (std::vector<std::string>{"tx:0", "rx:0"}));
+}
+
+TEST_F(BusQueue, WorkerOverlapsMainLoop) {
+    use_worker = true;
+    bus_queue_init();
+    transfer_time = std::chrono::microseconds(2000);
+
+    const int         count = 8;
+    bus_transaction_t transactions[count] = {};
+    uint8_t           data[count]         = {};
+    const char       *names[count]        = {"0", "1", "2", "3", "4", "5", "6", "7"};
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++) {
+        EXPECT_TRUE(i2c_transmit_async(&transactions[i], 0x10 + i, &data[i], 1, 100, on_complete, (void *)names[i]));
+    }
+    // the main loop keeps going while the worker is busy with the bus
+    int scans = 0;
+    while (bus_transaction_is_pending(&transactions[count - 1])) {
+        bus_queue_task();
+        scans++;
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_GT(scans, count);
+    EXPECT_GE(elapsed, transfer_time * count);
+    std::vector<std::string> expected_transfers, expected_completions;
+    for (int i = 0; i < count; i++) {
+        expected_transfers.push_back("i2c tx " + std::to_string(0x10 + i) + " 1");
+        expected_completions.push_back(std::string(names[i]) + ":0");
+    }
+    EXPECT_EQ(bus_transfers(), expected_transfers);
+    EXPECT_EQ(completions, expected_completions);
+    // callbacks are only invoked from the main loop
+    for (auto id : completion_threads) {
+        EXPECT_EQ(id, std::this_thread::get_id());
+    }
+}
@@ -0,0 +1,8 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+
+// The test platform has no GPIO, SPI devices are identified by a plain number
+typedef uint8_t pin_t;
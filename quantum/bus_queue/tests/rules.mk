@@ -0,0 +1,10 @@
+bus_queue_CONFIG := $(QUANTUM_PATH)/bus_queue/tests/config_mock.h
+
+bus_queue_SRC := \
+    $(QUANTUM_PATH)/bus_queue/tests/bus_queue_tests.cpp \
+    $(QUANTUM_PATH)/bus_queue/bus_queue.c \
+    $(QUANTUM_PATH)/bus_queue/bus_queue_i2c.c \
+    $(QUANTUM_PATH)/bus_queue/bus_queue_spi.c
+
+bus_queue_INC := \
+    $(QUANTUM_PATH)/bus_queue
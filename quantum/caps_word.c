@@ -15,6 +15,7 @@
 #include <stdint.h>
 #include "caps_word.h"
 #include "timer.h"
+#include "deadline.h"
 #include "action.h"
 #include "action_util.h"
 
@@ -32,13 +33,16 @@ static bool caps_word_active = false;
 static uint16_t idle_timer = 0;
 
 void caps_word_task(void) {
-    if (caps_word_active && timer_expired(timer_read(), idle_timer)) {
+    if (!caps_word_active) {
+        deadline_clear(DEADLINE_CAPS_WORD);
+    } else if (timer_expired(timer_read(), idle_timer)) {
         caps_word_off();
     }
 }
 
 void caps_word_reset_idle_timer(void) {
     idle_timer = timer_read() + CAPS_WORD_IDLE_TIMEOUT;
+    deadline_set(DEADLINE_CAPS_WORD, CAPS_WORD_IDLE_TIMEOUT);
 }
 #else
 void caps_word_task(void) {}
@@ -108,3 +108,42 @@ rgb_t hsv_to_rgb(hsv_t hsv) {
 rgb_t hsv_to_rgb_nocie(hsv_t hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
+
+// Which of v, p, q and t each channel takes in every region of the hue, two bits per channel
+#define HSV_REGION(r, g, b) ((r) << 4 | (g) << 2 | (b))
+static const uint8_t hsv_regions[7] = {
+    HSV_REGION(0, 3, 1), // v, t, p
+    HSV_REGION(2, 0, 1), // q, v, p
+    HSV_REGION(1, 0, 3), // p, v, t
+    HSV_REGION(1, 2, 0), // p, q, v
+    HSV_REGION(3, 1, 0), // t, p, v
+    HSV_REGION(0, 1, 2), // v, p, q
+    HSV_REGION(0, 3, 1), // v, t, p
+};
+
+void hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count, uint8_t brightness) {
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t h = hsv[i].h;
+        uint16_t s = hsv[i].s;
+        uint16_t v = (hsv[i].v * (brightness + 1)) >> 8;
+#ifdef USE_CIE1931_CURVE
+        v = pgm_read_byte(&CIE1931_CURVE[v]);
+#endif
+
+        uint8_t region    = h * 6 / 255;
+        uint8_t remainder = (h * 2 - region * 85) * 3;
+
+        // Without saturation, every channel is v
+        uint8_t grey = -(uint8_t)(s == 0);
+        uint8_t channels[4];
+        channels[0] = v;
+        channels[1] = (((v * (255 - s)) >> 8) & ~grey) | (v & grey);
+        channels[2] = (((v * (255 - ((s * remainder) >> 8))) >> 8) & ~grey) | (v & grey);
+        channels[3] = (((v * (255 - ((s * (255 - remainder)) >> 8))) >> 8) & ~grey) | (v & grey);
+
+        uint8_t order = hsv_regions[region];
+        rgb[i].r      = channels[order >> 4];
+        rgb[i].g      = channels[(order >> 2) & 3];
+        rgb[i].b      = channels[order & 3];
+    }
+}
@@ -95,3 +95,11 @@ typedef hsv_t HSV;
 
 rgb_t hsv_to_rgb(hsv_t hsv);
 rgb_t hsv_to_rgb_nocie(hsv_t hsv);
+
+/**
+ * @brief Converts several colors at once, without branching on the hue.
+ *
+ * Gives the same results as hsv_to_rgb(), after scaling the value of each color
+ * by (brightness + 1) / 256, so a brightness of 255 leaves the colors as they are.
+ */
+void hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count, uint8_t brightness);
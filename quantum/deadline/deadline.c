@@ -0,0 +1,49 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "deadline.h"
+#include "timer.h"
+
+_Static_assert(DEADLINE_COUNT <= 16, "Too many deadlines for the armed mask");
+
+static uint16_t armed = 0;
+static uint32_t due[DEADLINE_COUNT];
+
+void deadline_set(deadline_id_t id, uint32_t delay_ms) {
+    due[id] = timer_read32() + delay_ms;
+    armed |= (uint16_t)1 << id;
+}
+
+void deadline_clear(deadline_id_t id) {
+    armed &= ~((uint16_t)1 << id);
+}
+
+bool deadline_expired(deadline_id_t id) {
+    if (!(armed & ((uint16_t)1 << id))) {
+        return false;
+    }
+    return timer_expired32(timer_read32(), due[id]);
+}
+
+bool deadline_any_armed(void) {
+    return armed != 0;
+}
+
+bool deadline_next(uint32_t *remaining_ms) {
+    if (!armed) {
+        return false;
+    }
+
+    uint32_t now      = timer_read32();
+    int32_t  earliest = INT32_MAX;
+    for (uint8_t id = 0; id < DEADLINE_COUNT; id++) {
+        if (armed & ((uint16_t)1 << id)) {
+            int32_t remaining = (int32_t)TIMER_DIFF_32(due[id], now);
+            if (remaining < earliest) {
+                earliest = remaining;
+            }
+        }
+    }
+    *remaining_ms = earliest > 0 ? (uint32_t)earliest : 0;
+    return true;
+}
@@ -0,0 +1,65 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Tracks when each of the features run by quantum_task() next has something
+    to do, so the main loop only invokes the ones that are due.
+
+    A feature arms its deadline whenever it starts a timeout. Once the
+    deadline has passed, its task is invoked on every loop, exactly as if it
+    was polled, until the task finds nothing is pending anymore and clears
+    the deadline. Arming a deadline too early is therefore harmless, it only
+    costs the task calls until the feature's own timer has expired.
+*/
+
+typedef enum {
+    DEADLINE_KEY_OVERRIDE,
+    DEADLINE_SEQUENCER,
+    DEADLINE_TAP_DANCE,
+    DEADLINE_COMBO,
+    DEADLINE_LEADER,
+    DEADLINE_WPM,
+    DEADLINE_AUTO_SHIFT,
+    DEADLINE_CAPS_WORD,
+    DEADLINE_SECURE,
+    DEADLINE_LAYER_LOCK,
+    DEADLINE_COUNT,
+} deadline_id_t;
+
+/**
+ * @brief Arms a deadline, replacing the previous one.
+ *
+ * @param id the feature the deadline belongs to
+ * @param delay_ms time from now until the task has to run, 0 to run it on the next loop
+ */
+void deadline_set(deadline_id_t id, uint32_t delay_ms);
+
+/**
+ * @brief Disarms a deadline, once the feature has nothing pending anymore.
+ */
+void deadline_clear(deadline_id_t id);
+
+/**
+ * @brief Checks whether the task of a feature has to run.
+ *
+ * Only reads the timer if the deadline is armed.
+ */
+bool deadline_expired(deadline_id_t id);
+
+/**
+ * @brief Whether any deadline is armed.
+ */
+bool deadline_any_armed(void);
+
+/**
+ * @brief Time until the earliest armed deadline.
+ *
+ * @param[out] remaining_ms time left, 0 if a deadline has already passed
+ * @return false if no deadline is armed
+ */
+bool deadline_next(uint32_t *remaining_ms);
@@ -0,0 +1,90 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "deadline.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+class Deadline : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        for (uint8_t id = 0; id < DEADLINE_COUNT; id++) {
+            deadline_clear((deadline_id_t)id);
+        }
+    }
+};
+
+TEST_F(Deadline, NothingIsDueWhenIdle) {
+    uint32_t remaining;
+    EXPECT_FALSE(deadline_any_armed());
+    EXPECT_FALSE(deadline_next(&remaining));
+    for (uint8_t id = 0; id < DEADLINE_COUNT; id++) {
+        EXPECT_FALSE(deadline_expired((deadline_id_t)id));
+    }
+}
+
+TEST_F(Deadline, ExpiresAfterDelay) {
+    deadline_set(DEADLINE_TAP_DANCE, 200);
+    EXPECT_TRUE(deadline_any_armed());
+
+    advance_time(199);
+    EXPECT_FALSE(deadline_expired(DEADLINE_TAP_DANCE));
+    advance_time(1);
+    EXPECT_TRUE(deadline_expired(DEADLINE_TAP_DANCE));
+    EXPECT_FALSE(deadline_expired(DEADLINE_COMBO));
+}
+
+TEST_F(Deadline, StaysDueUntilCleared) {
+    deadline_set(DEADLINE_COMBO, 0);
+    EXPECT_TRUE(deadline_expired(DEADLINE_COMBO));
+    advance_time(1000);
+    EXPECT_TRUE(deadline_expired(DEADLINE_COMBO));
+
+    deadline_clear(DEADLINE_COMBO);
+    EXPECT_FALSE(deadline_expired(DEADLINE_COMBO));
+    EXPECT_FALSE(deadline_any_armed());
+}
+
+TEST_F(Deadline, SettingAgainReplacesTheDeadline) {
+    deadline_set(DEADLINE_LEADER, 100);
+    advance_time(90);
+    deadline_set(DEADLINE_LEADER, 100);
+    advance_time(90);
+    EXPECT_FALSE(deadline_expired(DEADLINE_LEADER));
+    advance_time(10);
+    EXPECT_TRUE(deadline_expired(DEADLINE_LEADER));
+}
+
+TEST_F(Deadline, NextReportsTheEarliest) {
+    uint32_t remaining;
+    deadline_set(DEADLINE_SECURE, 5000);
+    deadline_set(DEADLINE_CAPS_WORD, 300);
+    deadline_set(DEADLINE_LAYER_LOCK, 1000);
+
+    ASSERT_TRUE(deadline_next(&remaining));
+    EXPECT_EQ(remaining, 300u);
+
+    advance_time(400);
+    ASSERT_TRUE(deadline_next(&remaining));
+    EXPECT_EQ(remaining, 0u);
+
+    deadline_clear(DEADLINE_CAPS_WORD);
+    ASSERT_TRUE(deadline_next(&remaining));
+    EXPECT_EQ(remaining, 600u);
+}
+
+TEST_F(Deadline, HandlesTimerWraparound) {
+    set_time(UINT32_MAX - 50);
+    deadline_set(DEADLINE_KEY_OVERRIDE, 100);
+    advance_time(99);
+    EXPECT_FALSE(deadline_expired(DEADLINE_KEY_OVERRIDE));
+    advance_time(1);
+    EXPECT_TRUE(deadline_expired(DEADLINE_KEY_OVERRIDE));
+}
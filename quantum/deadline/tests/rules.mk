@@ -0,0 +1,8 @@
+deadline_SRC := \
+    $(QUANTUM_PATH)/deadline/tests/deadline_tests.cpp \
+    $(QUANTUM_PATH)/deadline/deadline.c \
+    $(PLATFORM_PATH)/timer.c \
+    $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+deadline_INC := \
+    $(QUANTUM_PATH)/deadline
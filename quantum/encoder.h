@@ -21,6 +21,7 @@
 #include <stdbool.h>
 #include "gpio.h"
 #include "util.h"
+#include "spsc_ring.h"
 
 // ======== DEPRECATED DEFINES - DO NOT USE ========
 #ifdef ENCODERS_PAD_A
@@ -91,12 +92,12 @@ typedef struct encoder_event_t {
     uint8_t clockwise : 1;
 } encoder_event_t;
 
+SPSC_RING_DECLARE(encoder_event_ring, encoder_event_t, SPSC_RING_ROUND_UP(MAX_QUEUED_ENCODER_EVENTS))
+
 typedef struct encoder_events_t {
-    uint8_t         enqueued;
-    uint8_t         dequeued;
-    uint8_t         head;
-    uint8_t         tail;
-    encoder_event_t queue[MAX_QUEUED_ENCODER_EVENTS];
+    uint8_t              enqueued;
+    uint8_t              dequeued;
+    encoder_event_ring_t ring;
 } encoder_events_t;
 
 // Get the current queued events
@@ -0,0 +1,180 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "expander_matrix.h"
+#include "i2c_master.h"
+#include "timer.h"
+#include "debug.h"
+
+#if defined(EXPANDER_MATRIX_MCP23018)
+#    include "mcp23018.h"
+#    define expander_set_config(a, b) (mcp23018_set_config(EXPANDER_MATRIX_ADDRESS, mcp23018_PORTA, a) && mcp23018_set_config(EXPANDER_MATRIX_ADDRESS, mcp23018_PORTB, b))
+#    define expander_set_interrupt(a, b) mcp23018_set_interrupt_all(EXPANDER_MATRIX_ADDRESS, a, b)
+#    define expander_set_output(a, b) mcp23018_set_output_all(EXPANDER_MATRIX_ADDRESS, a, b)
+#    define expander_read_pins(out) mcp23018_read_pins_all(EXPANDER_MATRIX_ADDRESS, out)
+#elif defined(EXPANDER_MATRIX_PCA9555)
+#    include "pca9555.h"
+#    define expander_set_config(a, b) (pca9555_set_config(EXPANDER_MATRIX_ADDRESS, PCA9555_PORT0, a) && pca9555_set_config(EXPANDER_MATRIX_ADDRESS, PCA9555_PORT1, b))
+// Every input raises the interrupt when it changes
+#    define expander_set_interrupt(a, b) true
+#    define expander_set_output(a, b) pca9555_set_output_all(EXPANDER_MATRIX_ADDRESS, a, b)
+#    define expander_read_pins(out) pca9555_read_pins_all(EXPANDER_MATRIX_ADDRESS, out)
+#else
+#    error "Invalid EXPANDER_MATRIX_DRIVER"
+#endif
+
+#ifdef BUS_QUEUE_ENABLE
+#    include "bus_queue.h"
+#endif
+
+static const uint8_t row_pins[] = EXPANDER_MATRIX_ROW_PINS;
+static const uint8_t col_pins[] = EXPANDER_MATRIX_COL_PINS;
+
+_Static_assert(sizeof(col_pins) <= MATRIX_COLS, "EXPANDER_MATRIX_COL_PINS has more pins than MATRIX_COLS");
+
+static uint16_t row_mask;
+static uint16_t col_mask;
+
+// Written by the scan, which may run on the bus worker
+static uint16_t scan_pins[EXPANDER_MATRIX_ROWS];
+static bool     scan_idle;
+
+// The result of the last completed scan
+static matrix_row_t rows[EXPANDER_MATRIX_ROWS];
+static bool         initialized;
+static uint32_t     retry_timer;
+
+#ifdef BUS_QUEUE_ENABLE
+static bus_transaction_t scan_transaction;
+#endif
+
+static inline bool expander_select(uint16_t selected) {
+    // Rows are active low, the output latch of the column pins is ignored
+    uint16_t output = ~selected;
+    return expander_set_output(output & 0xFF, output >> 8);
+}
+
+static bool expander_matrix_init_pins(void) {
+    uint16_t inputs = ~row_mask;
+    return expander_set_config(inputs & 0xFF, inputs >> 8) && expander_select(0) && expander_set_interrupt(col_mask & 0xFF, col_mask >> 8);
+}
+
+/**
+ * \brief Reads every row of the expander, leaving them all selected if no key is pressed.
+ *
+ * The I2C transfer selecting a row takes far longer than MATRIX_IO_DELAY, so its pins are read right away.
+ */
+static bool expander_matrix_read(void) {
+    uint16_t pressed = 0;
+    for (uint8_t row = 0; row < EXPANDER_MATRIX_ROWS; row++) {
+        if (!expander_select((uint16_t)1 << row_pins[row]) || !expander_read_pins(&scan_pins[row])) {
+            return false;
+        }
+        pressed |= ~scan_pins[row] & col_mask;
+    }
+
+    scan_idle = false;
+#ifdef EXPANDER_MATRIX_INT_PIN
+    if (!pressed) {
+        // With every row selected, any key press changes a column and raises the interrupt. Reading the pins clears it.
+        uint16_t pins;
+        if (!expander_select(row_mask) || !expander_read_pins(&pins)) {
+            return false;
+        }
+        scan_idle = (~pins & col_mask) == 0;
+    }
+#endif
+    return true;
+}
+
+static void expander_matrix_finish(bool success) {
+    if (!success) {
+        dprintf("expander_matrix: scan failed, retrying in %ums\n", EXPANDER_MATRIX_RETRY_INTERVAL);
+        initialized = false;
+        scan_idle   = false;
+        retry_timer = timer_read32();
+        memset(rows, 0, sizeof(rows));
+        return;
+    }
+
+    for (uint8_t row = 0; row < EXPANDER_MATRIX_ROWS; row++) {
+        matrix_row_t row_value   = 0;
+        matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+        for (uint8_t col = 0; col < sizeof(col_pins); col++, row_shifter <<= 1) {
+            row_value |= (scan_pins[row] & ((uint16_t)1 << col_pins[col])) ? 0 : row_shifter;
+        }
+        rows[row] = row_value;
+    }
+}
+
+/**
+ * \brief Whether the expander has to be scanned, bringing it back up after a failure.
+ */
+static bool expander_matrix_needs_scan(void) {
+    if (!initialized) {
+        if (timer_elapsed32(retry_timer) < EXPANDER_MATRIX_RETRY_INTERVAL) {
+            return false;
+        }
+        retry_timer = timer_read32();
+        initialized = expander_matrix_init_pins();
+        if (!initialized) {
+            return false;
+        }
+    }
+
+#ifdef EXPANDER_MATRIX_INT_PIN
+    // No key was pressed at the last scan, and the columns have not changed since
+    if (scan_idle && gpio_read_pin(EXPANDER_MATRIX_INT_PIN)) {
+        return false;
+    }
+#endif
+    return true;
+}
+
+#ifdef BUS_QUEUE_ENABLE
+static int16_t expander_matrix_transfer(bus_transaction_t *transaction) {
+    return expander_matrix_read() ? I2C_STATUS_SUCCESS : I2C_STATUS_ERROR;
+}
+
+static void expander_matrix_complete(bus_transaction_t *transaction) {
+    expander_matrix_finish(transaction->status == I2C_STATUS_SUCCESS);
+}
+#endif
+
+void expander_matrix_init(void) {
+    row_mask = 0;
+    for (uint8_t row = 0; row < EXPANDER_MATRIX_ROWS; row++) {
+        row_mask |= (uint16_t)1 << row_pins[row];
+    }
+    col_mask = 0;
+    for (uint8_t col = 0; col < sizeof(col_pins); col++) {
+        col_mask |= (uint16_t)1 << col_pins[col];
+    }
+
+#ifdef EXPANDER_MATRIX_INT_PIN
+    gpio_set_pin_input_high(EXPANDER_MATRIX_INT_PIN);
+#endif
+    i2c_init();
+
+    memset(rows, 0, sizeof(rows));
+    scan_idle   = false;
+    initialized = expander_matrix_init_pins();
+    retry_timer = timer_read32();
+}
+
+void expander_matrix_scan(matrix_row_t current_rows[]) {
+#ifdef BUS_QUEUE_ENABLE
+    // Start the next scan as soon as the previous one has been picked up, its result is used by the next matrix scan
+    if (!bus_transaction_is_pending(&scan_transaction) && expander_matrix_needs_scan()) {
+        scan_transaction.transfer = expander_matrix_transfer;
+        bus_queue_submit(&scan_transaction, expander_matrix_complete, NULL);
+    }
+#else
+    if (expander_matrix_needs_scan()) {
+        expander_matrix_finish(expander_matrix_read());
+    }
+#endif
+
+    memcpy(current_rows, rows, sizeof(rows));
+}
@@ -0,0 +1,57 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "matrix.h"
+
+/**
+ * \file
+ *
+ * \defgroup expander_matrix I/O Expander Matrix
+ *
+ * \brief Scans matrix rows wired to an MCP23018 or PCA9555 I2C I/O expander.
+ *
+ * Each row is selected by writing both output ports at once, and its columns are fetched with a single sequential
+ * read of both input ports. The expander rows follow the rows wired to MCU pins, and are scanned along with them by
+ * the standard matrix.
+ *
+ * When the bus transaction queue is enabled, the expander is scanned by the bus worker while the main loop scans the
+ * MCU rows and processes the previous result. When the expander's interrupt output is wired to `EXPANDER_MATRIX_INT_PIN`,
+ * all rows are left selected while no key is pressed, and the expander is only scanned once the interrupt signals a
+ * change.
+ * \{
+ */
+
+#ifndef EXPANDER_MATRIX_ADDRESS
+#    define EXPANDER_MATRIX_ADDRESS 0x20
+#endif
+
+#if !defined(EXPANDER_MATRIX_ROW_PINS) || !defined(EXPANDER_MATRIX_COL_PINS)
+#    error "EXPANDER_MATRIX_ROW_PINS and EXPANDER_MATRIX_COL_PINS must list the expander pins, 0-7 for port A and 8-15 for port B"
+#endif
+
+#ifndef EXPANDER_MATRIX_RETRY_INTERVAL
+#    define EXPANDER_MATRIX_RETRY_INTERVAL 5000
+#endif
+
+/**
+ * \brief The number of rows wired to the expander.
+ */
+#define EXPANDER_MATRIX_ROWS (sizeof((const uint8_t[])EXPANDER_MATRIX_ROW_PINS))
+
+/**
+ * \brief Sets up the expander pins. Failures are retried from expander_matrix_scan().
+ */
+void expander_matrix_init(void);
+
+/**
+ * \brief Fills in the state of the expander rows.
+ *
+ * \param current_rows The first of EXPANDER_MATRIX_ROWS rows to fill in.
+ */
+void expander_matrix_scan(matrix_row_t current_rows[]);
+
+/** \} */
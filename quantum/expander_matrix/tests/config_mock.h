@@ -0,0 +1,33 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 6
+
+#define EXPANDER_MATRIX_ADDRESS 0x20
+// Rows on port B, columns on port A except for the last one
+#define EXPANDER_MATRIX_ROW_PINS \
+    { 8, 9, 10, 11 }
+#define EXPANDER_MATRIX_COL_PINS \
+    { 0, 1, 2, 3, 4, 15 }
+#define EXPANDER_MATRIX_INT_PIN 3
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint8_t pin_t;
+
+#define gpio_set_pin_input_high(pin) mock_set_pin_input_high(pin)
+#define gpio_read_pin(pin) mock_read_pin(pin)
+
+void mock_set_pin_input_high(pin_t pin);
+bool mock_read_pin(pin_t pin);
+
+#ifdef __cplusplus
+};
+#endif
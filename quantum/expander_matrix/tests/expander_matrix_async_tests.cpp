@@ -0,0 +1,86 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mock_expander.hpp"
+
+extern "C" {
+#include "expander_matrix.h"
+#include "bus_queue.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+namespace {
+
+const uint8_t ROWS = 4;
+
+// Pin numbers from config_mock.h
+const uint8_t ROW_PINS[ROWS] = {8, 9, 10, 11};
+const uint8_t COL_PINS[]     = {0, 1, 2, 3, 4, 15};
+
+} // namespace
+
+class ExpanderMatrixAsync : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        expander().reset();
+        bus_queue_init();
+        expander_matrix_init();
+        expander().transactions = 0;
+    }
+
+    MockExpander &expander() {
+        return MockExpander::instance();
+    }
+
+    void press(uint8_t row, uint8_t col) {
+        expander().press(ROW_PINS[row], COL_PINS[col]);
+    }
+
+    // One pass of the main loop: the matrix scan, followed by the bus queue task
+    uint32_t loop() {
+        uint32_t before = expander().transactions;
+        expander_matrix_scan(rows);
+        // The scan is only queued, the bus is not touched by the matrix scan itself
+        EXPECT_EQ(expander().transactions, before);
+        bus_queue_task();
+        return expander().transactions - before;
+    }
+
+    matrix_row_t rows[ROWS] = {};
+};
+
+TEST_F(ExpanderMatrixAsync, ResultIsPickedUpByTheNextScan) {
+    press(1, 5);
+
+    EXPECT_EQ(loop(), 2u * ROWS);
+    EXPECT_EQ(rows[1], 0);
+
+    EXPECT_EQ(loop(), 2u * ROWS);
+    EXPECT_EQ(rows[1], 1 << 5);
+}
+
+TEST_F(ExpanderMatrixAsync, SkipsScansUntilInterrupt) {
+    EXPECT_EQ(loop(), 2u * ROWS + 2);
+    EXPECT_EQ(loop(), 0u);
+
+    press(3, 0);
+    EXPECT_EQ(loop(), 2u * ROWS);
+    EXPECT_EQ(loop(), 2u * ROWS);
+    EXPECT_EQ(rows[3], 1 << 0);
+}
+
+TEST_F(ExpanderMatrixAsync, DoesNotQueueAnotherScanWhilePending) {
+    press(0, 0);
+    expander_matrix_scan(rows);
+    expander_matrix_scan(rows);
+    expander_matrix_scan(rows);
+    EXPECT_EQ(expander().transactions, 0u);
+
+    bus_queue_task();
+    EXPECT_EQ(expander().transactions, 2u * ROWS);
+}
@@ -0,0 +1,138 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mock_expander.hpp"
+
+extern "C" {
+#include "expander_matrix.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+namespace {
+
+const uint8_t ROWS = 4;
+
+// Pin numbers from config_mock.h
+const uint8_t ROW_PINS[ROWS] = {8, 9, 10, 11};
+const uint8_t COL_PINS[]     = {0, 1, 2, 3, 4, 15};
+
+} // namespace
+
+class ExpanderMatrix : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        expander().reset();
+        expander_matrix_init();
+        expander().transactions = 0;
+    }
+
+    MockExpander &expander() {
+        return MockExpander::instance();
+    }
+
+    void press(uint8_t row, uint8_t col) {
+        expander().press(ROW_PINS[row], COL_PINS[col]);
+    }
+
+    void release(uint8_t row, uint8_t col) {
+        expander().release(ROW_PINS[row], COL_PINS[col]);
+    }
+
+    uint32_t scan() {
+        uint32_t before = expander().transactions;
+        expander_matrix_scan(rows);
+        return expander().transactions - before;
+    }
+
+    matrix_row_t rows[ROWS] = {};
+};
+
+TEST_F(ExpanderMatrix, ConfiguresRowsAsOutputsAndColumnsForInterrupts) {
+    // IODIR and GPPU: everything but the rows is a pulled up input
+    EXPECT_EQ(expander().reg(0x00), 0xFF);
+    EXPECT_EQ(expander().reg(0x01), 0xF0);
+    EXPECT_EQ(expander().reg(0x0C), 0xFF);
+    EXPECT_EQ(expander().reg(0x0D), 0xF0);
+    // GPINTEN on the columns, IOCON with mirrored open-drain interrupts
+    EXPECT_EQ(expander().reg(0x04), 0x1F);
+    EXPECT_EQ(expander().reg(0x05), 0x80);
+    EXPECT_EQ(expander().reg(0x0A), 0x44);
+}
+
+TEST_F(ExpanderMatrix, ReadsPressedKeys) {
+    press(1, 2);
+    press(3, 5);
+    scan();
+
+    EXPECT_EQ(rows[0], 0);
+    EXPECT_EQ(rows[1], 1 << 2);
+    EXPECT_EQ(rows[2], 0);
+    EXPECT_EQ(rows[3], 1 << 5);
+
+    release(3, 5);
+    scan();
+    EXPECT_EQ(rows[1], 1 << 2);
+    EXPECT_EQ(rows[3], 0);
+}
+
+TEST_F(ExpanderMatrix, SelectsAndReadsEachRowInOneTransactionEach) {
+    press(0, 0);
+    // A row select writes both ports, the columns of both ports are fetched by one sequential read
+    EXPECT_EQ(scan(), 2u * ROWS);
+    EXPECT_EQ(scan(), 2u * ROWS);
+}
+
+TEST_F(ExpanderMatrix, SkipsScansUntilInterrupt) {
+    // Nothing pressed, so all rows are left selected
+    EXPECT_EQ(scan(), 2u * ROWS + 2);
+    EXPECT_EQ(scan(), 0u);
+    EXPECT_EQ(scan(), 0u);
+
+    press(2, 4);
+    EXPECT_FALSE(expander().int_pin());
+    EXPECT_EQ(scan(), 2u * ROWS);
+    EXPECT_EQ(rows[2], 1 << 4);
+
+    // Held keys have to be scanned, to see them released
+    EXPECT_EQ(scan(), 2u * ROWS);
+    release(2, 4);
+    EXPECT_EQ(scan(), 2u * ROWS + 2);
+    EXPECT_EQ(rows[2], 0);
+    EXPECT_EQ(scan(), 0u);
+}
+
+TEST_F(ExpanderMatrix, KeyPressedWhileArmingIsNotMissed) {
+    press(0, 1);
+    scan();
+    release(0, 1);
+    scan();
+    EXPECT_EQ(scan(), 0u);
+
+    // Pressed and released before the next scan, the interrupt stays latched
+    press(1, 1);
+    release(1, 1);
+    EXPECT_EQ(scan(), 2u * ROWS + 2);
+    EXPECT_EQ(scan(), 0u);
+}
+
+TEST_F(ExpanderMatrix, RetriesAfterBusFailure) {
+    press(1, 1);
+    scan();
+    EXPECT_EQ(rows[1], 1 << 1);
+
+    expander().nack = true;
+    scan();
+    EXPECT_EQ(rows[1], 0);
+
+    // Left alone until the retry interval has passed
+    expander().nack = false;
+    EXPECT_EQ(scan(), 0u);
+    advance_time(EXPANDER_MATRIX_RETRY_INTERVAL);
+    EXPECT_GT(scan(), 2u * ROWS);
+    EXPECT_EQ(rows[1], 1 << 1);
+}
@@ -0,0 +1,130 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "mock_expander.hpp"
+
+extern "C" {
+#include "i2c_master.h"
+}
+
+namespace {
+
+enum {
+    IODIRA   = 0x00,
+    GPINTENA = 0x04,
+    GPIOA    = 0x12,
+    OLATA    = 0x14,
+};
+
+const uint8_t ADDRESS = 0x20;
+
+uint16_t pair(const uint8_t *regs, uint8_t address) {
+    return regs[address] | regs[address + 1] << 8;
+}
+
+} // namespace
+
+MockExpander &MockExpander::instance() {
+    static MockExpander expander;
+    return expander;
+}
+
+void MockExpander::reset() {
+    *this = MockExpander();
+    // Every pin is an input at power on
+    regs[IODIRA]     = 0xFF;
+    regs[IODIRA + 1] = 0xFF;
+}
+
+void MockExpander::press(uint8_t row_pin, uint8_t col_pin) {
+    keys[row_pin][col_pin] = true;
+    update_interrupt();
+}
+
+void MockExpander::release(uint8_t row_pin, uint8_t col_pin) {
+    keys[row_pin][col_pin] = false;
+    update_interrupt();
+}
+
+uint16_t MockExpander::pins() const {
+    uint16_t inputs = pair(regs, IODIRA);
+    uint16_t latch  = pair(regs, OLATA);
+    // Pulled up, unless a pressed key connects the pin to a row driven low
+    uint16_t state = 0xFFFF;
+    for (uint8_t row = 0; row < 16; row++) {
+        if ((inputs & (1 << row)) || (latch & (1 << row))) {
+            continue;
+        }
+        state &= ~(1 << row);
+        for (uint8_t col = 0; col < 16; col++) {
+            if (keys[row][col] && (inputs & (1 << col))) {
+                state &= ~(1 << col);
+            }
+        }
+    }
+    return state;
+}
+
+void MockExpander::update_interrupt() {
+    if ((pins() ^ captured) & pair(regs, GPINTENA)) {
+        interrupt = true;
+    }
+}
+
+int16_t MockExpander::write(uint8_t address, uint8_t regaddr, const uint8_t *data, uint16_t length) {
+    transactions++;
+    if (nack || address != ADDRESS << 1) {
+        return I2C_STATUS_ERROR;
+    }
+    for (uint16_t i = 0; i < length; i++) {
+        uint8_t target = regaddr + i;
+        // Writing GPIO modifies OLAT
+        if (target == GPIOA || target == GPIOA + 1) {
+            target += OLATA - GPIOA;
+        }
+        regs[target] = data[i];
+    }
+    update_interrupt();
+    return I2C_STATUS_SUCCESS;
+}
+
+int16_t MockExpander::read(uint8_t address, uint8_t regaddr, uint8_t *data, uint16_t length) {
+    transactions++;
+    if (nack || address != ADDRESS << 1) {
+        return I2C_STATUS_ERROR;
+    }
+    for (uint16_t i = 0; i < length; i++) {
+        uint8_t target = regaddr + i;
+        if (target == GPIOA || target == GPIOA + 1) {
+            data[i] = pins() >> (8 * (target - GPIOA));
+        } else {
+            data[i] = regs[target];
+        }
+    }
+    // Reading GPIO clears the interrupt
+    if (regaddr == GPIOA || regaddr == GPIOA + 1) {
+        captured  = pins();
+        interrupt = false;
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+extern "C" {
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    return MockExpander::instance().write(devaddr, regaddr, data, length);
+}
+
+i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout) {
+    return MockExpander::instance().read(devaddr, regaddr, data, length);
+}
+
+void mock_set_pin_input_high(pin_t pin) {}
+
+bool mock_read_pin(pin_t pin) {
+    return pin == EXPANDER_MATRIX_INT_PIN ? MockExpander::instance().int_pin() : true;
+}
+
+} // extern "C"
@@ -0,0 +1,47 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * An MCP23018 on the I2C bus, wired to a matrix of keys between its pins.
+ *
+ * Keys connect a row pin to a column pin through a diode, so a pressed key pulls its column low while its row is
+ * driven low. Interrupt-on-change is latched on the enabled pins and cleared by reading GPIO, as on the device.
+ */
+class MockExpander {
+   public:
+    static MockExpander &instance();
+
+    void reset();
+
+    void press(uint8_t row_pin, uint8_t col_pin);
+    void release(uint8_t row_pin, uint8_t col_pin);
+
+    uint16_t pins() const;
+    uint8_t  reg(uint8_t address) const {
+        return regs[address];
+    }
+
+    // MCU side of the open-drain interrupt output, high while inactive
+    bool int_pin() const {
+        return !interrupt;
+    }
+
+    uint32_t transactions = 0;
+    bool     nack         = false;
+
+    // I2C register access, as the i2c_master mocks receive it
+    int16_t write(uint8_t address, uint8_t regaddr, const uint8_t *data, uint16_t length);
+    int16_t read(uint8_t address, uint8_t regaddr, uint8_t *data, uint16_t length);
+
+   private:
+    void update_interrupt();
+
+    uint8_t  regs[0x16] = {};
+    bool     keys[16][16] = {};
+    uint16_t captured     = 0xFFFF;
+    bool     interrupt    = false;
+};
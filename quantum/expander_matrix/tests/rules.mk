@@ -0,0 +1,31 @@
+expander_matrix_DEFS := -DEXPANDER_MATRIX_MCP23018
+expander_matrix_CONFIG := $(QUANTUM_PATH)/expander_matrix/tests/config_mock.h
+
+expander_matrix_SRC := \
+    $(QUANTUM_PATH)/expander_matrix/tests/mock_expander.cpp \
+    $(QUANTUM_PATH)/expander_matrix/tests/expander_matrix_tests.cpp \
+    $(QUANTUM_PATH)/expander_matrix/expander_matrix.c \
+    $(DRIVER_PATH)/gpio/mcp23018.c \
+    $(PLATFORM_PATH)/timer.c \
+    $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+expander_matrix_INC := \
+    $(QUANTUM_PATH)/expander_matrix \
+    $(DRIVER_PATH)/gpio
+
+expander_matrix_async_DEFS := -DEXPANDER_MATRIX_MCP23018 -DBUS_QUEUE_ENABLE
+expander_matrix_async_CONFIG := $(QUANTUM_PATH)/expander_matrix/tests/config_mock.h
+
+expander_matrix_async_SRC := \
+    $(QUANTUM_PATH)/expander_matrix/tests/mock_expander.cpp \
+    $(QUANTUM_PATH)/expander_matrix/tests/expander_matrix_async_tests.cpp \
+    $(QUANTUM_PATH)/expander_matrix/expander_matrix.c \
+    $(QUANTUM_PATH)/bus_queue/bus_queue.c \
+    $(DRIVER_PATH)/gpio/mcp23018.c \
+    $(PLATFORM_PATH)/timer.c \
+    $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+expander_matrix_async_INC := \
+    $(QUANTUM_PATH)/expander_matrix \
+    $(QUANTUM_PATH)/bus_queue \
+    $(DRIVER_PATH)/gpio
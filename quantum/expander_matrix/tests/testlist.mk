@@ -0,0 +1,3 @@
+TEST_LIST += \
+    expander_matrix \
+    expander_matrix_async
@@ -25,6 +25,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "keycode.h"
 #include "timer.h"
 #include "sync_timer.h"
+#include "deadline.h"
 #include "print.h"
 #include "debug.h"
 #include "command.h"
@@ -122,6 +123,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef SPLIT_KEYBOARD
 #    include "split_util.h"
 #endif
+#if defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_KEY_EVENTS_ENABLE)
+#    include "split_key_events.h"
+#endif
 #ifdef BLUETOOTH_ENABLE
 #    include "bluetooth.h"
 #endif
@@ -143,6 +147,22 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef LAYER_LOCK_ENABLE
 #    include "layer_lock.h"
 #endif
+#ifdef POLL_GOVERNOR_ENABLE
+#    include "poll_governor.h"
+#endif
+#ifdef ADAPTIVE_SCAN_ENABLE
+#    include "adaptive_scan.h"
+#endif
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include "send_string_async.h"
+#endif
+#ifdef BUS_QUEUE_ENABLE
+#    include "bus_queue.h"
+#endif
+#ifdef KEYSTROKE_TRACE_ENABLE
+#    include "keystroke_trace.h"
+#endif
+#include "task_profiler/task_profiler.h"
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -197,14 +217,18 @@ void set_activity_timestamps(uint32_t matrix_timestamp, uint32_t encoder_timesta
 static uint32_t matrix_timer           = 0;
 static uint32_t matrix_scan_count      = 0;
 static uint32_t last_matrix_scan_count = 0;
+static uint32_t min_matrix_scan_count  = UINT32_MAX;
+static uint32_t max_matrix_scan_count  = 0;
 
 void matrix_scan_perf_task(void) {
     matrix_scan_count++;
 
     uint32_t timer_now = timer_read32();
     if (TIMER_DIFF_32(timer_now, matrix_timer) >= 1000) {
+        min_matrix_scan_count = MIN(min_matrix_scan_count, matrix_scan_count);
+        max_matrix_scan_count = MAX(max_matrix_scan_count, matrix_scan_count);
 #    if defined(CONSOLE_ENABLE)
-        dprintf("matrix scan frequency: %lu\n", matrix_scan_count);
+        dprintf("matrix scan frequency: %lu (min %lu, max %lu)\n", matrix_scan_count, min_matrix_scan_count, max_matrix_scan_count);
 #    endif
         last_matrix_scan_count = matrix_scan_count;
         matrix_timer           = timer_now;
@@ -215,6 +239,19 @@ void matrix_scan_perf_task(void) {
 uint32_t get_matrix_scan_rate(void) {
     return last_matrix_scan_count;
 }
+
+uint32_t get_matrix_scan_rate_min(void) {
+    return min_matrix_scan_count == UINT32_MAX ? 0 : min_matrix_scan_count;
+}
+
+uint32_t get_matrix_scan_rate_max(void) {
+    return max_matrix_scan_count;
+}
+
+void reset_matrix_scan_rate(void) {
+    min_matrix_scan_count = UINT32_MAX;
+    max_matrix_scan_count = 0;
+}
 #else
 #    define matrix_scan_perf_task()
 #endif
@@ -411,6 +448,9 @@ void quantum_init(void) {
 void keyboard_init(void) {
     timer_init();
     sync_timer_init();
+#ifdef BUS_QUEUE_ENABLE
+    bus_queue_init();
+#endif
 #ifdef VIA_ENABLE
     via_init();
 #endif
@@ -488,6 +528,15 @@ void keyboard_init(void) {
 #ifdef HAPTIC_ENABLE
     haptic_init();
 #endif
+#ifdef TASK_PROFILER_ENABLE
+    task_profiler_init();
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+    key_override_init();
+#endif
+#ifdef KEYSTROKE_TRACE_ENABLE
+    keystroke_trace_init();
+#endif
 
 #if defined(DEBUG_MATRIX_SCAN_RATE) && defined(CONSOLE_ENABLE)
     debug_enable = true;
@@ -523,6 +572,54 @@ static inline void generate_tick_event(void) {
     }
 }
 
+#if defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_KEY_EVENTS_ENABLE)
+/**
+ * @brief Processes the key events of the slave half in the order they
+ * happened, with the time the slave saw them, ahead of the changes found by
+ * comparing the matrix.
+ *
+ * @return true if any key changed
+ */
+static bool process_split_key_events(matrix_row_t matrix_previous[], bool process_keypress) {
+    // Time of the last scan, so the events stay in order with those processed since
+    static uint16_t last_scan = 0;
+    const uint16_t  now       = timer_read();
+    const uint16_t  elapsed   = TIMER_DIFF_16(now, last_scan);
+    bool            changed   = false;
+
+    split_key_event_t event;
+    while (split_key_events_dequeue(&event)) {
+        const matrix_row_t col_mask = MATRIX_ROW_SHIFTER << event.col;
+        // Already part of the matrix, e.g. after catching up with the slave
+        if (!(matrix_previous[event.row] & col_mask) == !event.pressed || has_ghost_in_row(event.row, matrix_get_row(event.row))) {
+            continue;
+        }
+
+        keyevent_t key_event = MAKE_KEYEVENT(event.row, event.col, event.pressed);
+        if (TIMER_DIFF_16(event.time, last_scan) <= elapsed) {
+            key_event.time = event.time;
+        } else if (TIMER_DIFF_16(event.time, last_scan) >= 0x8000) {
+            // Older than events already processed
+            key_event.time = last_scan;
+        }
+
+        if (process_keypress) {
+#    ifdef KEYSTROKE_TRACE_ENABLE
+            keystroke_trace_record(event.row, event.col, event.pressed);
+#    endif
+            action_exec(key_event);
+        }
+        switch_events(event.row, event.col, event.pressed);
+
+        matrix_previous[event.row] ^= col_mask;
+        changed = true;
+    }
+
+    last_scan = now;
+    return changed;
+}
+#endif
+
 /**
  * @brief This task scans the keyboards matrix and processes any key presses
  * that occur.
@@ -536,14 +633,41 @@ static bool matrix_task(void) {
         return false;
     }
 
+#ifdef ADAPTIVE_SCAN_ENABLE
+    // Scan less often while the keyboard is idle
+    if (!adaptive_scan_due()) {
+        generate_tick_event();
+        return false;
+    }
+#endif
+
+#ifdef POLL_GOVERNOR_ENABLE
+    // Hold the scan back until just before the host polls for the next report
+    if (!poll_governor_scan_due()) {
+        generate_tick_event();
+        return false;
+    }
+#endif
+
     static matrix_row_t matrix_previous[MATRIX_ROWS];
 
     matrix_scan();
     bool matrix_changed = false;
+#if defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_KEY_EVENTS_ENABLE)
+    matrix_changed = process_split_key_events(matrix_previous, should_process_keypress());
+#endif
     for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
         matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
     }
 
+#ifdef ADAPTIVE_SCAN_ENABLE
+    bool keys_down = false;
+    for (uint8_t row = 0; row < MATRIX_ROWS && !keys_down; row++) {
+        keys_down |= matrix_get_row(row) != 0;
+    }
+    adaptive_scan_update(keys_down);
+#endif
+
     matrix_scan_perf_task();
 
     // Short-circuit the complete matrix processing if it is not necessary
@@ -572,6 +696,9 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
+#ifdef KEYSTROKE_TRACE_ENABLE
+                    keystroke_trace_record(row, col, key_pressed);
+#endif
                     action_exec(MAKE_KEYEVENT(row, col, key_pressed));
                 }
 
@@ -586,6 +713,8 @@ static bool matrix_task(void) {
 }
 
 /** \brief Tasks previously located in matrix_scan_quantum
+ *
+ * Tasks waiting on a timeout only run once their deadline has passed, see deadline.h.
  *
  * TODO: rationalise against keyboard_task and current split role
  */
@@ -620,27 +749,39 @@ void quantum_task(void) {
 #endif
 
 #ifdef KEY_OVERRIDE_ENABLE
-    key_override_task();
+    if (deadline_expired(DEADLINE_KEY_OVERRIDE)) {
+        key_override_task();
+    }
 #endif
 
 #ifdef SEQUENCER_ENABLE
-    sequencer_task();
+    if (deadline_expired(DEADLINE_SEQUENCER)) {
+        sequencer_task();
+    }
 #endif
 
 #ifdef TAP_DANCE_ENABLE
-    tap_dance_task();
+    if (deadline_expired(DEADLINE_TAP_DANCE)) {
+        tap_dance_task();
+    }
 #endif
 
 #ifdef COMBO_ENABLE
-    combo_task();
+    if (deadline_expired(DEADLINE_COMBO)) {
+        combo_task();
+    }
 #endif
 
 #ifdef LEADER_ENABLE
-    leader_task();
+    if (deadline_expired(DEADLINE_LEADER)) {
+        leader_task();
+    }
 #endif
 
 #ifdef WPM_ENABLE
-    decay_wpm();
+    if (deadline_expired(DEADLINE_WPM)) {
+        decay_wpm();
+    }
 #endif
 
 #ifdef DIP_SWITCH_ENABLE
@@ -648,31 +789,53 @@ void quantum_task(void) {
 #endif
 
 #ifdef AUTO_SHIFT_ENABLE
-    autoshift_matrix_scan();
+    if (deadline_expired(DEADLINE_AUTO_SHIFT)) {
+        autoshift_matrix_scan();
+    }
 #endif
 
 #ifdef CAPS_WORD_ENABLE
-    caps_word_task();
+    if (deadline_expired(DEADLINE_CAPS_WORD)) {
+        caps_word_task();
+    }
 #endif
 
 #ifdef SECURE_ENABLE
-    secure_task();
+    if (deadline_expired(DEADLINE_SECURE)) {
+        secure_task();
+    }
 #endif
 
 #ifdef LAYER_LOCK_ENABLE
-    layer_lock_task();
+    if (deadline_expired(DEADLINE_LAYER_LOCK)) {
+        layer_lock_task();
+    }
+#endif
+
+#ifdef POLL_GOVERNOR_ENABLE
+    poll_governor_task();
+#endif
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+    send_string_async_task();
 #endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    bool                         matrix_changed;
+    TASK_PROFILE(TASK_PROFILER_MATRIX, matrix_changed = matrix_task());
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    TASK_PROFILE(TASK_PROFILER_QUANTUM, quantum_task());
+
+#ifdef BUS_QUEUE_ENABLE
+    bus_queue_task();
+#endif
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
@@ -683,10 +846,10 @@ void keyboard_task(void) {
 #endif
 
 #ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
+    TASK_PROFILE(TASK_PROFILER_LED_MATRIX, led_matrix_task());
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    TASK_PROFILE(TASK_PROFILER_RGB_MATRIX, rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
@@ -696,21 +859,25 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ENCODER_ENABLE
-    if (encoder_task()) {
+    bool encoder_changed;
+    TASK_PROFILE(TASK_PROFILER_ENCODER, encoder_changed = encoder_task());
+    if (encoder_changed) {
         last_encoder_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    bool pointing_device_changed;
+    TASK_PROFILE(TASK_PROFILER_POINTING_DEVICE, pointing_device_changed = pointing_device_task());
+    if (pointing_device_changed) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef OLED_ENABLE
-    oled_task();
+    TASK_PROFILE(TASK_PROFILER_OLED, oled_task());
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
@@ -738,6 +905,10 @@ void keyboard_task(void) {
     midi_task();
 #endif
 
+#ifdef AUDIO_ENABLE
+    audio_task();
+#endif
+
 #ifdef JOYSTICK_ENABLE
     joystick_task();
 #endif
@@ -755,4 +926,8 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#ifdef KEYSTROKE_TRACE_ENABLE
+    keystroke_trace_task();
+#endif
 }
@@ -137,7 +137,10 @@ uint32_t last_pointing_device_activity_elapsed(void); // Number of milliseconds
 
 void set_activity_timestamps(uint32_t matrix_timestamp, uint32_t encoder_timestamp, uint32_t pointing_device_timestamp); // Set the timestamps of the last matrix and encoder activity
 
-uint32_t get_matrix_scan_rate(void);
+uint32_t get_matrix_scan_rate(void);     // Matrix scans during the last second
+uint32_t get_matrix_scan_rate_min(void); // Lowest matrix scans per second since startup or reset_matrix_scan_rate()
+uint32_t get_matrix_scan_rate_max(void); // Highest matrix scans per second since startup or reset_matrix_scan_rate()
+void     reset_matrix_scan_rate(void);
 
 #ifdef __cplusplus
 }
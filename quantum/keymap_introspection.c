@@ -170,4 +170,36 @@ __attribute__((weak)) const key_override_t* key_override_get(uint16_t key_overri
     return key_override_get_raw(key_override_idx);
 }
 
+static uint16_t key_override_index[ARRAY_SIZE(key_overrides)];
+
+uint16_t* key_override_index_raw(void) {
+    return key_override_index;
+}
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader Key
+
+#if defined(LEADER_ENABLE) && defined(LEADER_TABLE_ENABLE)
+
+uint16_t leader_trie_count_raw(void) {
+    return ARRAY_SIZE(leader_trie);
+}
+
+__attribute__((weak)) uint16_t leader_trie_count(void) {
+    return leader_trie_count_raw();
+}
+
+const leader_node_t* leader_trie_get_raw(uint16_t node_idx) {
+    if (node_idx >= leader_trie_count_raw()) {
+        return NULL;
+    }
+    return &leader_trie[node_idx];
+}
+
+__attribute__((weak)) const leader_node_t* leader_trie_get(uint16_t node_idx) {
+    return leader_trie_get_raw(node_idx);
+}
+
+#endif // defined(LEADER_ENABLE) && defined(LEADER_TABLE_ENABLE)
@@ -108,4 +108,28 @@ const key_override_t* key_override_get_raw(uint16_t key_override_idx);
 // Get the key override definitions, potentially stored dynamically
 const key_override_t* key_override_get(uint16_t key_override_idx);
 
+// Get the storage for indexing the key overrides by trigger, with room for key_override_count_raw() entries
+uint16_t* key_override_index_raw(void);
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader Key
+
+#if defined(LEADER_ENABLE) && defined(LEADER_TABLE_ENABLE)
+
+// Forward declaration of leader_node_t so we don't need to deal with header reordering
+struct leader_node_t;
+typedef struct leader_node_t leader_node_t;
+
+// Get the number of nodes in the leader sequence trie defined in the user's keymap, stored in firmware rather than any other persistent storage
+uint16_t leader_trie_count_raw(void);
+// Get the number of nodes in the leader sequence trie defined in the user's keymap, potentially stored dynamically
+uint16_t leader_trie_count(void);
+
+// Get the leader sequence trie nodes, stored in firmware rather than any other persistent storage
+const leader_node_t* leader_trie_get_raw(uint16_t node_idx);
+// Get the leader sequence trie nodes, potentially stored dynamically
+const leader_node_t* leader_trie_get(uint16_t node_idx);
+
+#endif // defined(LEADER_ENABLE) && defined(LEADER_TABLE_ENABLE)
@@ -0,0 +1,163 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keystroke_trace.h"
+#include "spsc_ring.h"
+#include "timer.h"
+#include "print.h"
+#ifdef KEYSTROKE_TRACE_LED_PIN
+#    include "gpio.h"
+#endif
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+// Longest encoding of a single event: a 32 bit varint, row and col
+#define KEYSTROKE_TRACE_MAX_EVENT_SIZE 7
+
+SPSC_RING_DECLARE(keystroke_trace_ring, uint8_t, KEYSTROKE_TRACE_BUFFER_SIZE);
+
+static keystroke_trace_ring_t   keystroke_trace_buffer;
+static keystroke_trace_output_t keystroke_trace_output;
+static bool                     keystroke_trace_recording = false;
+static bool                     keystroke_trace_lost      = false;
+static uint32_t                 keystroke_trace_last_event;
+
+__attribute__((weak)) void keystroke_trace_recording_user(bool recording) {}
+
+__attribute__((weak)) void keystroke_trace_recording_kb(bool recording) {
+    keystroke_trace_recording_user(recording);
+}
+
+static void keystroke_trace_set_recording(bool recording) {
+    if (recording == keystroke_trace_recording) {
+        return;
+    }
+    keystroke_trace_recording = recording;
+#ifdef KEYSTROKE_TRACE_LED_PIN
+    gpio_write_pin(KEYSTROKE_TRACE_LED_PIN, recording == KEYSTROKE_TRACE_LED_PIN_ON_STATE);
+#endif
+    keystroke_trace_recording_kb(recording);
+}
+
+void keystroke_trace_init(void) {
+#ifdef KEYSTROKE_TRACE_LED_PIN
+    gpio_set_pin_output(KEYSTROKE_TRACE_LED_PIN);
+    gpio_write_pin(KEYSTROKE_TRACE_LED_PIN, !KEYSTROKE_TRACE_LED_PIN_ON_STATE);
+#endif
+}
+
+void keystroke_trace_start(keystroke_trace_output_t output) {
+    keystroke_trace_ring_init(&keystroke_trace_buffer);
+    keystroke_trace_output     = output;
+    keystroke_trace_lost       = false;
+    keystroke_trace_last_event = timer_read32();
+    keystroke_trace_set_recording(true);
+}
+
+void keystroke_trace_stop(void) {
+    keystroke_trace_set_recording(false);
+}
+
+bool keystroke_trace_is_recording(void) {
+    return keystroke_trace_recording;
+}
+
+static uint8_t keystroke_trace_encode(uint8_t *data, uint32_t delta, uint8_t row, uint8_t col, bool pressed) {
+    uint8_t  size  = 0;
+    uint32_t value = ((delta > (UINT32_MAX >> 1) ? (UINT32_MAX >> 1) : delta) << 1) | pressed;
+    do {
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        data[size++] = byte | (value ? 0x80 : 0);
+    } while (value);
+    data[size++] = row;
+    data[size++] = col;
+    return size;
+}
+
+void keystroke_trace_record(uint8_t row, uint8_t col, bool pressed) {
+    if (!keystroke_trace_recording) {
+        return;
+    }
+
+    uint8_t  event[2 * KEYSTROKE_TRACE_MAX_EVENT_SIZE];
+    uint32_t now   = timer_read32();
+    uint8_t  size  = 0;
+    uint32_t delta = now - keystroke_trace_last_event;
+
+    if (keystroke_trace_lost) {
+        size  = keystroke_trace_encode(event, delta, KEYSTROKE_TRACE_LOST, KEYSTROKE_TRACE_LOST, false);
+        delta = 0;
+    }
+    uint8_t marker_size = size;
+    size += keystroke_trace_encode(&event[size], delta, row, col, pressed);
+
+    // Keeps room for marking that events got lost, which the marker itself may take
+    if (keystroke_trace_ring_space(&keystroke_trace_buffer) < size - marker_size + KEYSTROKE_TRACE_MAX_EVENT_SIZE) {
+        keystroke_trace_lost = true;
+        return;
+    }
+
+    keystroke_trace_ring_push_bulk(&keystroke_trace_buffer, event, size);
+    keystroke_trace_lost       = false;
+    keystroke_trace_last_event = now;
+}
+
+uint8_t keystroke_trace_read(uint8_t *data, uint8_t size) {
+    return keystroke_trace_ring_pop_bulk(&keystroke_trace_buffer, data, size);
+}
+
+void keystroke_trace_task(void) {
+#ifdef CONSOLE_ENABLE
+    if (keystroke_trace_output != KEYSTROKE_TRACE_CONSOLE || keystroke_trace_ring_empty(&keystroke_trace_buffer)) {
+        return;
+    }
+    if (keystroke_trace_recording && keystroke_trace_ring_count(&keystroke_trace_buffer) < KEYSTROKE_TRACE_BUFFER_SIZE / 2 && timer_elapsed32(keystroke_trace_last_event) < KEYSTROKE_TRACE_FLUSH_DELAY) {
+        return;
+    }
+
+    static const char hex[] = "0123456789ABCDEF";
+    uint8_t           data[16];
+    char              line[3 + 2 * sizeof(data) + 2] = "kt:";
+    uint8_t           size                           = keystroke_trace_read(data, sizeof(data));
+
+    for (uint8_t i = 0; i < size; i++) {
+        line[3 + 2 * i]     = hex[data[i] >> 4];
+        line[3 + 2 * i + 1] = hex[data[i] & 0xF];
+    }
+    line[3 + 2 * size]     = '\n';
+    line[3 + 2 * size + 1] = '\0';
+    xprintf("%s", line);
+#endif
+}
+
+#ifdef RAW_ENABLE
+bool keystroke_trace_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 4 || data[0] != KEYSTROKE_TRACE_RAW_HID_ID) {
+        return false;
+    }
+
+    uint8_t command = data[1];
+    uint8_t size    = 0;
+    switch (command) {
+        case KEYSTROKE_TRACE_CMD_STOP:
+            keystroke_trace_stop();
+            break;
+        case KEYSTROKE_TRACE_CMD_START:
+            // Any program talking raw HID could otherwise read what is typed
+#    ifdef KEYSTROKE_TRACE_RAW_HID_START
+            keystroke_trace_start(KEYSTROKE_TRACE_RAW_HID);
+#    endif
+            break;
+        case KEYSTROKE_TRACE_CMD_READ:
+            size = keystroke_trace_read(&data[4], length - 4);
+            break;
+    }
+
+    data[2] = keystroke_trace_recording;
+    data[3] = size;
+    raw_hid_send(data, length);
+    return true;
+}
+#endif
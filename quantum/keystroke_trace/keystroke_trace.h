@@ -0,0 +1,120 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    The keystroke trace records the key presses and releases found by the
+    matrix scan, along with their timing, so that a typing session can be
+    replayed against the firmware on the host, see tests/test_common/
+    keystroke_trace.hpp.
+
+    Each event is encoded as
+
+        varint((ms since the previous event << 1) | pressed), row, col
+
+    An event at row and col KEYSTROKE_TRACE_LOST marks that the events
+    after it were dropped, because they did not fit in the buffer.
+
+    Nothing is recorded until keystroke_trace_start() is called, as the
+    trace holds everything that is typed. Only the keyboard starts it,
+    unless KEYSTROKE_TRACE_RAW_HID_START lets raw HID hosts start it too,
+    and keystroke_trace_recording_kb() is told whenever it starts or stops
+    so that it can be shown on the keyboard. The events are sent over the
+    console as lines of "kt:" followed by their bytes in hex, or read with
+    the raw HID requests described at keystroke_trace_raw_hid_receive().
+*/
+
+// Bytes buffered until they are sent or read, a power of two up to 256
+#ifndef KEYSTROKE_TRACE_BUFFER_SIZE
+#    define KEYSTROKE_TRACE_BUFFER_SIZE 128
+#endif
+
+// Idle time after which the buffered events are sent over the console
+#ifndef KEYSTROKE_TRACE_FLUSH_DELAY
+#    define KEYSTROKE_TRACE_FLUSH_DELAY 250
+#endif
+
+// First byte of the raw HID requests, clear of the VIA command IDs
+#ifndef KEYSTROKE_TRACE_RAW_HID_ID
+#    define KEYSTROKE_TRACE_RAW_HID_ID 0xF1
+#endif
+
+// Level of KEYSTROKE_TRACE_LED_PIN, if any, lighting its LED while recording
+#ifndef KEYSTROKE_TRACE_LED_PIN_ON_STATE
+#    define KEYSTROKE_TRACE_LED_PIN_ON_STATE 1
+#endif
+
+#define KEYSTROKE_TRACE_LOST 0xFF
+
+typedef enum {
+    KEYSTROKE_TRACE_CONSOLE,
+    KEYSTROKE_TRACE_RAW_HID,
+} keystroke_trace_output_t;
+
+enum {
+    KEYSTROKE_TRACE_CMD_STOP  = 0,
+    KEYSTROKE_TRACE_CMD_START = 1,
+    KEYSTROKE_TRACE_CMD_READ  = 2,
+};
+
+/**
+ * @brief Sets up KEYSTROKE_TRACE_LED_PIN, called by keyboard_init().
+ */
+void keystroke_trace_init(void);
+
+/**
+ * @brief Starts recording, discarding anything left from the last recording.
+ */
+void keystroke_trace_start(keystroke_trace_output_t output);
+
+/**
+ * @brief Stops recording. Events already buffered are still sent, or can still be read.
+ */
+void keystroke_trace_stop(void);
+
+bool keystroke_trace_is_recording(void);
+
+/**
+ * @brief Called when recording starts or stops, to show it on the keyboard.
+ */
+void keystroke_trace_recording_kb(bool recording);
+void keystroke_trace_recording_user(bool recording);
+
+/**
+ * @brief Records a change of the matrix.
+ */
+void keystroke_trace_record(uint8_t row, uint8_t col, bool pressed);
+
+/**
+ * @brief Removes up to `size` bytes of buffered events.
+ *
+ * @return the number of bytes copied to `data`
+ */
+uint8_t keystroke_trace_read(uint8_t *data, uint8_t size);
+
+/**
+ * @brief Sends the buffered events over the console, once the keyboard is idle or the buffer fills up.
+ */
+void keystroke_trace_task(void);
+
+#ifdef RAW_ENABLE
+/**
+ * @brief Answers a raw HID request, for keyboards handling raw HID themselves.
+ *
+ * request: [ KEYSTROKE_TRACE_RAW_HID_ID, command ]
+ * reply:   [ KEYSTROKE_TRACE_RAW_HID_ID, command, recording, length, event bytes... ]
+ *
+ * KEYSTROKE_TRACE_CMD_START starts recording for raw HID, without any console
+ * output, if KEYSTROKE_TRACE_RAW_HID_START is defined. Otherwise only the
+ * keyboard can start it, with keystroke_trace_start(KEYSTROKE_TRACE_RAW_HID).
+ * KEYSTROKE_TRACE_CMD_READ returns as many buffered bytes as fit
+ * in the reply. Events may be split across replies.
+ *
+ * @return true if it was a keystroke trace request, and the reply has been sent
+ */
+bool keystroke_trace_raw_hid_receive(uint8_t *data, uint8_t length);
+#endif
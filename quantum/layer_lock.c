@@ -14,6 +14,7 @@
 
 #include "layer_lock.h"
 #include "quantum_keycodes.h"
+#include "deadline.h"
 
 #ifndef NO_ACTION_LAYER
 // The current lock state. The kth bit is on if layer k is locked.
@@ -24,13 +25,16 @@ layer_state_t locked_layers = 0;
 uint32_t layer_lock_timer = 0;
 
 void layer_lock_timeout_task(void) {
-    if (locked_layers && timer_elapsed32(layer_lock_timer) > LAYER_LOCK_IDLE_TIMEOUT) {
+    if (!locked_layers) {
+        deadline_clear(DEADLINE_LAYER_LOCK);
+    } else if (timer_elapsed32(layer_lock_timer) > LAYER_LOCK_IDLE_TIMEOUT) {
         layer_lock_all_off();
         layer_lock_timer = timer_read32();
     }
 }
 void layer_lock_activity_trigger(void) {
     layer_lock_timer = timer_read32();
+    deadline_set(DEADLINE_LAYER_LOCK, LAYER_LOCK_IDLE_TIMEOUT);
 }
 #    else
 void layer_lock_timeout_task(void) {}
@@ -3,10 +3,18 @@
 
 #include "leader.h"
 #include "timer.h"
+#include "deadline.h"
 #include "util.h"
 
 #include <string.h>
 
+#ifdef LEADER_TABLE_ENABLE
+#    include "quantum.h"
+#    include "keymap_introspection.h"
+
+#    define LEADER_NODE_NONE UINT16_MAX
+#endif
+
 #ifndef LEADER_TIMEOUT
 #    define LEADER_TIMEOUT 300
 #endif
@@ -17,6 +25,11 @@ uint16_t leader_time          = 0;
 uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
 uint8_t  leader_sequence_size = 0;
 
+#ifdef LEADER_TABLE_ENABLE
+// The node of the leader table reached by the keys pressed so far
+static uint16_t leader_node = LEADER_NODE_NONE;
+#endif
+
 __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
@@ -25,24 +38,79 @@ __attribute__((weak)) bool leader_add_user(uint16_t keycode) {
     return false;
 }
 
+#ifdef LEADER_TABLE_ENABLE
+__attribute__((weak)) bool leader_table_action_user(uint16_t keycode) {
+    return true;
+}
+
+static bool leader_node_read(uint16_t index, leader_node_t *node) {
+    const leader_node_t *stored = leader_trie_get(index);
+    if (stored == NULL) {
+        return false;
+    }
+    memcpy_P(node, stored, sizeof(leader_node_t));
+    return true;
+}
+
+/**
+ * Follows the keycode from the current node of the leader table.
+ *
+ * \return `true` if longer sequences may still match, `false` if the sequence is complete or cannot match any more.
+ */
+static bool leader_table_step(uint16_t keycode) {
+    leader_node_t node;
+    if (leader_node == LEADER_NODE_NONE || !leader_node_read(leader_node, &node)) {
+        leader_node = LEADER_NODE_NONE;
+        return false;
+    }
+
+    for (uint16_t index = node.children; index < node.children + node.child_count; index++) {
+        leader_node_t child;
+        if (leader_node_read(index, &child) && child.keycode == keycode) {
+            leader_node = index;
+            return child.child_count > 0;
+        }
+    }
+
+    leader_node = LEADER_NODE_NONE;
+    return false;
+}
+
+static void leader_table_end(void) {
+    leader_node_t node;
+    if (leader_node != LEADER_NODE_NONE && leader_node_read(leader_node, &node) && node.action != KC_NO && leader_table_action_user(node.action)) {
+        tap_code16(node.action);
+    }
+    leader_node = LEADER_NODE_NONE;
+}
+#endif
+
 void leader_start(void) {
     if (leading) {
         return;
     }
     leader_start_user();
     leading              = true;
-    leader_time          = timer_read();
     leader_sequence_size = 0;
+    leader_reset_timer();
     memset(leader_sequence, 0, sizeof(leader_sequence));
+#ifdef LEADER_TABLE_ENABLE
+    leader_node = 0;
+#endif
 }
 
 void leader_end(void) {
     leading = false;
+#ifdef LEADER_TABLE_ENABLE
+    leader_table_end();
+#endif
     leader_end_user();
 }
 
 void leader_task(void) {
-    if (leader_sequence_active() && leader_sequence_timed_out()) {
+    if (!leader_sequence_active()) {
+        deadline_clear(DEADLINE_LEADER);
+    } else if (leader_sequence_timed_out()) {
         leader_end();
     }
 }
@@ -68,6 +136,21 @@ bool leader_sequence_add(uint16_t keycode) {
     if (leader_add_user(keycode)) {
         leader_end();
     }
+
+#ifdef LEADER_TABLE_ENABLE
+    if (leading && leader_trie_count() > 0) {
+        bool may_continue = leader_table_step(keycode);
+#    ifdef LEADER_TABLE_EXCLUSIVE
+        // End the sequence as soon as no other sequence from the table can follow
+        if (!may_continue) {
+            leader_end();
+        }
+#    else
+        // leader_end_user() may still handle longer sequences, or ones missing from the table
+        (void)may_continue;
+#    endif
+    }
+#endif
     return true;
 }
 
@@ -81,6 +164,7 @@ bool leader_sequence_timed_out(void) {
 
 void leader_reset_timer(void) {
     leader_time = timer_read();
+    deadline_set(DEADLINE_LEADER, LEADER_TIMEOUT);
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
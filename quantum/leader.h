@@ -1,6 +1,8 @@
 // Copyright 2023 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#pragma once
+
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -11,6 +13,18 @@
  * \{
  */
 
+/**
+ * \brief A node of the trie of leader sequences, generated from `leader_sequences` in keymap.json.
+ *
+ * The children of a node are stored next to each other, so that a node only needs to know where the first one is.
+ */
+typedef struct leader_node_t {
+    uint16_t keycode;     // The keycode that leads from the parent node to this one
+    uint16_t action;      // The keycode tapped when the sequence ends at this node, or KC_NO
+    uint16_t children;    // The index of the first child
+    uint8_t  child_count; // The number of children
+} leader_node_t;
+
 /**
  * \brief User callback, invoked when the leader sequence begins.
  */
@@ -30,6 +44,15 @@ void leader_end_user(void);
  */
 bool leader_add_user(uint16_t keycode);
 
+/**
+ * \brief User callback, invoked when a sequence from the leader table has been completed.
+ *
+ * \param keycode The keycode the sequence is mapped to.
+ *
+ * \return `true` to tap the keycode, `false` if it has been handled.
+ */
+bool leader_table_action_user(uint16_t keycode);
+
 /**
  * Begin the leader sequence, resetting the buffer and timer.
  */
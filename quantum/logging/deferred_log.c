@@ -0,0 +1,79 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <string.h>
+#include "deferred_log.h"
+#include "printf.h"
+
+_Static_assert(DEFERRED_LOG_BUFFER_SIZE < 254, "DEFERRED_LOG_BUFFER_SIZE must fit in a single COBS block");
+
+// Weak, for a build without any log messages
+extern const char __start_qmk_log_strings[] __attribute__((weak));
+
+static uint8_t deferred_log_put_varint(uint8_t *buffer, uint8_t size, uint32_t value) {
+    do {
+        if (size >= DEFERRED_LOG_BUFFER_SIZE) {
+            break;
+        }
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        buffer[size++] = byte | (value ? 0x80 : 0);
+    } while (value);
+    return size;
+}
+
+// Sends the frame, with its zero bytes replaced by the distance to the next one
+static void deferred_log_send_frame(const uint8_t *buffer, uint8_t size) {
+    putchar_(DEFERRED_LOG_FRAME_START);
+
+    uint8_t start = 0;
+    for (uint8_t i = 0; i <= size; i++) {
+        if (i == size || buffer[i] == 0) {
+            putchar_(i - start + 1);
+            for (; start < i; start++) {
+                putchar_(buffer[start]);
+            }
+            start = i + 1;
+        }
+    }
+
+    putchar_(DEFERRED_LOG_FRAME_END);
+}
+
+void deferred_log_write(const char *format, uint16_t types, ...) {
+    uint8_t buffer[DEFERRED_LOG_BUFFER_SIZE];
+    uint8_t size = deferred_log_put_varint(buffer, 0, (uint32_t)(format - __start_qmk_log_strings));
+
+    va_list args;
+    va_start(args, types);
+    for (; types; types >>= 2) {
+        switch (types & 0x3) {
+            case DEFERRED_LOG_ARG_INT:
+                size = deferred_log_put_varint(buffer, size, va_arg(args, unsigned int));
+                break;
+            case DEFERRED_LOG_ARG_LONG:
+                size = deferred_log_put_varint(buffer, size, va_arg(args, unsigned long));
+                break;
+            case DEFERRED_LOG_ARG_STRING: {
+                const char *string = va_arg(args, const char *);
+                size_t      length = string ? strlen(string) : 0;
+                // Leave room for the length itself
+                size_t room = DEFERRED_LOG_BUFFER_SIZE - size > 2 ? DEFERRED_LOG_BUFFER_SIZE - size - 2 : 0;
+                if (length > room) {
+                    length = room;
+                }
+                size = deferred_log_put_varint(buffer, size, length);
+                if (length) {
+                    memcpy(&buffer[size], string, length);
+                    size += length;
+                }
+                break;
+            }
+        }
+    }
+    va_end(args);
+
+    deferred_log_send_frame(buffer, size);
+}
@@ -0,0 +1,102 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+    Deferred logging leaves the formatting of log messages to the host.
+
+    The format string of every xprintf() call is placed in the
+    qmk_log_strings section, which is kept in the ELF file but never
+    loaded into flash, and its offset within that section serves as the
+    ID of the message. Only the ID and the raw arguments are sent over the
+    console, framed so the host can tell them apart from plain text:
+
+        0x1E, COBS(varint ID, argument...), 0x00
+
+    Integers are sent as varints of their unsigned value, at the width of
+    int or long, strings as a varint length followed by the characters.
+    The types are taken from the arguments themselves rather than from the
+    format string, so %s expects a char pointer, and floating point
+    arguments are not supported.
+*/
+
+// Largest frame before COBS, longer strings are truncated
+#ifndef DEFERRED_LOG_BUFFER_SIZE
+#    define DEFERRED_LOG_BUFFER_SIZE 64
+#endif
+
+#define DEFERRED_LOG_FRAME_START 0x1E
+#define DEFERRED_LOG_FRAME_END 0x00
+
+enum {
+    DEFERRED_LOG_ARG_NONE   = 0,
+    DEFERRED_LOG_ARG_INT    = 1,
+    DEFERRED_LOG_ARG_LONG   = 2,
+    DEFERRED_LOG_ARG_STRING = 3,
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sends a log message.
+ *
+ * @param format the format string, within the qmk_log_strings section
+ * @param types two bits per argument, the first argument in the lowest bits
+ */
+void deferred_log_write(const char *format, uint16_t types, ...);
+
+// Checks the arguments against the format string, as for printf
+static inline __attribute__((format(printf, 1, 2))) void deferred_log_check_format(const char *format, ...) {}
+
+#ifdef __cplusplus
+}
+
+// Also usable from headers included within extern "C"
+extern "C++" {
+static inline constexpr uint8_t deferred_log_type(const char *) {
+    return DEFERRED_LOG_ARG_STRING;
+}
+
+static inline constexpr uint8_t deferred_log_type(char *) {
+    return DEFERRED_LOG_ARG_STRING;
+}
+
+template <typename T>
+static inline constexpr uint8_t deferred_log_type(T x) {
+    return sizeof(x + 0) > sizeof(int) ? DEFERRED_LOG_ARG_LONG : DEFERRED_LOG_ARG_INT;
+}
+}
+
+#    define DEFERRED_LOG_TYPE(x) deferred_log_type(x)
+#else
+// Arguments narrower than int are promoted, pointers are sent as numbers
+#    define DEFERRED_LOG_TYPE(x) _Generic((x), char *: DEFERRED_LOG_ARG_STRING, const char *: DEFERRED_LOG_ARG_STRING, default: (sizeof((x) + 0) > sizeof(int) ? DEFERRED_LOG_ARG_LONG : DEFERRED_LOG_ARG_INT))
+#endif
+
+#define DEFERRED_LOG_CONCAT(a, b) DEFERRED_LOG_CONCAT_(a, b)
+#define DEFERRED_LOG_CONCAT_(a, b) a##b
+#define DEFERRED_LOG_NARGS(...) DEFERRED_LOG_NARGS_(_, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define DEFERRED_LOG_NARGS_(_, _1, _2, _3, _4, _5, _6, _7, _8, N, ...) N
+
+#define DEFERRED_LOG_TYPES(...) DEFERRED_LOG_CONCAT(DEFERRED_LOG_TYPES_, DEFERRED_LOG_NARGS(__VA_ARGS__))(__VA_ARGS__)
+#define DEFERRED_LOG_TYPES_0() 0
+#define DEFERRED_LOG_TYPES_1(a) DEFERRED_LOG_TYPE(a)
+#define DEFERRED_LOG_TYPES_2(a, ...) (DEFERRED_LOG_TYPE(a) | (DEFERRED_LOG_TYPES_1(__VA_ARGS__) << 2))
+#define DEFERRED_LOG_TYPES_3(a, ...) (DEFERRED_LOG_TYPE(a) | (DEFERRED_LOG_TYPES_2(__VA_ARGS__) << 2))
+#define DEFERRED_LOG_TYPES_4(a, ...) (DEFERRED_LOG_TYPE(a) | (DEFERRED_LOG_TYPES_3(__VA_ARGS__) << 2))
+#define DEFERRED_LOG_TYPES_5(a, ...) (DEFERRED_LOG_TYPE(a) | (DEFERRED_LOG_TYPES_4(__VA_ARGS__) << 2))
+#define DEFERRED_LOG_TYPES_6(a, ...) (DEFERRED_LOG_TYPE(a) | (DEFERRED_LOG_TYPES_5(__VA_ARGS__) << 2))
+#define DEFERRED_LOG_TYPES_7(a, ...) (DEFERRED_LOG_TYPE(a) | (DEFERRED_LOG_TYPES_6(__VA_ARGS__) << 2))
+#define DEFERRED_LOG_TYPES_8(a, ...) (DEFERRED_LOG_TYPE(a) | (DEFERRED_LOG_TYPES_7(__VA_ARGS__) << 2))
+
+#define deferred_log_printf(fmt, ...)                                                                        \
+    do {                                                                                                     \
+        static const char deferred_log_format[] __attribute__((section("qmk_log_strings"), used)) = fmt;    \
+        deferred_log_check_format(fmt, ##__VA_ARGS__);                                                       \
+        deferred_log_write(deferred_log_format, (uint16_t)(DEFERRED_LOG_TYPES(__VA_ARGS__)), ##__VA_ARGS__); \
+    } while (0)
@@ -49,7 +49,10 @@ void print_set_sendchar(sendchar_func_t func);
     } while (0)
 
 #ifndef NO_PRINT
-#    if __has_include_next("_print.h")
+#    if defined(DEFERRED_LOG_ENABLE)
+#        include "deferred_log.h" // Formatted on the host, see deferred_log.h
+#        define xprintf deferred_log_printf
+#    elif __has_include_next("_print.h")
 #        include_next "_print.h" /* Include the platforms print.h */
 #    else
 #        include "printf.h" // // Fall back to lib/printf/printf.h
@@ -10,3 +10,11 @@ OPT_DEFS += -DPRINTF_SUPPORT_LONG_LONG=0
 OPT_DEFS += -DPRINTF_SUPPORT_WRITEBACK_SPECIFIER=0
 OPT_DEFS += -DSUPPORT_MSVC_STYLE_INTEGER_SPECIFIERS=0
 OPT_DEFS += -DPRINTF_ALIAS_STANDARD_FUNCTION_NAMES=1
+
+ifeq ($(strip $(DEFERRED_LOG_ENABLE)), yes)
+    OPT_DEFS += -DDEFERRED_LOG_ENABLE
+    QUANTUM_SRC += $(QUANTUM_DIR)/logging/deferred_log.c
+    ifneq ($(strip $(PLATFORM_KEY)), test)
+        EXTRALDFLAGS += -Wl,-T,$(QUANTUM_PATH)/logging/deferred_log.ld
+    endif
+endif
@@ -0,0 +1,16 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "deferred_log.h"
+
+// Logged from C, where the argument types come from _Generic
+void deferred_log_messages(void) {
+    uint8_t     row  = 3;
+    uint16_t    code = 0xABCD;
+    int         diff = -2;
+    uint32_t    time = 0x12345678;
+    const char *name = "KC_A";
+
+    deferred_log_printf("boot\n");
+    deferred_log_printf("row %u code %04X diff %d time %lu key %s\n", row, code, diff, (unsigned long)time, name);
+}
@@ -0,0 +1,141 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "deferred_log.h"
+#include "sendchar.h"
+
+void print_set_sendchar(sendchar_func_t func);
+
+extern const char __start_qmk_log_strings[];
+
+void deferred_log_messages(void);
+}
+
+namespace {
+
+std::vector<uint8_t> output;
+
+// A frame as the host sees it, after undoing the COBS encoding
+struct Frame {
+    std::string           format;
+    std::vector<uint32_t> values;
+    std::vector<uint8_t>  data;
+    size_t                position = 0;
+
+    uint32_t varint() {
+        uint32_t value = 0;
+        for (uint8_t shift = 0; position < data.size(); shift += 7) {
+            uint8_t byte = data[position++];
+            value |= (uint32_t)(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                break;
+            }
+        }
+        return value;
+    }
+
+    std::string string() {
+        uint32_t    length = varint();
+        std::string s(data.begin() + position, data.begin() + position + length);
+        position += length;
+        return s;
+    }
+};
+
+std::vector<Frame> frames() {
+    std::vector<Frame> result;
+    size_t             i = 0;
+    while (i < output.size()) {
+        EXPECT_EQ(output[i++], DEFERRED_LOG_FRAME_START);
+        Frame frame;
+        while (output[i] != DEFERRED_LOG_FRAME_END) {
+            uint8_t code = output[i++];
+            for (uint8_t j = 1; j < code; j++) {
+                EXPECT_NE(output[i], 0);
+                frame.data.push_back(output[i++]);
+            }
+            if (output[i] != DEFERRED_LOG_FRAME_END) {
+                frame.data.push_back(0);
+            }
+        }
+        i++;
+        frame.format = &__start_qmk_log_strings[frame.varint()];
+        result.push_back(frame);
+    }
+    return result;
+}
+
+int8_t capture(uint8_t c) {
+    output.push_back(c);
+    return 0;
+}
+
+} // namespace
+
+class DeferredLog : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        output.clear();
+        print_set_sendchar(capture);
+    }
+};
+
+TEST_F(DeferredLog, SendsOnlyTheId) {
+    deferred_log_printf("matrix scan rate: %lu\n", 1234ul);
+    deferred_log_printf("hello\n");
+
+    auto f = frames();
+    ASSERT_EQ(f.size(), 2u);
+    EXPECT_EQ(f[0].format, "matrix scan rate: %lu\n");
+    EXPECT_EQ(f[0].varint(), 1234u);
+    EXPECT_EQ(f[0].position, f[0].data.size());
+    EXPECT_EQ(f[1].format, "hello\n");
+    EXPECT_EQ(f[1].position, f[1].data.size());
+    // Both messages together take fewer bytes than the first one as text
+    EXPECT_LT(output.size(), strlen("matrix scan rate: 1234\n"));
+}
+
+TEST_F(DeferredLog, ArgumentsFromC) {
+    deferred_log_messages();
+
+    auto f = frames();
+    ASSERT_EQ(f.size(), 2u);
+    EXPECT_EQ(f[0].format, "boot\n");
+    EXPECT_EQ(f[1].format, "row %u code %04X diff %d time %lu key %s\n");
+    EXPECT_EQ(f[1].varint(), 3u);
+    EXPECT_EQ(f[1].varint(), 0xABCDu);
+    // Sent at the width of int, the host sign-extends it for %d
+    EXPECT_EQ(f[1].varint(), (uint32_t)(unsigned int)-2);
+    EXPECT_EQ(f[1].varint(), 0x12345678u);
+    EXPECT_EQ(f[1].string(), "KC_A");
+    EXPECT_EQ(f[1].position, f[1].data.size());
+}
+
+TEST_F(DeferredLog, ZerosAreEncoded) {
+    deferred_log_printf("%u %u %s %u\n", 0, 0, "", 0);
+
+    auto f = frames();
+    ASSERT_EQ(f.size(), 1u);
+    EXPECT_EQ(f[0].varint(), 0u);
+    EXPECT_EQ(f[0].varint(), 0u);
+    EXPECT_EQ(f[0].string(), "");
+    EXPECT_EQ(f[0].varint(), 0u);
+}
+
+TEST_F(DeferredLog, LongStringsAreTruncated) {
+    std::string long_string(100, 'x');
+    deferred_log_printf("%s\n", long_string.c_str());
+
+    auto f = frames();
+    ASSERT_EQ(f.size(), 1u);
+    // The ID, the length and the characters fill up the buffer
+    size_t id_size = f[0].position;
+    EXPECT_EQ(f[0].string(), std::string(DEFERRED_LOG_BUFFER_SIZE - id_size - 2, 'x'));
+}
@@ -0,0 +1,10 @@
+deferred_log_DEFS := -DDEFERRED_LOG_BUFFER_SIZE=32
+
+deferred_log_SRC := \
+    $(QUANTUM_PATH)/logging/tests/deferred_log_tests.cpp \
+    $(QUANTUM_PATH)/logging/tests/deferred_log_messages.c \
+    $(QUANTUM_PATH)/logging/deferred_log.c
+
+deferred_log_INC := \
+    $(QUANTUM_PATH)/logging \
+    $(LIB_PATH)/printf/src/printf
@@ -0,0 +1,98 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "low_power_scan.h"
+#include "keyboard.h"
+#include "deadline.h"
+#include "debug.h"
+
+#ifdef ENCODER_ENABLE
+#    error "LOW_POWER_SCAN_ENABLE does not support ENCODER_ENABLE, encoders are polled and would lose steps while the MCU sleeps"
+#endif
+
+static low_power_scan_state_t state = LOW_POWER_SCAN_ACTIVE;
+static volatile bool          wake_pending;
+
+__attribute__((weak)) void low_power_scan_wake_enable(pin_t pin) {}
+__attribute__((weak)) void low_power_scan_wake_disable(pin_t pin) {}
+__attribute__((weak)) void low_power_scan_sleep(uint32_t timeout_ms) {}
+
+void low_power_scan_init(void) {
+    state        = LOW_POWER_SCAN_ACTIVE;
+    wake_pending = false;
+}
+
+void low_power_scan_wake(void) {
+    wake_pending = true;
+}
+
+low_power_scan_state_t low_power_scan_get_state(void) {
+    return state;
+}
+
+static void low_power_scan_exit(void) {
+    dprintln("low_power_scan: waking up");
+    low_power_scan_matrix_exit();
+    wake_pending = false;
+    state        = LOW_POWER_SCAN_ACTIVE;
+}
+
+bool low_power_scan_begin(void) {
+    if (state == LOW_POWER_SCAN_ACTIVE) {
+        return true;
+    }
+
+    // A wake event without an active column is a key that has already been released, scan it anyway
+    if (!wake_pending && !low_power_scan_matrix_active()) {
+        return false;
+    }
+
+    low_power_scan_exit();
+    return true;
+}
+
+void low_power_scan_end(bool changed, bool keys_down) {
+    if (state != LOW_POWER_SCAN_ACTIVE) {
+        // Rows that are not driven by the MCU, read over a transport
+        if (changed) {
+            low_power_scan_exit();
+        }
+        return;
+    }
+
+    if (keys_down || last_input_activity_elapsed() < LOW_POWER_SCAN_IDLE_TIMEOUT) {
+        return;
+    }
+
+    dprintln("low_power_scan: going idle");
+    // Edges from here on wake the keyboard, so a press while entering is not missed
+    wake_pending = false;
+    state        = LOW_POWER_SCAN_IDLE;
+    low_power_scan_matrix_enter();
+}
+
+void low_power_scan_task(void) {
+    if (state == LOW_POWER_SCAN_ACTIVE) {
+        return;
+    }
+
+    // Inputs outside the matrix, such as a pointing device
+    if (last_input_activity_elapsed() < LOW_POWER_SCAN_IDLE_TIMEOUT) {
+        low_power_scan_exit();
+        return;
+    }
+
+    if (wake_pending || low_power_scan_matrix_active()) {
+        return;
+    }
+
+    // Wake up in time for the next timeout of the keyboard
+    uint32_t timeout_ms = LOW_POWER_SCAN_MAX_SLEEP;
+    uint32_t remaining;
+    if (deadline_next(&remaining) && remaining < timeout_ms) {
+        timeout_ms = remaining;
+    }
+    if (timeout_ms > 0) {
+        low_power_scan_sleep(timeout_ms);
+    }
+}
@@ -0,0 +1,105 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+
+/*
+    Stops scanning the matrix row by row once no key has been touched for
+    LOW_POWER_SCAN_IDLE_TIMEOUT.
+
+    While idle, every row is driven at once, so a key press anywhere shows up
+    on its column. The matrix then only checks whether any column is active,
+    and the main loop sleeps at the end of each run, until one of the column
+    pins signals an edge or the next timeout of the keyboard is due. The wake
+    is latched, so the full scan resumes right away and picks up the key that
+    caused it, instead of that key press only serving to wake the keyboard.
+
+    Any other change of the debounced matrix, such as on the other half of a
+    split keyboard or on an expander, and any input activity seen by the
+    keyboard task, ends the idle mode as well. As these cannot wake the MCU,
+    the sleep is kept short when they are enabled. Encoders would lose steps
+    while the MCU sleeps, so they are not supported.
+
+    The matrix provides the low_power_scan_matrix_*() functions. The platform
+    may provide the wake and sleep functions, without them the keyboard stays
+    awake and only the scanning is reduced.
+*/
+
+#ifndef LOW_POWER_SCAN_IDLE_TIMEOUT
+#    define LOW_POWER_SCAN_IDLE_TIMEOUT 30000
+#endif
+
+// Longest a single sleep lasts without a wake event
+#ifndef LOW_POWER_SCAN_MAX_SLEEP
+#    if defined(SPLIT_KEYBOARD) || defined(EXPANDER_MATRIX_ENABLE) || defined(POINTING_DEVICE_ENABLE)
+// Some inputs are polled, and cannot wake the MCU
+#        define LOW_POWER_SCAN_MAX_SLEEP 10
+#    else
+#        define LOW_POWER_SCAN_MAX_SLEEP 100
+#    endif
+#endif
+
+typedef enum {
+    LOW_POWER_SCAN_ACTIVE,
+    LOW_POWER_SCAN_IDLE,
+} low_power_scan_state_t;
+
+void low_power_scan_init(void);
+
+/**
+ * @brief Called before scanning the rows of the MCU, leaves the idle mode once a column is active.
+ *
+ * @return true if the rows have to be scanned, false if it is idle and nothing is pressed
+ */
+bool low_power_scan_begin(void);
+
+/**
+ * @brief Called after debouncing, leaves the idle mode on any change, and enters it once the keyboard has been left alone.
+ *
+ * @param changed whether the debounced matrix changed
+ * @param keys_down whether any key of the whole matrix is pressed
+ */
+void low_power_scan_end(bool changed, bool keys_down);
+
+/**
+ * @brief Called at the end of the main loop, sleeps while idle.
+ */
+void low_power_scan_task(void);
+
+/**
+ * @brief Records a wake event. Safe to call from an ISR.
+ */
+void low_power_scan_wake(void);
+
+low_power_scan_state_t low_power_scan_get_state(void);
+
+/**
+ * @brief Drives every row, leaving the columns as inputs, and enables their wake events.
+ */
+void low_power_scan_matrix_enter(void);
+
+/**
+ * @brief Disables the wake events, and restores the pins for a regular scan.
+ */
+void low_power_scan_matrix_exit(void);
+
+/**
+ * @brief Whether any column is active, while every row is driven.
+ */
+bool low_power_scan_matrix_active(void);
+
+/**
+ * @brief Lets a pin wake the keyboard on either edge, calling low_power_scan_wake().
+ */
+void low_power_scan_wake_enable(pin_t pin);
+
+void low_power_scan_wake_disable(pin_t pin);
+
+/**
+ * @brief Sleeps until low_power_scan_wake() is called, or the timeout has passed.
+ */
+void low_power_scan_sleep(uint32_t timeout_ms);
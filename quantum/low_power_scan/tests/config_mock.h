@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+
+#define LOW_POWER_SCAN_IDLE_TIMEOUT 1000
+#define LOW_POWER_SCAN_MAX_SLEEP 50
+
+typedef uint8_t pin_t;
@@ -0,0 +1,221 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "low_power_scan.h"
+#include "deadline.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+namespace {
+
+// A matrix with all of its rows driven while idle, and a platform that can sleep
+struct MockMatrix {
+    bool                  selected      = false;
+    bool                  column        = false;
+    bool                  wake_in_sleep = false;
+    uint32_t              last_input    = 0;
+    std::vector<uint32_t> sleeps;
+    std::vector<pin_t>    wake_pins;
+};
+
+MockMatrix *mock;
+
+} // namespace
+
+extern "C" {
+uint32_t last_input_activity_elapsed(void) {
+    return timer_elapsed32(mock->last_input);
+}
+
+void low_power_scan_matrix_enter(void) {
+    mock->selected = true;
+    low_power_scan_wake_enable(3);
+}
+
+void low_power_scan_matrix_exit(void) {
+    low_power_scan_wake_disable(3);
+    mock->selected = false;
+}
+
+bool low_power_scan_matrix_active(void) {
+    return mock->selected && mock->column;
+}
+
+void low_power_scan_wake_enable(pin_t pin) {
+    mock->wake_pins.push_back(pin);
+}
+
+void low_power_scan_wake_disable(pin_t pin) {
+    mock->wake_pins.clear();
+}
+
+void low_power_scan_sleep(uint32_t timeout_ms) {
+    mock->sleeps.push_back(timeout_ms);
+    if (mock->wake_in_sleep) {
+        // A key tapped and released again while the MCU sleeps
+        low_power_scan_wake();
+    } else {
+        advance_time(timeout_ms);
+    }
+}
+}
+
+class LowPowerScan : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock = &matrix;
+        set_time(0);
+        for (uint8_t id = 0; id < DEADLINE_COUNT; id++) {
+            deadline_clear((deadline_id_t)id);
+        }
+        low_power_scan_init();
+    }
+
+    // One run of the main loop, returning whether the rows of the MCU were read
+    bool run(bool keys_down = false, bool changed = false) {
+        bool scanned = low_power_scan_begin();
+        low_power_scan_end(changed, keys_down);
+        low_power_scan_task();
+        return scanned;
+    }
+
+    void go_idle() {
+        advance_time(LOW_POWER_SCAN_IDLE_TIMEOUT);
+        run();
+        ASSERT_EQ(low_power_scan_get_state(), LOW_POWER_SCAN_IDLE);
+    }
+
+    MockMatrix matrix;
+};
+
+TEST_F(LowPowerScan, ScansUntilIdleTimeout) {
+    for (int i = 0; i < 10; i++) {
+        advance_time(LOW_POWER_SCAN_IDLE_TIMEOUT / 10 - 1);
+        EXPECT_TRUE(run());
+        EXPECT_EQ(low_power_scan_get_state(), LOW_POWER_SCAN_ACTIVE);
+    }
+    EXPECT_FALSE(matrix.selected);
+    EXPECT_TRUE(matrix.sleeps.empty());
+
+    advance_time(10);
+    EXPECT_TRUE(run());
+    EXPECT_EQ(low_power_scan_get_state(), LOW_POWER_SCAN_IDLE);
+    EXPECT_TRUE(matrix.selected);
+    EXPECT_EQ(matrix.wake_pins, std::vector<pin_t>{3});
+    EXPECT_EQ(matrix.sleeps.size(), 1u);
+}
+
+TEST_F(LowPowerScan, HeldKeyKeepsScanning) {
+    // A key held down for longer than the timeout
+    advance_time(LOW_POWER_SCAN_IDLE_TIMEOUT * 2);
+    EXPECT_TRUE(run(true));
+    EXPECT_TRUE(run(true));
+    EXPECT_EQ(low_power_scan_get_state(), LOW_POWER_SCAN_ACTIVE);
+    EXPECT_TRUE(matrix.sleeps.empty());
+}
+
+TEST_F(LowPowerScan, SleepsWhileIdle) {
+    go_idle();
+    EXPECT_FALSE(run());
+    EXPECT_FALSE(run());
+    EXPECT_EQ(matrix.sleeps, (std::vector<uint32_t>{LOW_POWER_SCAN_MAX_SLEEP, LOW_POWER_SCAN_MAX_SLEEP, LOW_POWER_SCAN_MAX_SLEEP}));
+    EXPECT_EQ(low_power_scan_get_state(), LOW_POWER_SCAN_IDLE);
+}
+
+TEST_F(LowPowerScan, ScanNeverSleeps) {
+    go_idle();
+
+    // Only the main loop sleeps, so the rest of the keyboard task is not held up
+    for (int i = 0; i < 3; i++) {
+        EXPECT_FALSE(low_power_scan_begin());
+        low_power_scan_end(false, false);
+    }
+    EXPECT_EQ(matrix.sleeps.size(), 1u);
+}
+
+TEST_F(LowPowerScan, ActiveColumnResumesScanning) {
+    go_idle();
+    EXPECT_FALSE(run());
+
+    matrix.column = true;
+    EXPECT_TRUE(run(true));
+    EXPECT_EQ(low_power_scan_get_state(), LOW_POWER_SCAN_ACTIVE);
+    EXPECT_FALSE(matrix.selected);
+    EXPECT_TRUE(matrix.wake_pins.empty());
+    EXPECT_EQ(matrix.sleeps.size(), 2u);
+}
+
+TEST_F(LowPowerScan, HeldColumnDoesNotSleep) {
+    go_idle();
+
+    // Pressed while entering the idle mode, before debouncing lets the full scan find it
+    matrix.column = true;
+    low_power_scan_task();
+    EXPECT_EQ(matrix.sleeps.size(), 1u);
+}
+
+TEST_F(LowPowerScan, WakeEventIsNotLost) {
+    go_idle();
+
+    // The column is no longer active once the MCU is awake, the rows are scanned anyway
+    matrix.wake_in_sleep = true;
+    EXPECT_FALSE(run());
+    EXPECT_TRUE(low_power_scan_begin());
+    EXPECT_EQ(low_power_scan_get_state(), LOW_POWER_SCAN_ACTIVE);
+
+    // Nothing was found, so it is straight back to idle, without carrying the wake event over
+    low_power_scan_end(false, false);
+    EXPECT_EQ(low_power_scan_get_state(), LOW_POWER_SCAN_IDLE);
+    matrix.wake_in_sleep = false;
+    EXPECT_FALSE(run());
+}
+
+TEST_F(LowPowerScan, ChangeElsewhereEndsIdle) {
+    go_idle();
+
+    // A key on the other half of a split keyboard, or on an expander, no column of the MCU is active
+    EXPECT_FALSE(run(true, true));
+    EXPECT_EQ(low_power_scan_get_state(), LOW_POWER_SCAN_ACTIVE);
+    EXPECT_FALSE(matrix.selected);
+    EXPECT_EQ(matrix.sleeps.size(), 1u);
+
+    EXPECT_TRUE(run(true));
+    EXPECT_EQ(low_power_scan_get_state(), LOW_POWER_SCAN_ACTIVE);
+}
+
+TEST_F(LowPowerScan, InputActivityEndsIdle) {
+    go_idle();
+
+    // Seen by the keyboard task outside the matrix, such as a pointing device moving
+    matrix.last_input = timer_read32();
+    EXPECT_FALSE(run());
+    EXPECT_EQ(low_power_scan_get_state(), LOW_POWER_SCAN_ACTIVE);
+    EXPECT_EQ(matrix.sleeps.size(), 1u);
+
+    EXPECT_TRUE(run());
+    EXPECT_EQ(low_power_scan_get_state(), LOW_POWER_SCAN_ACTIVE);
+}
+
+TEST_F(LowPowerScan, WakesForTheNextDeadline) {
+    go_idle();
+
+    deadline_set(DEADLINE_CAPS_WORD, 20);
+    EXPECT_FALSE(run());
+    EXPECT_EQ(matrix.sleeps.back(), 20u);
+
+    // An expired deadline does not let the MCU sleep at all
+    EXPECT_FALSE(run());
+    EXPECT_EQ(matrix.sleeps.size(), 2u);
+
+    deadline_clear(DEADLINE_CAPS_WORD);
+    EXPECT_FALSE(run());
+    EXPECT_EQ(matrix.sleeps.back(), (uint32_t)LOW_POWER_SCAN_MAX_SLEEP);
+}
@@ -0,0 +1,14 @@
+low_power_scan_DEFS := -DNO_DEBUG -DNO_PRINT
+
+low_power_scan_CONFIG := $(QUANTUM_PATH)/low_power_scan/tests/config_mock.h
+
+low_power_scan_SRC := \
+    $(QUANTUM_PATH)/low_power_scan/tests/low_power_scan_tests.cpp \
+    $(QUANTUM_PATH)/low_power_scan/low_power_scan.c \
+    $(QUANTUM_PATH)/deadline/deadline.c \
+    $(PLATFORM_PATH)/timer.c \
+    $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+low_power_scan_INC := \
+    $(QUANTUM_PATH)/low_power_scan \
+    $(QUANTUM_PATH)/deadline
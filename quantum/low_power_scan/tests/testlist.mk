@@ -0,0 +1 @@
+TEST_LIST += low_power_scan
@@ -15,6 +15,10 @@
  */
 
 #include "keyboard.h"
+#include "task_profiler/task_profiler.h"
+#ifdef LOW_POWER_SCAN_ENABLE
+#    include "low_power_scan.h"
+#endif
 
 void platform_setup(void);
 
@@ -47,7 +51,7 @@ int main(void) {
     /* Main loop */
     while (true) {
         protocol_pre_task();
-        protocol_keyboard_task();
+        TASK_PROFILE(TASK_PROFILER_KEYBOARD_TASK, protocol_keyboard_task());
         protocol_post_task();
 
 #ifdef RAW_ENABLE
@@ -72,6 +76,15 @@ int main(void) {
         deferred_exec_task();
 #endif // DEFERRED_EXEC_ENABLE
 
-        housekeeping_task();
+        TASK_PROFILE(TASK_PROFILER_HOUSEKEEPING, housekeeping_task());
+
+#ifdef LOW_POWER_SCAN_ENABLE
+        // Sleep while idle, once everything else has run
+        low_power_scan_task();
+#endif
+
+#ifdef TASK_PROFILER_ENABLE
+        task_profiler_task();
+#endif
     }
 }
@@ -31,6 +31,19 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define ROWS_PER_HAND (MATRIX_ROWS)
 #endif
 
+#ifdef EXPANDER_MATRIX_ENABLE
+#    include "expander_matrix.h"
+
+// The expander rows follow the ones wired to MCU pins
+#    define MCU_ROWS_PER_HAND (ROWS_PER_HAND - EXPANDER_MATRIX_ROWS)
+#else
+#    define MCU_ROWS_PER_HAND (ROWS_PER_HAND)
+#endif
+
+#ifdef LOW_POWER_SCAN_ENABLE
+#    include "low_power_scan.h"
+#endif
+
 #ifdef DIRECT_PINS_RIGHT
 #    define SPLIT_MUTABLE
 #else
@@ -52,10 +65,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #endif
 
 #ifdef DIRECT_PINS
-static SPLIT_MUTABLE pin_t direct_pins[ROWS_PER_HAND][MATRIX_COLS] = DIRECT_PINS;
+static SPLIT_MUTABLE pin_t direct_pins[MCU_ROWS_PER_HAND][MATRIX_COLS] = DIRECT_PINS;
 #elif (DIODE_DIRECTION == ROW2COL) || (DIODE_DIRECTION == COL2ROW)
 #    ifdef MATRIX_ROW_PINS
-static SPLIT_MUTABLE_ROW pin_t row_pins[ROWS_PER_HAND] = MATRIX_ROW_PINS;
+static SPLIT_MUTABLE_ROW pin_t row_pins[MCU_ROWS_PER_HAND] = MATRIX_ROW_PINS;
 #    endif // MATRIX_ROW_PINS
 #    ifdef MATRIX_COL_PINS
 static SPLIT_MUTABLE_COL pin_t col_pins[MATRIX_COLS]   = MATRIX_COL_PINS;
@@ -109,7 +122,7 @@ static inline uint8_t readMatrixPin(pin_t pin) {
 #ifdef DIRECT_PINS
 
 __attribute__((weak)) void matrix_init_pins(void) {
-    for (int row = 0; row < ROWS_PER_HAND; row++) {
+    for (int row = 0; row < MCU_ROWS_PER_HAND; row++) {
         for (int col = 0; col < MATRIX_COLS; col++) {
             pin_t pin = direct_pins[row][col];
             if (pin != NO_PIN) {
@@ -133,6 +146,39 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+#    ifdef LOW_POWER_SCAN_ENABLE
+void low_power_scan_matrix_enter(void) {
+    for (uint8_t row = 0; row < MCU_ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (direct_pins[row][col] != NO_PIN) {
+                low_power_scan_wake_enable(direct_pins[row][col]);
+            }
+        }
+    }
+}
+
+void low_power_scan_matrix_exit(void) {
+    for (uint8_t row = 0; row < MCU_ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (direct_pins[row][col] != NO_PIN) {
+                low_power_scan_wake_disable(direct_pins[row][col]);
+            }
+        }
+    }
+}
+
+bool low_power_scan_matrix_active(void) {
+    for (uint8_t row = 0; row < MCU_ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (!readMatrixPin(direct_pins[row][col])) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+#    endif
+
 #elif defined(DIODE_DIRECTION)
 #    if defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
 #        if (DIODE_DIRECTION == COL2ROW)
@@ -158,7 +204,7 @@ static void unselect_row(uint8_t row) {
 }
 
 static void unselect_rows(void) {
-    for (uint8_t x = 0; x < ROWS_PER_HAND; x++) {
+    for (uint8_t x = 0; x < MCU_ROWS_PER_HAND; x++) {
         unselect_row(x);
     }
 }
@@ -198,6 +244,37 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+#            ifdef LOW_POWER_SCAN_ENABLE
+void low_power_scan_matrix_enter(void) {
+    for (uint8_t x = 0; x < MCU_ROWS_PER_HAND; x++) {
+        select_row(x);
+    }
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        if (col_pins[x] != NO_PIN) {
+            low_power_scan_wake_enable(col_pins[x]);
+        }
+    }
+}
+
+void low_power_scan_matrix_exit(void) {
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        if (col_pins[x] != NO_PIN) {
+            low_power_scan_wake_disable(col_pins[x]);
+        }
+    }
+    unselect_rows();
+}
+
+bool low_power_scan_matrix_active(void) {
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        if (!readMatrixPin(col_pins[x])) {
+            return true;
+        }
+    }
+    return false;
+}
+#            endif
+
 #        elif (DIODE_DIRECTION == ROW2COL)
 
 static bool select_col(uint8_t col) {
@@ -228,7 +305,7 @@ static void unselect_cols(void) {
 
 __attribute__((weak)) void matrix_init_pins(void) {
     unselect_cols();
-    for (uint8_t x = 0; x < ROWS_PER_HAND; x++) {
+    for (uint8_t x = 0; x < MCU_ROWS_PER_HAND; x++) {
         if (row_pins[x] != NO_PIN) {
             gpio_atomic_set_pin_input_high(row_pins[x]);
         }
@@ -245,7 +322,7 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
     matrix_output_select_delay();
 
     // For each row...
-    for (uint8_t row_index = 0; row_index < ROWS_PER_HAND; row_index++) {
+    for (uint8_t row_index = 0; row_index < MCU_ROWS_PER_HAND; row_index++) {
         // Check row pin state
         if (readMatrixPin(row_pins[row_index]) == 0) {
             // Pin LO, set col bit
@@ -262,6 +339,37 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
     matrix_output_unselect_delay(current_col, key_pressed); // wait for all Row signals to go HIGH
 }
 
+#            ifdef LOW_POWER_SCAN_ENABLE
+void low_power_scan_matrix_enter(void) {
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        select_col(x);
+    }
+    for (uint8_t x = 0; x < MCU_ROWS_PER_HAND; x++) {
+        if (row_pins[x] != NO_PIN) {
+            low_power_scan_wake_enable(row_pins[x]);
+        }
+    }
+}
+
+void low_power_scan_matrix_exit(void) {
+    for (uint8_t x = 0; x < MCU_ROWS_PER_HAND; x++) {
+        if (row_pins[x] != NO_PIN) {
+            low_power_scan_wake_disable(row_pins[x]);
+        }
+    }
+    unselect_cols();
+}
+
+bool low_power_scan_matrix_active(void) {
+    for (uint8_t x = 0; x < MCU_ROWS_PER_HAND; x++) {
+        if (!readMatrixPin(row_pins[x])) {
+            return true;
+        }
+    }
+    return false;
+}
+#            endif
+
 #        else
 #            error DIODE_DIRECTION must be one of COL2ROW or ROW2COL!
 #        endif
@@ -275,16 +383,16 @@ void matrix_init(void) {
     // Set pinout for right half if pinout for that half is defined
     if (!isLeftHand) {
 #    ifdef DIRECT_PINS_RIGHT
-        const pin_t direct_pins_right[ROWS_PER_HAND][MATRIX_COLS] = DIRECT_PINS_RIGHT;
-        for (uint8_t i = 0; i < ROWS_PER_HAND; i++) {
+        const pin_t direct_pins_right[MCU_ROWS_PER_HAND][MATRIX_COLS] = DIRECT_PINS_RIGHT;
+        for (uint8_t i = 0; i < MCU_ROWS_PER_HAND; i++) {
             for (uint8_t j = 0; j < MATRIX_COLS; j++) {
                 direct_pins[i][j] = direct_pins_right[i][j];
             }
         }
 #    endif
 #    ifdef MATRIX_ROW_PINS_RIGHT
-        const pin_t row_pins_right[ROWS_PER_HAND] = MATRIX_ROW_PINS_RIGHT;
-        for (uint8_t i = 0; i < ROWS_PER_HAND; i++) {
+        const pin_t row_pins_right[MCU_ROWS_PER_HAND] = MATRIX_ROW_PINS_RIGHT;
+        for (uint8_t i = 0; i < MCU_ROWS_PER_HAND; i++) {
             row_pins[i] = row_pins_right[i];
         }
 #    endif
@@ -302,6 +410,12 @@ void matrix_init(void) {
 
     // initialize key pins
     matrix_init_pins();
+#ifdef EXPANDER_MATRIX_ENABLE
+    expander_matrix_init();
+#endif
+#ifdef LOW_POWER_SCAN_ENABLE
+    low_power_scan_init();
+#endif
 
     // initialize matrix state: all keys off
     memset(matrix, 0, sizeof(matrix));
@@ -320,12 +434,10 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 }
 #endif
 
-uint8_t matrix_scan(void) {
-    matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
-
+static void matrix_read_mcu_rows(matrix_row_t curr_matrix[]) {
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
     // Set row, read cols
-    for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
+    for (uint8_t current_row = 0; current_row < MCU_ROWS_PER_HAND; current_row++) {
         matrix_read_cols_on_row(curr_matrix, current_row);
     }
 #elif (DIODE_DIRECTION == ROW2COL)
@@ -335,6 +447,24 @@ uint8_t matrix_scan(void) {
         matrix_read_rows_on_col(curr_matrix, current_col, row_shifter);
     }
 #endif
+}
+
+uint8_t matrix_scan(void) {
+    matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
+
+#ifdef EXPANDER_MATRIX_ENABLE
+    // First, so that a queued expander scan overlaps with the MCU rows
+    expander_matrix_scan(&curr_matrix[MCU_ROWS_PER_HAND]);
+#endif
+
+#ifdef LOW_POWER_SCAN_ENABLE
+    // While idle, the MCU rows are not scanned until a column becomes active
+    if (low_power_scan_begin()) {
+        matrix_read_mcu_rows(curr_matrix);
+    }
+#else
+    matrix_read_mcu_rows(curr_matrix);
+#endif
 
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
@@ -345,5 +475,17 @@ uint8_t matrix_scan(void) {
     changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
     matrix_scan_kb();
 #endif
+
+#ifdef LOW_POWER_SCAN_ENABLE
+    // Both the raw and the debounced rows, so that neither a key being debounced nor a key on the other half is left out
+    bool keys_down = false;
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        keys_down |= raw_matrix[row] != 0;
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        keys_down |= matrix[row] != 0;
+    }
+    low_power_scan_end(changed, keys_down);
+#endif
     return (uint8_t)changed;
 }
@@ -47,8 +47,10 @@ extern "C" {
  */
 
 #include "midi_function_types.h"
-#include "bytequeue/bytequeue.h"
-#define MIDI_INPUT_QUEUE_LENGTH 192
+#include "spsc_ring.h"
+#define MIDI_INPUT_QUEUE_LENGTH 256
+
+SPSC_RING_DECLARE(midi_input_ring, uint8_t, MIDI_INPUT_QUEUE_LENGTH)
 
 typedef enum { IDLE, ONE_BYTE_MESSAGE = 1, TWO_BYTE_MESSAGE = 2, THREE_BYTE_MESSAGE = 3, SYSEX_MESSAGE } input_state_t;
 
@@ -102,8 +104,7 @@ struct _midi_device {
     uint16_t      input_count;
 
     // for queueing data between the input and the processing functions
-    uint8_t     input_queue_data[MIDI_INPUT_QUEUE_LENGTH];
-    byteQueue_t input_queue;
+    midi_input_ring_t input_queue;
 };
 
 /**
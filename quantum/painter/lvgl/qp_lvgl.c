@@ -7,6 +7,16 @@
 #include "deferred_exec.h"
 #include "lvgl.h"
 
+#ifdef QUANTUM_PAINTER_SURFACE_ENABLE
+#    include "qp_surface_internal.h"
+#endif // QUANTUM_PAINTER_SURFACE_ENABLE
+
+#ifdef QP_LVGL_DOUBLE_BUFFER
+#    define QP_LVGL_NUM_BUFFERS 2
+#else // QP_LVGL_DOUBLE_BUFFER
+#    define QP_LVGL_NUM_BUFFERS 1
+#endif // QP_LVGL_DOUBLE_BUFFER
+
 typedef struct lvgl_state_t {
     uint8_t        fnc_id; // Ideally this should be the pointer of the function to run
     uint16_t       delay_ms;
@@ -16,21 +26,90 @@ typedef struct lvgl_state_t {
 static deferred_executor_t lvgl_executors[2] = {0}; // For lv_tick_inc and lv_task_handler
 static lvgl_state_t        lvgl_states[2]    = {0}; // For lv_tick_inc and lv_task_handler
 
+typedef struct lvgl_flush_state_t {
+    lv_disp_drv_t *   disp;       // set while an area is still being sent to the display
+    const lv_color_t *pixel_data; // pixels of the next row to send
+    lv_area_t         area;       // rows left to send
+} lvgl_flush_state_t;
+
+static lvgl_flush_state_t pending_flush = {0};
+
 painter_device_t selected_display = NULL;
 void *           color_buffer     = NULL;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter LVGL Integration Internal: qp_lvgl_flush
 
+// Sends whole rows of the pending area, up to max_pixels but at least one row, handing its buffer back to LVGL once all
+// of it has been sent. Animations and other drawing may move the display's viewport in between, so each chunk sets it.
+static void qp_lvgl_flush_pending(uint32_t max_pixels) {
+    if (!pending_flush.disp) {
+        return;
+    }
+
+    lv_area_t *area      = &pending_flush.area;
+    uint32_t   width     = area->x2 - area->x1 + 1;
+    uint32_t   row_count = QP_MIN((uint32_t)(area->y2 - area->y1 + 1), QP_MAX(max_pixels / width, 1));
+    qp_viewport(selected_display, area->x1, area->y1, area->x2, area->y1 + row_count - 1);
+    qp_pixdata(selected_display, (void *)pending_flush.pixel_data, width * row_count);
+    pending_flush.pixel_data += width * row_count;
+    area->y1 += row_count;
+
+    if (area->y1 > area->y2) {
+        lv_disp_drv_t *disp = pending_flush.disp;
+        pending_flush.disp  = NULL;
+        lv_disp_flush_ready(disp);
+    }
+}
+
+// LVGL needs the buffer that is still being sent -- finish sending it straight away
+static void qp_lvgl_wait(lv_disp_drv_t *disp) {
+    qp_lvgl_flush_pending(UINT32_MAX);
+}
+
+// The display itself is flushed by the Quantum Painter task after LVGL has run, once for all of the areas LVGL refreshed
 void qp_lvgl_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
     if (selected_display) {
+#ifdef QP_LVGL_DOUBLE_BUFFER
+        // Sent in chunks by qp_lvgl_internal_tick(), while LVGL renders the next area into the other buffer
+        pending_flush.disp       = disp;
+        pending_flush.pixel_data = color_p;
+        pending_flush.area       = *area;
+#else  // QP_LVGL_DOUBLE_BUFFER
         uint32_t number_pixels = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
         qp_viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
         qp_pixdata(selected_display, (void *)color_p, number_pixels);
-        qp_flush(selected_display);
         lv_disp_flush_ready(disp);
+#endif // QP_LVGL_DOUBLE_BUFFER
+    }
+}
+
+#if defined(QUANTUM_PAINTER_SURFACE_ENABLE) && LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 1
+// LVGL has already rendered into the surface's framebuffer, only the dirty region needs updating
+static void qp_lvgl_flush_surface(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
+    if (selected_display) {
+        surface_painter_device_t *surface = (surface_painter_device_t *)selected_display;
+        qp_surface_update_dirty(&surface->dirty, area->x1, area->y1);
+        qp_surface_update_dirty(&surface->dirty, area->x2, area->y2);
+    }
+    lv_disp_flush_ready(disp);
+}
+
+// Lets LVGL render straight into an unrotated RGB565 surface, which stores its pixels in the same format
+static bool qp_lvgl_setup_surface(painter_driver_t *driver, lv_disp_drv_t *disp_drv, lv_disp_draw_buf_t *draw_buf) {
+    if (driver->driver_vtable != (const painter_driver_vtable_t *)&rgb565_surface_driver_vtable || driver->rotation != QP_ROTATION_0) {
+        return false;
     }
+    lv_disp_draw_buf_init(draw_buf, ((surface_painter_device_t *)driver)->buffer, NULL, driver->panel_width * driver->panel_height);
+    disp_drv->direct_mode = 1;
+    disp_drv->flush_cb    = qp_lvgl_flush_surface;
+    return true;
+}
+#else  // defined(QUANTUM_PAINTER_SURFACE_ENABLE) && LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 1
+static bool qp_lvgl_setup_surface(painter_driver_t *driver, lv_disp_drv_t *disp_drv, lv_disp_draw_buf_t *draw_buf) {
+    return false;
 }
+#endif // defined(QUANTUM_PAINTER_SURFACE_ENABLE) && LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 1
 
 static uint32_t tick_task_callback(uint32_t trigger_time, void *cb_arg) {
     lvgl_state_t *  state     = (lvgl_state_t *)cb_arg;
@@ -93,34 +172,39 @@ bool qp_lvgl_attach(painter_device_t device) {
     // Init LVGL
     lv_init();
 
-    // Set up lvgl display buffer
-    static lv_disp_draw_buf_t draw_buf;
-    // Allocate a buffer for 1/10 screen size
-    const size_t count_required   = driver->panel_width * driver->panel_height / 10;
-    void *       new_color_buffer = realloc(color_buffer, sizeof(lv_color_t) * count_required);
-    if (!new_color_buffer) {
-        qp_dprintf("qp_lvgl_attach: fail (could not set up memory buffer)\n");
-        qp_lvgl_detach();
-        return false;
-    }
-    color_buffer = new_color_buffer;
-    memset(color_buffer, 0, sizeof(lv_color_t) * count_required);
-    // Initialize the display buffer.
-    lv_disp_draw_buf_init(&draw_buf, color_buffer, NULL, count_required);
-
-    selected_display = device;
-
     uint16_t panel_width, panel_height, offset_x, offset_y;
-    qp_get_geometry(selected_display, &panel_width, &panel_height, NULL, &offset_x, &offset_y);
+    qp_get_geometry(device, &panel_width, &panel_height, NULL, &offset_x, &offset_y);
 
     // Setting up display driver
     static lv_disp_drv_t disp_drv;     /*Descriptor of a display driver*/
     lv_disp_drv_init(&disp_drv);       /*Basic initialization*/
     disp_drv.flush_cb = qp_lvgl_flush; /*Set your driver function*/
-    disp_drv.draw_buf = &draw_buf;     /*Assign the buffer to the display*/
-    disp_drv.hor_res  = panel_width;   /*Set the horizontal resolution of the display*/
-    disp_drv.ver_res  = panel_height;  /*Set the vertical resolution of the display*/
-    lv_disp_drv_register(&disp_drv);   /*Finally register the driver*/
+    disp_drv.wait_cb  = qp_lvgl_wait;  /*Called while LVGL waits for a buffer to be sent*/
+
+    // Set up lvgl display buffer
+    static lv_disp_draw_buf_t draw_buf;
+    if (!qp_lvgl_setup_surface(driver, &disp_drv, &draw_buf)) {
+        // Allocate a buffer for 1/10 screen size, or two of them when double buffered
+        const size_t count_required   = driver->panel_width * driver->panel_height / 10;
+        void *       new_color_buffer = realloc(color_buffer, sizeof(lv_color_t) * count_required * QP_LVGL_NUM_BUFFERS);
+        if (!new_color_buffer) {
+            qp_dprintf("qp_lvgl_attach: fail (could not set up memory buffer)\n");
+            qp_lvgl_detach();
+            return false;
+        }
+        color_buffer = new_color_buffer;
+        memset(color_buffer, 0, sizeof(lv_color_t) * count_required * QP_LVGL_NUM_BUFFERS);
+        // Initialize the display buffer.
+        lv_color_t *second_buffer = QP_LVGL_NUM_BUFFERS > 1 ? (lv_color_t *)color_buffer + count_required : NULL;
+        lv_disp_draw_buf_init(&draw_buf, color_buffer, second_buffer, count_required);
+    }
+
+    selected_display = device;
+
+    disp_drv.draw_buf = &draw_buf;    /*Assign the buffer to the display*/
+    disp_drv.hor_res  = panel_width;  /*Set the horizontal resolution of the display*/
+    disp_drv.ver_res  = panel_height; /*Set the vertical resolution of the display*/
+    lv_disp_drv_register(&disp_drv);  /*Finally register the driver*/
 
     return true;
 }
@@ -136,7 +220,8 @@ void qp_lvgl_detach(void) {
         free(color_buffer);
         color_buffer = NULL;
     }
-    selected_display = NULL;
+    pending_flush.disp = NULL;
+    selected_display   = NULL;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -145,4 +230,7 @@ void qp_lvgl_detach(void) {
 void qp_lvgl_internal_tick(void) {
     static uint32_t last_lvgl_exec = 0;
     deferred_exec_advanced_task(lvgl_executors, 2, &last_lvgl_exec);
+
+    // Keep sending the area LVGL has handed over, a chunk at a time so the rest of the keyboard is not held up
+    qp_lvgl_flush_pending(QP_LVGL_FLUSH_CHUNK_PIXELS);
 }
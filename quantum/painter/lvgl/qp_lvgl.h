@@ -11,6 +11,12 @@
 #    define QP_LVGL_TASK_PERIOD 5
 #endif
 
+// Number of pixels sent to the display per Quantum Painter task run, when QP_LVGL_DOUBLE_BUFFER is defined, rounded down
+// to whole rows of the area being sent, and at least one row
+#ifndef QP_LVGL_FLUSH_CHUNK_PIXELS
+#    define QP_LVGL_FLUSH_CHUNK_PIXELS 1024
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter - LVGL External API
 
@@ -27,10 +27,17 @@ bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 // qp_rect internal implementation, but uses the global pixdata buffer with pre-converted native pixels.
 bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 
+// Number of pixels (or native pixel bytes) decoded at a time. Must be a multiple of 8, so that a block never ends part way through an input byte.
+#ifndef QP_INTERNAL_DECODE_BLOCK_SIZE
+#    define QP_INTERNAL_DECODE_BLOCK_SIZE 64
+#endif
+
 // Convert from input pixel data + palette to equivalent pixels
-typedef int16_t (*qp_internal_byte_input_callback)(void* cb_arg);
-typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t index, void* cb_arg);
-typedef bool (*qp_internal_byte_output_callback)(uint8_t byte, void* cb_arg);
+//     - input callbacks fill the buffer with up to `length` decoded bytes, returning how many were written -- fewer means the input is exhausted
+//     - output callbacks receive spans of palette indices, or native pixel bytes
+typedef uint32_t (*qp_internal_byte_input_callback)(void* cb_arg, uint8_t* buffer, uint32_t length);
+typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t* palette_indices, uint32_t pixel_count, void* cb_arg);
+typedef bool (*qp_internal_byte_output_callback)(const uint8_t* bytes, uint32_t byte_count, void* cb_arg);
 bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_callback output_callback, void* output_arg);
 bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_pixel_output_callback output_callback, void* output_arg);
 bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_pixel_output_callback output_callback, void* output_arg);
@@ -61,8 +68,12 @@ enum qp_internal_rle_mode_t {
     MARKER_BYTE,
     REPEATING_RUN,
     NON_REPEATING_RUN,
+    BACK_REFERENCE,
 };
 
+// Size of the LZ history window, matching the single offset byte of a back-reference
+#define QP_INTERNAL_LZ_WINDOW_SIZE 256
+
 typedef struct qp_internal_byte_input_state_t {
     painter_device_t device;
     qp_stream_t*     src_stream;
@@ -73,6 +84,13 @@ typedef struct qp_internal_byte_input_state_t {
             enum qp_internal_rle_mode_t mode;
             uint8_t                     remain; // number of bytes remaining in the current mode
         } rle;
+        // LZ-specific
+        struct {
+            enum qp_internal_rle_mode_t mode;
+            uint8_t                     remain;     // number of bytes remaining in the current literal run or back-reference
+            uint8_t                     offset;     // distance of the current back-reference, minus one
+            uint8_t                     window_pos; // write position in the history window, wraps with the window size
+        } lz;
     };
 } qp_internal_byte_input_state_t;
 
@@ -82,7 +100,7 @@ typedef struct qp_internal_pixel_output_state_t {
     uint32_t         max_pixels;
 } qp_internal_pixel_output_state_t;
 
-bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg);
+bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t* palette_indices, uint32_t pixel_count, void* cb_arg);
 
 typedef struct qp_internal_byte_output_state_t {
     painter_device_t device;
@@ -90,7 +108,7 @@ typedef struct qp_internal_byte_output_state_t {
     uint32_t         max_bytes;
 } qp_internal_byte_output_state_t;
 
-bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg);
+bool qp_internal_byte_appender(const uint8_t* bytes, uint32_t byte_count, void* cb_arg);
 
 // Helper shared between image and font rendering, sends pixels to the display using:
 //     - qp_internal_decode_palette + qp_internal_pixel_appender (bpp <= 8)
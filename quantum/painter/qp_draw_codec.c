@@ -6,6 +6,12 @@
 #include "qp_draw.h"
 #include "qp_comms.h"
 
+_Static_assert((QP_INTERNAL_DECODE_BLOCK_SIZE > 0) && (QP_INTERNAL_DECODE_BLOCK_SIZE % 8) == 0, "QP_INTERNAL_DECODE_BLOCK_SIZE needs to be a non-zero multiple of 8");
+_Static_assert(QP_INTERNAL_LZ_WINDOW_SIZE == 256, "The LZ window position relies on wrapping at 256");
+
+// History of the bytes decoded so far, referenced by LZ back-references. Global so that it stays off the stack.
+static uint8_t qp_internal_lz_window[QP_INTERNAL_LZ_WINDOW_SIZE];
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Palette / Monochrome-format decoder
 
@@ -29,23 +35,65 @@ bool qp_internal_bpp_capable(uint8_t bits_per_pixel) {
     return true;
 }
 
+// Splits packed pixels into one palette index per pixel, lowest bits first. Inlined with a constant bpp for the common cases, so the per-byte loop unrolls.
+static inline __attribute__((always_inline)) void qp_internal_unpack_palette_indices(uint8_t* palette_indices, const uint8_t* bytes, uint32_t pixel_count, const uint8_t bits_per_pixel) {
+    const uint8_t pixel_bitmask   = (1 << bits_per_pixel) - 1;
+    const uint8_t pixels_per_byte = 8 / bits_per_pixel;
+    while (pixel_count >= pixels_per_byte) {
+        uint8_t byteval = *bytes++;
+        for (uint8_t q = 0; q < pixels_per_byte; ++q) {
+            *palette_indices++ = byteval & pixel_bitmask;
+            byteval >>= bits_per_pixel;
+        }
+        pixel_count -= pixels_per_byte;
+    }
+
+    // A trailing byte that isn't entirely used
+    if (pixel_count > 0) {
+        uint8_t byteval = *bytes;
+        while (pixel_count-- > 0) {
+            *palette_indices++ = byteval & pixel_bitmask;
+            byteval >>= bits_per_pixel;
+        }
+    }
+}
+
 bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_callback output_callback, void* output_arg) {
-    const uint8_t pixel_bitmask    = (1 << bits_per_pixel) - 1;
+    uint8_t       palette_indices[QP_INTERNAL_DECODE_BLOCK_SIZE];
+    uint8_t       packed[QP_INTERNAL_DECODE_BLOCK_SIZE];
     const uint8_t pixels_per_byte  = 8 / bits_per_pixel;
     uint32_t      remaining_pixels = pixel_count; // don't try to derive from byte_count, we may not use an entire byte
     while (remaining_pixels > 0) {
-        int16_t byteval = input_callback(input_arg);
-        if (byteval < 0) {
-            return false;
-        }
-        uint8_t loop_pixels = remaining_pixels < pixels_per_byte ? remaining_pixels : pixels_per_byte;
-        for (uint8_t q = 0; q < loop_pixels; ++q) {
-            if (!output_callback(palette, byteval & pixel_bitmask, output_arg)) {
+        uint32_t block_pixels = QP_MIN(remaining_pixels, QP_INTERNAL_DECODE_BLOCK_SIZE);
+        uint32_t block_bytes  = (block_pixels + pixels_per_byte - 1) / pixels_per_byte;
+        if (bits_per_pixel == 8) {
+            // Already one index per byte
+            if (input_callback(input_arg, palette_indices, block_bytes) != block_bytes) {
                 return false;
             }
-            byteval >>= bits_per_pixel;
+        } else {
+            if (input_callback(input_arg, packed, block_bytes) != block_bytes) {
+                return false;
+            }
+            switch (bits_per_pixel) {
+                case 1:
+                    qp_internal_unpack_palette_indices(palette_indices, packed, block_pixels, 1);
+                    break;
+                case 2:
+                    qp_internal_unpack_palette_indices(palette_indices, packed, block_pixels, 2);
+                    break;
+                case 4:
+                    qp_internal_unpack_palette_indices(palette_indices, packed, block_pixels, 4);
+                    break;
+                default:
+                    qp_internal_unpack_palette_indices(palette_indices, packed, block_pixels, bits_per_pixel);
+                    break;
+            }
+        }
+        if (!output_callback(palette, palette_indices, block_pixels, output_arg)) {
+            return false;
         }
-        remaining_pixels -= loop_pixels;
+        remaining_pixels -= block_pixels;
     }
     return true;
 }
@@ -67,99 +115,172 @@ bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, u
 }
 
 bool qp_internal_send_bytes(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_byte_output_callback output_callback, void* output_arg) {
+    uint8_t  bytes[QP_INTERNAL_DECODE_BLOCK_SIZE];
     uint32_t remaining_bytes = byte_count;
     while (remaining_bytes > 0) {
-        int16_t byteval = input_callback(input_arg);
-        if (byteval < 0) {
+        uint32_t block_bytes = QP_MIN(remaining_bytes, QP_INTERNAL_DECODE_BLOCK_SIZE);
+        if (input_callback(input_arg, bytes, block_bytes) != block_bytes) {
             return false;
         }
-        if (!output_callback(byteval, output_arg)) {
+        if (!output_callback(bytes, block_bytes, output_arg)) {
             return false;
         }
-        remaining_bytes -= 1;
+        remaining_bytes -= block_bytes;
     }
     return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Progressive pull of bytes, push of pixels
+// Progressive pull of byte blocks, push of pixel spans
 
-static inline int16_t qp_drawimage_byte_uncompressed_decoder(void* cb_arg) {
+static uint32_t qp_drawimage_byte_uncompressed_decoder(void* cb_arg, uint8_t* buffer, uint32_t length) {
     qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
-    state->curr                           = qp_stream_get(state->src_stream);
-    return state->curr;
+    return qp_stream_read(buffer, 1, length, state->src_stream);
 }
 
-static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
-    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
+static uint32_t qp_drawimage_byte_rle_decoder(void* cb_arg, uint8_t* buffer, uint32_t length) {
+    qp_internal_byte_input_state_t* state    = (qp_internal_byte_input_state_t*)cb_arg;
+    uint32_t                        produced = 0;
 
-    // Work out if we're parsing the initial marker byte
-    if (state->rle.mode == MARKER_BYTE) {
-        uint8_t c = qp_stream_get(state->src_stream);
-        if (c >= 128) {
-            state->rle.mode   = NON_REPEATING_RUN; // non-repeated run
-            state->rle.remain = c - 127;
-        } else {
-            state->rle.mode   = REPEATING_RUN; // repeated run
-            state->rle.remain = c;
+    while (produced < length) {
+        // Work out if we're parsing the initial marker byte
+        if (state->rle.mode == MARKER_BYTE) {
+            int16_t c = qp_stream_get(state->src_stream);
+            if (c < 0) {
+                break;
+            }
+            if (c >= 128) {
+                state->rle.mode   = NON_REPEATING_RUN; // non-repeated run
+                state->rle.remain = c - 127;
+            } else {
+                state->rle.mode   = REPEATING_RUN; // repeated run
+                state->rle.remain = c;
+                state->curr       = qp_stream_get(state->src_stream);
+                if (state->curr < 0) {
+                    break;
+                }
+            }
+        }
+
+        // Copy out as much of the current run as fits
+        uint32_t run = QP_MIN(state->rle.remain, length - produced);
+        if (state->rle.mode == REPEATING_RUN) {
+            memset(&buffer[produced], state->curr, run);
+        } else if (qp_stream_read(&buffer[produced], 1, run, state->src_stream) != run) {
+            break;
         }
+        produced += run;
 
-        state->curr = qp_stream_get(state->src_stream);
+        // Swap back to querying the marker byte mode once the run is consumed
+        state->rle.remain -= run;
+        if (state->rle.remain == 0) {
+            state->rle.mode = MARKER_BYTE;
+        }
     }
 
-    // Work out which byte we're returning
-    uint8_t c = state->curr;
+    return produced;
+}
 
-    // Decrement the counter of the bytes remaining
-    state->rle.remain--;
+static uint32_t qp_drawimage_byte_lz_decoder(void* cb_arg, uint8_t* buffer, uint32_t length) {
+    qp_internal_byte_input_state_t* state    = (qp_internal_byte_input_state_t*)cb_arg;
+    uint32_t                        produced = 0;
 
-    if (state->rle.remain > 0) {
-        // If we're in a non-repeating run, queue up the next byte
-        if (state->rle.mode == NON_REPEATING_RUN) {
-            state->curr = qp_stream_get(state->src_stream);
+    while (produced < length) {
+        // Work out if we're parsing the initial marker byte
+        if (state->lz.mode == MARKER_BYTE) {
+            int16_t c = qp_stream_get(state->src_stream);
+            if (c < 0) {
+                break;
+            }
+            if (c < 128) {
+                state->lz.mode   = NON_REPEATING_RUN; // literal run
+                state->lz.remain = c + 1;
+            } else {
+                int16_t offset = qp_stream_get(state->src_stream);
+                if (offset < 0) {
+                    break;
+                }
+                state->lz.mode   = BACK_REFERENCE; // copy of earlier output, may overlap itself
+                state->lz.remain = c - 125;
+                state->lz.offset = offset;
+            }
+        }
+
+        // Copy out as much of the current run as fits, keeping the history window up to date
+        uint32_t run = QP_MIN(state->lz.remain, length - produced);
+        uint8_t* out = &buffer[produced];
+        uint8_t  pos = state->lz.window_pos;
+        if (state->lz.mode == BACK_REFERENCE) {
+            uint8_t from = pos - state->lz.offset - 1;
+            for (uint32_t i = 0; i < run; ++i) {
+                uint8_t b                    = qp_internal_lz_window[from++];
+                qp_internal_lz_window[pos++] = b;
+                out[i]                       = b;
+            }
+        } else {
+            if (qp_stream_read(out, 1, run, state->src_stream) != run) {
+                break;
+            }
+            uint32_t head = QP_MIN(run, QP_INTERNAL_LZ_WINDOW_SIZE - pos);
+            memcpy(&qp_internal_lz_window[pos], out, head);
+            memcpy(qp_internal_lz_window, &out[head], run - head);
+            pos += run;
+        }
+        state->lz.window_pos = pos;
+        produced += run;
+
+        // Swap back to querying the marker byte mode once the run is consumed
+        state->lz.remain -= run;
+        if (state->lz.remain == 0) {
+            state->lz.mode = MARKER_BYTE;
         }
-    } else {
-        // Swap back to querying the marker byte mode
-        state->rle.mode = MARKER_BYTE;
     }
 
-    return c;
+    return produced;
 }
 
-bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
+bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t* palette_indices, uint32_t pixel_count, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
 
-    if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos++, 1, &index)) {
-        return false;
-    }
-
-    // If we've hit the transmit limit, send out the entire buffer and reset the write position
-    if (state->pixel_write_pos == state->max_pixels) {
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+    while (pixel_count > 0) {
+        // Convert as much of the span as fits in the buffer in one go
+        uint32_t span = QP_MIN(pixel_count, state->max_pixels - state->pixel_write_pos);
+        if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos, span, palette_indices)) {
             return false;
         }
-        state->pixel_write_pos = 0;
+        state->pixel_write_pos += span;
+        palette_indices += span;
+        pixel_count -= span;
+
+        // If we've hit the transmit limit, send out the entire buffer and reset the write position
+        if (state->pixel_write_pos == state->max_pixels) {
+            if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+                return false;
+            }
+            state->pixel_write_pos = 0;
+        }
     }
 
     return true;
 }
 
-bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
+bool qp_internal_byte_appender(const uint8_t* bytes, uint32_t byte_count, void* cb_arg) {
     qp_internal_byte_output_state_t* state  = (qp_internal_byte_output_state_t*)cb_arg;
     painter_driver_t*                driver = (painter_driver_t*)state->device;
 
-    if (!driver->driver_vtable->append_pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos++, byteval)) {
-        return false;
-    }
-
-    // If we've hit the transmit limit, send out the entire buffer and reset the write position
-    if (state->byte_write_pos == state->max_bytes) {
-        painter_driver_t* driver = (painter_driver_t*)state->device;
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+    for (uint32_t i = 0; i < byte_count; ++i) {
+        if (!driver->driver_vtable->append_pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos++, bytes[i])) {
             return false;
         }
-        state->byte_write_pos = 0;
+
+        // If we've hit the transmit limit, send out the entire buffer and reset the write position
+        if (state->byte_write_pos == state->max_bytes) {
+            if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+                return false;
+            }
+            state->byte_write_pos = 0;
+        }
     }
 
     return true;
@@ -212,6 +333,12 @@ qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte
             input_state->rle.mode   = MARKER_BYTE;
             input_state->rle.remain = 0;
             return qp_drawimage_byte_rle_decoder;
+        case IMAGE_COMPRESSED_LZ:
+            // Back-references never reach past the start of the data, so the window contents are irrelevant
+            input_state->lz.mode       = MARKER_BYTE;
+            input_state->lz.remain     = 0;
+            input_state->lz.window_pos = 0;
+            return qp_drawimage_byte_lz_decoder;
         default:
             return NULL;
     }
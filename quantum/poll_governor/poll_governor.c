@@ -0,0 +1,230 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "poll_governor.h"
+#include "atomic_util.h"
+#include "timer.h"
+#include "debug.h"
+
+// Plausible SOF periods, high speed frames are 125us and full speed ones 1ms
+#define FRAME_US_MIN 100
+#define FRAME_US_MAX 1100
+// Gaps longer than this many frames (e.g. suspend) invalidate the poll timing
+#define FRAME_GAP_MAX 64
+
+typedef struct {
+    uint32_t last_sof_us;
+    uint32_t frame;       // number of the frame started by the last SOF
+    uint32_t frame_us_q4; // frame period in 1/16us, 0 if unknown
+    uint32_t poll_frame;  // frame the last poll happened in
+    uint16_t phase_us;    // offset of the polls within their frame
+    uint16_t interval;    // poll interval in frames, 0 if unknown
+    uint8_t  samples;     // number of poll distances the interval is based on
+    bool     sof_seen;
+    bool     polled;
+} poll_governor_state_t;
+
+static volatile poll_governor_state_t state;
+
+static uint16_t gcd(uint16_t a, uint16_t b) {
+    while (b) {
+        uint16_t t = a % b;
+        a          = b;
+        b          = t;
+    }
+    return a;
+}
+
+static uint32_t last_scan_us  = 0;
+static uint32_t scan_target   = 0;
+static bool     scan_targeted = false;
+
+void poll_governor_reset(void) {
+    state.frame_us_q4  = 0;
+    state.interval     = 0;
+    state.samples      = 0;
+    state.sof_seen     = false;
+    state.polled       = false;
+    scan_targeted      = false;
+}
+
+void poll_governor_sof(uint32_t now_us) {
+    if (state.sof_seen) {
+        uint32_t delta = now_us - state.last_sof_us;
+        if (delta >= FRAME_US_MIN && delta <= FRAME_US_MAX) {
+            uint32_t delta_q4 = delta << 4;
+            if (state.frame_us_q4 == 0) {
+                state.frame_us_q4 = delta_q4;
+            } else {
+                // slow moving average, this only has to track the clock skew against the host
+                state.frame_us_q4 = state.frame_us_q4 - (state.frame_us_q4 >> 3) + (delta_q4 >> 3);
+            }
+            state.frame++;
+        } else if (state.frame_us_q4 != 0 && delta < (FRAME_GAP_MAX * state.frame_us_q4) >> 4) {
+            // missed a few SOFs, keep counting whole frames
+            state.frame += ((delta << 4) + (state.frame_us_q4 >> 1)) / state.frame_us_q4;
+        } else {
+            // no usable reference to the previous frames
+            state.frame++;
+            state.polled   = false;
+            state.interval = 0;
+            state.samples  = 0;
+        }
+    } else {
+        state.frame++;
+    }
+    state.last_sof_us = now_us;
+    state.sof_seen    = true;
+}
+
+void poll_governor_poll(uint32_t now_us) {
+    if (!state.sof_seen || state.frame_us_q4 == 0) {
+        return;
+    }
+
+    uint32_t frame_us = state.frame_us_q4 >> 4;
+    uint32_t offset   = now_us - state.last_sof_us;
+    uint32_t frame    = state.frame + offset / frame_us;
+    offset %= frame_us;
+
+    if (state.polled) {
+        uint32_t frames = frame - state.poll_frame;
+        if (frames > 0 && frames <= UINT16_MAX) {
+            // reports are only picked up while there is something to send, so
+            // polls are seen at arbitrary multiples of the actual interval;
+            // their common divisor converges on it, and only ever errs short
+            state.interval = gcd(state.interval, frames);
+            if (state.samples < UINT8_MAX) {
+                state.samples++;
+            }
+        }
+        state.phase_us = (int32_t)state.phase_us + ((int32_t)offset - (int32_t)state.phase_us) / 4;
+    } else {
+        state.phase_us = offset;
+    }
+
+    state.poll_frame = frame;
+    state.polled     = true;
+}
+
+static bool synced(const poll_governor_state_t *s, uint32_t now_us) {
+    return s->sof_seen && s->polled && s->samples >= POLL_GOVERNOR_MIN_SAMPLES && s->frame_us_q4 != 0 && (now_us - s->last_sof_us) <= (4 * s->frame_us_q4) >> 4;
+}
+
+static void snapshot(poll_governor_state_t *s) {
+    ATOMIC_BLOCK_FORCEON {
+        *s = *(poll_governor_state_t *)&state;
+    }
+}
+
+/** \brief Predicts the first poll strictly after now_us, from the frame timing and the phase of past polls */
+static bool predict_next_poll(const poll_governor_state_t *s, uint32_t now_us, uint32_t *next_us) {
+    if (!synced(s, now_us)) {
+        return false;
+    }
+
+    uint32_t frame_us    = s->frame_us_q4 >> 4;
+    uint32_t cur_frame   = s->frame + (now_us - s->last_sof_us) / frame_us;
+    uint32_t since       = cur_frame - s->poll_frame;
+    uint32_t poll_frame  = s->poll_frame + (since / s->interval) * s->interval;
+    int32_t  frame_delta = (int32_t)(poll_frame - s->frame);
+
+    uint32_t next = s->last_sof_us + (int32_t)(frame_delta * (int32_t)s->frame_us_q4) / 16 + s->phase_us;
+    if ((int32_t)(next - now_us) <= 0) {
+        next += (s->interval * s->frame_us_q4) >> 4;
+    }
+    *next_us = next;
+    return true;
+}
+
+bool poll_governor_scan_due_at(uint32_t now_us) {
+    poll_governor_state_t s;
+    uint32_t              next;
+
+    snapshot(&s);
+    if (!predict_next_poll(&s, now_us, &next)) {
+        last_scan_us = now_us;
+        return true;
+    }
+
+    uint32_t interval_us = (s.interval * s.frame_us_q4) >> 4;
+    uint32_t until_poll  = next - now_us;
+
+    // the same poll predicted from slightly different timing information
+    bool targeted = scan_targeted && (uint32_t)(next - scan_target + interval_us / 2) < interval_us;
+
+    if (until_poll <= POLL_GOVERNOR_SCAN_LEAD_US && !targeted) {
+        scan_target   = next;
+        scan_targeted = true;
+    } else if (now_us - last_scan_us < interval_us) {
+        return false;
+    }
+
+    last_scan_us = now_us;
+    return true;
+}
+
+bool poll_governor_scan_due(void) {
+    return poll_governor_scan_due_at(poll_governor_timestamp_us());
+}
+
+int32_t poll_governor_time_to_next_poll(uint32_t now_us) {
+    poll_governor_state_t s;
+    uint32_t              next;
+
+    snapshot(&s);
+    if (!predict_next_poll(&s, now_us, &next)) {
+        return -1;
+    }
+    return next - now_us;
+}
+
+bool poll_governor_is_synced(uint32_t now_us) {
+    poll_governor_state_t s;
+    snapshot(&s);
+    return synced(&s, now_us);
+}
+
+uint16_t poll_governor_get_frame_us(void) {
+    poll_governor_state_t s;
+    snapshot(&s);
+    return (s.frame_us_q4 + 8) >> 4;
+}
+
+uint32_t poll_governor_get_interval_us(void) {
+    poll_governor_state_t s;
+    snapshot(&s);
+    if (!s.polled || s.samples < POLL_GOVERNOR_MIN_SAMPLES) {
+        return 0;
+    }
+    return (s.interval * s.frame_us_q4 + 8) >> 4;
+}
+
+uint16_t poll_governor_get_rate_hz(void) {
+    poll_governor_state_t s;
+    snapshot(&s);
+    if (!s.polled || s.samples < POLL_GOVERNOR_MIN_SAMPLES || s.frame_us_q4 == 0) {
+        return 0;
+    }
+    // snap to whole high speed microframes, so the clock skew does not show up as a rate change
+    uint32_t frame_us = (((s.frame_us_q4 >> 4) + 62) / 125) * 125;
+    return 1000000UL / (s.interval * frame_us);
+}
+
+void poll_governor_task(void) {
+    static uint16_t last_rate = 0;
+
+    uint16_t rate = poll_governor_get_rate_hz();
+    if (rate != last_rate) {
+        last_rate = rate;
+        if (rate) {
+            dprintf("poll governor: host polls every %luus (%uHz)\n", (unsigned long)poll_governor_get_interval_us(), rate);
+        } else {
+            dprintf("poll governor: lost sync\n");
+        }
+    }
+}
+
+__attribute__((weak)) uint32_t poll_governor_timestamp_us(void) {
+    return timer_read32() * 1000UL;
+}
@@ -0,0 +1,111 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    The poll governor tracks when the host polls the keyboard endpoint, and
+    paces the matrix scan so it happens just ahead of the next poll. This keeps
+    the report as fresh as possible when the host picks it up, instead of
+    scanning as fast as the main loop runs.
+
+    The USB driver feeds it with:
+      - poll_governor_sof(), on every Start-of-Frame, giving the frame period
+        and a drift-free time reference
+      - poll_governor_poll(), whenever a report on the keyboard endpoint has
+        been picked up by the host, giving the poll interval and its phase
+        within the frame
+
+    Without those (no USB connection, suspend, platforms without SOF support)
+    the governor never holds back a scan.
+*/
+
+// How long before the predicted poll the matrix is scanned
+#ifndef POLL_GOVERNOR_SCAN_LEAD_US
+#    define POLL_GOVERNOR_SCAN_LEAD_US 250
+#endif
+
+// Number of observed poll distances required before the scan is paced
+#ifndef POLL_GOVERNOR_MIN_SAMPLES
+#    define POLL_GOVERNOR_MIN_SAMPLES 8
+#endif
+
+/**
+ * @brief Forget all timing information, e.g. on USB reset or suspend.
+ */
+void poll_governor_reset(void);
+
+/**
+ * @brief Records a USB Start-of-Frame. Safe to call from an ISR.
+ *
+ * @param now_us current time in microseconds
+ */
+void poll_governor_sof(uint32_t now_us);
+
+/**
+ * @brief Records the host picking up a report from the keyboard endpoint. Safe to call from an ISR.
+ *
+ * @param now_us current time in microseconds
+ */
+void poll_governor_poll(uint32_t now_us);
+
+/**
+ * @brief Checks whether the matrix should be scanned now.
+ *
+ * Returns true once per predicted poll, as soon as it is less than
+ * POLL_GOVERNOR_SCAN_LEAD_US away, and whenever a full poll interval has
+ * passed since the last scan, so a slow main loop is never held back.
+ *
+ * @param now_us current time in microseconds
+ */
+bool poll_governor_scan_due_at(uint32_t now_us);
+
+/**
+ * @brief Same as poll_governor_scan_due_at(), using poll_governor_timestamp_us().
+ */
+bool poll_governor_scan_due(void);
+
+/**
+ * @brief Time until the next predicted poll, or -1 if it is unknown.
+ *
+ * @param now_us current time in microseconds
+ */
+int32_t poll_governor_time_to_next_poll(uint32_t now_us);
+
+/**
+ * @brief Whether enough timing information is available to pace the scan.
+ *
+ * @param now_us current time in microseconds
+ */
+bool poll_governor_is_synced(uint32_t now_us);
+
+/**
+ * @brief The measured USB frame period in microseconds, 0 if unknown.
+ */
+uint16_t poll_governor_get_frame_us(void);
+
+/**
+ * @brief The measured poll interval in microseconds, 0 if unknown.
+ */
+uint32_t poll_governor_get_interval_us(void);
+
+/**
+ * @brief The measured poll rate in Hz, 0 if unknown.
+ */
+uint16_t poll_governor_get_rate_hz(void);
+
+/**
+ * @brief Prints the poll rate to the console whenever it changes.
+ */
+void poll_governor_task(void);
+
+/**
+ * @brief The time base for the governor, in microseconds.
+ *
+ * Platforms feeding the governor provide a finer grained implementation, the
+ * default is derived from the millisecond timer.
+ */
+uint32_t poll_governor_timestamp_us(void);
@@ -0,0 +1,202 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <random>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "poll_governor.h"
+}
+
+namespace {
+
+// Start close to the wraparound of the microsecond timestamps
+const uint32_t TIME_BASE = 0xFFFF0000;
+
+/*
+ * Simulates the host side of the bus: SOFs at the start of every frame, and an
+ * IN token for the keyboard endpoint every `interval` frames, `phase_us` into
+ * the frame. A poll only completes a transfer when a report is pending.
+ */
+struct HostSim {
+    double   frame_us;
+    unsigned interval;
+    double   phase_us;
+    bool     always_pending = false;
+    bool     pending        = false;
+    bool     sof_enabled    = true;
+    uint64_t frame          = 0;
+    uint64_t poll_frame     = 0;
+    double   now            = 0;
+
+    HostSim(double frame_us, unsigned interval, double phase_us) : frame_us(frame_us), interval(interval), phase_us(phase_us) {}
+
+    static uint32_t ts(double t) {
+        return TIME_BASE + (uint32_t)(int64_t)t;
+    }
+
+    double next_poll() const {
+        return poll_frame * frame_us + phase_us;
+    }
+
+    void advance(double t) {
+        for (;;) {
+            double sof  = frame * frame_us;
+            double poll = next_poll();
+            if (std::min(sof, poll) > t) {
+                break;
+            }
+            if (sof <= poll) {
+                if (sof_enabled) {
+                    poll_governor_sof(ts(sof));
+                }
+                frame++;
+            } else {
+                if (pending || always_pending) {
+                    poll_governor_poll(ts(poll));
+                    pending = false;
+                }
+                poll_frame += interval;
+            }
+        }
+        now = t;
+    }
+
+    // sends a report at random points in time, like a human typing
+    void type_randomly(double until, std::mt19937 &rng, double mean_gap_us = 7000) {
+        std::exponential_distribution<double> gap(1.0 / mean_gap_us);
+        while (now < until) {
+            advance(now + gap(rng));
+            pending = true;
+        }
+    }
+};
+
+} // namespace
+
+class PollGovernor : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        poll_governor_reset();
+    }
+};
+
+TEST_F(PollGovernor, NeverHoldsBackWithoutTiming) {
+    EXPECT_FALSE(poll_governor_is_synced(TIME_BASE));
+    EXPECT_EQ(poll_governor_get_rate_hz(), 0);
+    EXPECT_EQ(poll_governor_time_to_next_poll(TIME_BASE), -1);
+    for (uint32_t t = 0; t < 5000; t += 10) {
+        EXPECT_TRUE(poll_governor_scan_due_at(TIME_BASE + t));
+    }
+}
+
+TEST_F(PollGovernor, SofOnlyGivesFramePeriod) {
+    HostSim host(1000, 1, 300);
+    host.advance(20000);
+
+    EXPECT_EQ(poll_governor_get_frame_us(), 1000);
+    EXPECT_FALSE(poll_governor_is_synced(HostSim::ts(host.now)));
+    EXPECT_TRUE(poll_governor_scan_due_at(HostSim::ts(host.now)));
+}
+
+TEST_F(PollGovernor, MeasuresFullSpeed1ms) {
+    HostSim host(1000, 1, 400);
+    host.always_pending = true;
+    host.advance(20000);
+
+    EXPECT_TRUE(poll_governor_is_synced(HostSim::ts(host.now)));
+    EXPECT_EQ(poll_governor_get_interval_us(), 1000u);
+    EXPECT_EQ(poll_governor_get_rate_hz(), 1000);
+}
+
+TEST_F(PollGovernor, MeasuresIntervalFromSparseReports) {
+    std::mt19937 rng(42);
+    HostSim      host(1000, 8, 650);
+    host.type_randomly(500000, rng);
+
+    EXPECT_EQ(poll_governor_get_interval_us(), 8000u);
+    EXPECT_EQ(poll_governor_get_rate_hz(), 125);
+}
+
+TEST_F(PollGovernor, MeasuresHighSpeedMicroframes) {
+    std::mt19937 rng(7);
+    HostSim      host(125, 1, 40);
+    host.type_randomly(200000, rng, 3000);
+
+    EXPECT_EQ(poll_governor_get_frame_us(), 125);
+    EXPECT_EQ(poll_governor_get_rate_hz(), 8000);
+}
+
+TEST_F(PollGovernor, PredictsNextPollDespiteClockSkew) {
+    std::mt19937 rng(1);
+    // the host's frame clock runs 200ppm slow against ours
+    HostSim host(1000.2, 4, 520);
+    host.type_randomly(300000, rng);
+
+    // keep idling for a second, only SOFs keep coming in
+    for (int i = 0; i < 1000; i++) {
+        host.advance(host.now + 997);
+        int32_t predicted = poll_governor_time_to_next_poll(HostSim::ts(host.now));
+        ASSERT_GE(predicted, 0);
+        EXPECT_NEAR(predicted, host.next_poll() - host.now, 20) << "at " << host.now;
+    }
+}
+
+TEST_F(PollGovernor, ScansJustAheadOfEachPoll) {
+    std::mt19937 rng(3);
+    HostSim      host(1000, 4, 700);
+    host.type_randomly(300000, rng);
+
+    // the first scan has no previous one to go by
+    EXPECT_TRUE(poll_governor_scan_due_at(HostSim::ts(host.now)));
+
+    // a fast main loop, spinning every 30us
+    double start = host.now, scans = 0;
+    while (host.now < start + 400000) {
+        host.advance(host.now + 30);
+        if (poll_governor_scan_due_at(HostSim::ts(host.now))) {
+            scans++;
+            double until_poll = host.next_poll() - host.now;
+            EXPECT_LE(until_poll, POLL_GOVERNOR_SCAN_LEAD_US + 30) << "at " << host.now;
+        }
+    }
+    // one scan per poll, instead of one per loop iteration
+    EXPECT_NEAR(scans, 400000 / 4000, 2);
+}
+
+TEST_F(PollGovernor, SlowLoopIsNeverHeldBack) {
+    HostSim host(1000, 1, 200);
+    host.always_pending = true;
+    host.advance(20000);
+    ASSERT_TRUE(poll_governor_is_synced(HostSim::ts(host.now)));
+
+    for (int i = 0; i < 100; i++) {
+        host.advance(host.now + 1370);
+        EXPECT_TRUE(poll_governor_scan_due_at(HostSim::ts(host.now)));
+    }
+}
+
+TEST_F(PollGovernor, LosesSyncWhenSofsStop) {
+    HostSim host(1000, 1, 200);
+    host.always_pending = true;
+    host.advance(20000);
+    ASSERT_TRUE(poll_governor_is_synced(HostSim::ts(host.now)));
+
+    // suspended: neither SOFs nor polls
+    host.sof_enabled    = false;
+    host.always_pending = false;
+    host.advance(host.now + 100000);
+    EXPECT_FALSE(poll_governor_is_synced(HostSim::ts(host.now)));
+    EXPECT_TRUE(poll_governor_scan_due_at(HostSim::ts(host.now)));
+    EXPECT_TRUE(poll_governor_scan_due_at(HostSim::ts(host.now + 10)));
+
+    // after resume, the long gap drops the poll timing until it is measured again
+    host.sof_enabled = true;
+    host.advance(host.now + 3000);
+    EXPECT_EQ(poll_governor_get_rate_hz(), 0);
+    host.always_pending = true;
+    host.advance(host.now + 20000);
+    EXPECT_EQ(poll_governor_get_rate_hz(), 1000);
+}
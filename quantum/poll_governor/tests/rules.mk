@@ -0,0 +1,10 @@
+poll_governor_DEFS := -DIGNORE_ATOMIC_BLOCK
+
+poll_governor_SRC := \
+    $(QUANTUM_PATH)/poll_governor/tests/poll_governor_tests.cpp \
+    $(QUANTUM_PATH)/poll_governor/poll_governor.c \
+    $(PLATFORM_PATH)/timer.c \
+    $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+poll_governor_INC := \
+    $(QUANTUM_PATH)/poll_governor
@@ -0,0 +1 @@
+TEST_LIST += poll_governor
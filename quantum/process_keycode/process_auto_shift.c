@@ -18,6 +18,7 @@
 #include "quantum.h"
 #include "action_util.h"
 #include "timer.h"
+#include "deadline.h"
 #include "keycodes.h"
 
 #ifndef AUTO_SHIFT_DISABLED_AT_STARTUP
@@ -223,6 +224,11 @@ static bool autoshift_press(uint16_t keycode, uint16_t now, keyrecord_t *record)
     autoshift_lastkey           = keycode;
     autoshift_time              = now;
     autoshift_flags.in_progress = true;
+#ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
+    deadline_set(DEADLINE_AUTO_SHIFT, 0);
+#else
+    deadline_set(DEADLINE_AUTO_SHIFT, autoshift_timeout);
+#endif
 
 #if !defined(NO_ACTION_ONESHOT) && !defined(NO_ACTION_TAPPING)
     clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
@@ -307,7 +313,9 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
  *  to be released.
  */
 void autoshift_matrix_scan(void) {
-    if (autoshift_flags.in_progress) {
+    if (!autoshift_flags.in_progress) {
+        deadline_clear(DEADLINE_AUTO_SHIFT);
+    } else {
         const uint16_t now = timer_read();
         if (TIMER_DIFF_16(now, autoshift_time) >=
 #ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
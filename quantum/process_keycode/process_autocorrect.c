@@ -11,16 +11,9 @@
 #include "keycode_config.h"
 #include "send_string.h"
 #include "action_util.h"
+#include "autocorrect.h"
 
-#if __has_include("autocorrect_data.h")
-#    include "autocorrect_data.h"
-#else
-#    pragma message "Autocorrect is using the default library."
-#    include "autocorrect_data_default.h"
-#endif
-
-static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
-static uint8_t typo_buffer_size                    = 1;
+static autocorrect_buffer_t typo_buffer = {.keycodes = {KC_SPC}, .size = 1};
 
 /**
  * @brief function for querying the enabled state of autocorrect
@@ -47,7 +40,7 @@ void autocorrect_enable(void) {
  */
 void autocorrect_disable(void) {
     keymap_config.autocorrect_enable = false;
-    typo_buffer_size                 = 0;
+    typo_buffer.size                 = 0;
     eeconfig_update_keymap(keymap_config.raw);
 }
 
@@ -57,7 +50,7 @@ void autocorrect_disable(void) {
  */
 void autocorrect_toggle(void) {
     keymap_config.autocorrect_enable = !keymap_config.autocorrect_enable;
-    typo_buffer_size                 = 0;
+    typo_buffer.size                 = 0;
     eeconfig_update_keymap(keymap_config.raw);
 }
 
@@ -218,7 +211,7 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     }
 
     if (!keymap_config.autocorrect_enable) {
-        typo_buffer_size = 0;
+        typo_buffer.size = 0;
         return true;
     }
 
@@ -227,7 +220,7 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     }
 
     // autocorrect keycode verification and extraction
-    if (!process_autocorrect_user(&keycode, record, &typo_buffer_size, &mods)) {
+    if (!process_autocorrect_user(&keycode, record, &typo_buffer.size, &mods)) {
         return true;
     }
 
@@ -245,13 +238,13 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         case KC_ENTER:
             // Behave more conservatively for the enter key. Reset, so that enter
             // can't be used on a word ending.
-            typo_buffer_size = 0;
+            typo_buffer.size = 0;
             keycode          = KC_SPC;
             break;
         case KC_BSPC:
             // Remove last character from the buffer.
-            if (typo_buffer_size > 0) {
-                --typo_buffer_size;
+            if (typo_buffer.size > 0) {
+                --typo_buffer.size;
             }
             return true;
         case KC_QUOTE:
@@ -262,115 +255,85 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
             break;
         default:
             // Clear state if some other non-alpha key is pressed.
-            typo_buffer_size = 0;
+            typo_buffer.size = 0;
             return true;
     }
 
-    // Rotate oldest character if buffer is full.
-    if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
-        memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
-        typo_buffer_size = AUTOCORRECT_MAX_LENGTH - 1;
-    }
-
-    // Append `keycode` to buffer.
-    typo_buffer[typo_buffer_size++] = keycode;
+    // Append `keycode` to buffer, rotating out the oldest character if it is full.
+    autocorrect_buffer_push(&typo_buffer, keycode);
     // Return if buffer is smaller than the shortest word.
-    if (typo_buffer_size < AUTOCORRECT_MIN_LENGTH) {
+    if (typo_buffer.size < AUTOCORRECT_MIN_LENGTH) {
         return true;
     }
 
-    // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
-    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
-        uint8_t const key_i = typo_buffer[i];
-
-        if (code & 64) { // Check for match in node with multiple children.
-            code &= 63;
-            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
-                if (!code) return true;
-            }
-            // Follow link to child node.
-            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
-            // Check for match in node with single child.
-        } else if (code != key_i) {
-            return true;
-        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
-            ++state;
-        }
+    // Check for typo in buffer using the dictionary stored in `autocorrect_data.h`.
+    autocorrect_match_t match;
+    if (!autocorrect_find(&typo_buffer, &match)) {
+        return true;
+    }
 
-        // Stop if `state` becomes an invalid index. This should not normally
-        // happen, it is a safeguard in case of a bug, data corruption, etc.
-        if (state >= DICTIONARY_SIZE) {
-            return true;
+    // A typo was found! Apply autocorrect.
+    const uint8_t backspaces = match.backspaces + !record->event.pressed;
+    const char   *changes    = match.changes;
+
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    uint8_t typo_start = 0;
+    bool    space_last = autocorrect_buffer_get(&typo_buffer, typo_buffer.size - 1) == KC_SPC;
+    for (uint8_t i = typo_buffer.size; i > 0; --i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (autocorrect_buffer_get(&typo_buffer, i - 1) == KC_SPC && i != typo_buffer.size) {
+            typo_start = i;
+            break;
         }
 
-        code = pgm_read_byte(autocorrect_data + state);
-
-        if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char *  changes    = (const char *)(autocorrect_data + state + 1);
-
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
-
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
-
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+        ++typo_len;
+    }
 
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
 
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
+    // convert buffer of keycodes into a string
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = autocorrect_buffer_get(&typo_buffer, typo_start + i) - KC_A + 'a';
+    }
 
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+    strcpy_P(correct + typo_len - offset, changes);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
         }
+        send_string_P(changes);
+    }
+
+    if (keycode == KC_SPC) {
+        typo_buffer.keycodes[0] = KC_SPC;
+        typo_buffer.start       = 0;
+        typo_buffer.size        = 1;
+        return true;
+    } else {
+        typo_buffer.size = 0;
+        return false;
     }
-    return true;
 }
@@ -19,6 +19,7 @@
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
+#include "deadline.h"
 #include "wait.h"
 #include "keyboard.h"
 #include "keymap_common.h"
@@ -597,6 +598,8 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
 #    else
         timer = timer_read();
 #    endif
+        // The combo term is only known once the combos have been processed, so check on every loop until it passes
+        deadline_set(DEADLINE_COMBO, 0);
 #endif
 
 #ifdef COMBO_PROCESS_KEY_REPRESS
@@ -628,12 +631,13 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
 }
 
 void combo_task(void) {
-    if (!b_combo_enable) {
+#ifndef COMBO_NO_TIMER
+    if (!b_combo_enable || !timer) {
+        deadline_clear(DEADLINE_COMBO);
         return;
     }
 
-#ifndef COMBO_NO_TIMER
-    if (timer && timer_elapsed(timer) > longest_term) {
+    if (timer_elapsed(timer) > longest_term) {
         if (combo_buffer_read != combo_buffer_write) {
             apply_combos();
             longest_term = 0;
@@ -18,6 +18,7 @@
 #include "process_key_override.h"
 #include "report.h"
 #include "timer.h"
+#include "deadline.h"
 #include "debug.h"
 #include "wait.h"
 #include "action_util.h"
@@ -84,6 +85,18 @@ static uint16_t deferred_register = 0;
 // TODO: in future maybe save in EEPROM?
 static bool enabled = true;
 
+// Indices of the key overrides sorted by trigger, so that a key event only checks the overrides it can activate. Those without a trigger (KC_NO) come first.
+// Until key_override_init(), and when there are too many overrides to index, every override is checked instead.
+static uint16_t *trigger_index       = NULL;
+static uint16_t  trigger_index_count = 0;
+// Number of overrides without a trigger at the start of the index
+static uint16_t no_trigger_count = 0;
+// Whether all overrides without a trigger require modifiers to be down
+static bool no_trigger_requires_mods = true;
+// Layers any override, or any override without a trigger, applies to
+static layer_state_t indexed_layers    = 0;
+static layer_state_t no_trigger_layers = 0;
+
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
@@ -155,6 +168,7 @@ static void schedule_deferred_register(const uint16_t keycode) {
         defer_delay          = 50; // 50ms
     }
     deferred_register = keycode;
+    deadline_set(DEADLINE_KEY_OVERRIDE, defer_delay - timer_elapsed32(defer_reference_time));
 }
 
 const key_override_t *clear_active_override(const bool allow_reregister) {
@@ -243,156 +257,315 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
-static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
-    if (key_override_count() == 0) {
-        return true;
+/** Tries activating a single key override. Returns true if it was activated, in which case `send_key_action` is set to whether the key action for `keycode` should be sent */
+static bool try_activating(const key_override_t *const override, const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *send_key_action) {
+    // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
+    if (active_mods == 0 && override->trigger_mods != 0) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
     }
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
-        const key_override_t *const override = key_override_get(i);
+    // Check layer
+    if ((override->layers & (1 << layer)) == 0) {
+        key_override_printf("Not activating override: Not set to activate on pressed layer\n");
+        return false;
+    }
 
-        // End of array
-        if (override == NULL) {
-            break;
-        }
+    // Check allowed activation events
+    if (!check_activation_event(override, key_down, is_mod)) {
+        key_override_printf("Not activating override: Activation event not allowed\n");
+        return false;
+    }
 
-        // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
-        if (active_mods == 0 && override->trigger_mods != 0) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    const bool is_trigger = override->trigger == keycode;
 
-        // Check layer
-        if ((override->layers & (1 << layer)) == 0) {
-            key_override_printf("Not activating override: Not set to activate on pressed layer\n");
-            continue;
-        }
+    // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
+    if (is_trigger && !key_down) {
+        key_override_printf("Not activating override: Trigger lifted\n");
+        return false;
+    }
 
-        // Check allowed activation events
-        if (!check_activation_event(override, key_down, is_mod)) {
-            key_override_printf("Not activating override: Activation event not allowed\n");
-            continue;
-        }
+    // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
+    const bool no_trigger = override->trigger == KC_NO;
 
-        const bool is_trigger = override->trigger == keycode;
+    // Check if aleady active
+    if (override == active_override) {
+        key_override_printf("Not activating override: Alerady actived\n");
+        return false;
+    }
 
-        // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
-        if (is_trigger && !key_down) {
-            key_override_printf("Not activating override: Trigger lifted\n");
-            continue;
-        }
+    // Check if enabled
+    if (override->enabled != NULL && !((*(override->enabled) & 1))) {
+        key_override_printf("Not activating override: Not enabled\n");
+        return false;
+    }
 
-        // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
-        const bool no_trigger = override->trigger == KC_NO;
+    // Check mods precisely
+    if (!key_override_matches_active_modifiers(override, active_mods)) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
+    }
 
-        // Check if aleady active
-        if (override == active_override) {
-            key_override_printf("Not activating override: Alerady actived\n");
-            continue;
-        }
+    // Check if trigger key is down.
+    const bool trigger_down = is_trigger && key_down;
 
-        // Check if enabled
-        if (override->enabled != NULL && !((*(override->enabled) & 1))) {
-            key_override_printf("Not activating override: Not enabled\n");
-            continue;
-        }
+    // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
+    // If no trigger key is required, yes.
+    // If the trigger was just pressed, yes.
+    // If the last non-mod key that was pressed down is the trigger key, yes.
+    bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
 
-        // Check mods precisely
-        if (!key_override_matches_active_modifiers(override, active_mods)) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    if (!should_activate) {
+        key_override_printf("Not activating override. Trigger not down\n");
+        return false;
+    }
 
-        // Check if trigger key is down.
-        const bool trigger_down = is_trigger && key_down;
+    key_override_printf("Activating override\n");
 
-        // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
-        // If no trigger key is required, yes.
-        // If the trigger was just pressed, yes.
-        // If the last non-mod key that was pressed down is the trigger key, yes.
-        bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
+    clear_active_override(false);
 
-        if (!should_activate) {
-            key_override_printf("Not activating override. Trigger not down\n");
-            continue;
-        }
+#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
+    // Send a dummy keycode before unregistering the modifier(s)
+    // so that suppressing the modifier(s) doesn't falsely get interpreted
+    // by the host OS as a tap of a modifier key.
+    // For example, unintended activations of the start menu on Windows when
+    // using a GUI+<kc> key override with suppressed mods.
+    neutralize_flashing_modifiers(active_mods);
+#endif
 
-        key_override_printf("Activating override\n");
+    active_override                 = override;
+    active_override_trigger_is_down = true;
 
-        clear_active_override(false);
+    set_suppressed_override_mods(override->suppressed_mods);
 
-#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
-        // Send a dummy keycode before unregistering the modifier(s)
-        // so that suppressing the modifier(s) doesn't falsely get interpreted
-        // by the host OS as a tap of a modifier key.
-        // For example, unintended activations of the start menu on Windows when
-        // using a GUI+<kc> key override with suppressed mods.
-        neutralize_flashing_modifiers(active_mods);
-#endif
+    if (!trigger_down && !no_trigger) {
+        // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
+        if (IS_BASIC_KEYCODE(override->trigger)) {
+            del_key(override->trigger);
+        } else {
+            unregister_code(override->trigger);
+        }
+    }
+
+    const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
 
-        active_override                 = override;
-        active_override_trigger_is_down = true;
+    bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
+                                mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
 
-        set_suppressed_override_mods(override->suppressed_mods);
+    // Try firing the custom handler
+    if (override->custom_action != NULL) {
+        register_replacement &= override->custom_action(true, override->context);
+    }
 
-        if (!trigger_down && !no_trigger) {
-            // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
-            if (IS_BASIC_KEYCODE(override->trigger)) {
-                del_key(override->trigger);
+    if (register_replacement) {
+        const uint8_t override_mods = extract_mod_bits(override->replacement);
+        set_weak_override_mods(override_mods);
+
+        // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
+        if (is_mod) {
+            key_override_printf("Deferring register replacement key\n");
+            schedule_deferred_register(mod_free_replacement);
+            send_keyboard_report();
+        } else {
+            if (IS_BASIC_KEYCODE(mod_free_replacement)) {
+                add_key(mod_free_replacement);
             } else {
-                unregister_code(override->trigger);
+                key_override_printf("NOT KEY 2\n");
+                send_keyboard_report();
+                // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
+                wait_ms(10);
+                register_code(mod_free_replacement);
             }
         }
+    } else {
+        // If not registering the replacement key send keyboard report to update the unregistered keys.
+        send_keyboard_report();
+    }
 
-        const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
+    // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
+    *send_key_action = !trigger_down;
 
-        bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
-                                    mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+    return true;
+}
+
+/** Whether the override at `a` sorts after the one at `b`: by trigger, then in the order they are defined in. */
+static bool trigger_index_after(const uint16_t a, const uint16_t b) {
+    const uint16_t trigger_a = key_override_get(a)->trigger;
+    const uint16_t trigger_b = key_override_get(b)->trigger;
+    return trigger_a != trigger_b ? trigger_a > trigger_b : a > b;
+}
 
-        // Try firing the custom handler
-        if (override->custom_action != NULL) {
-            register_replacement &= override->custom_action(true, override->context);
+static void trigger_index_sift_down(uint16_t pos, const uint16_t count) {
+    for (;;) {
+        uint32_t child = 2 * (uint32_t)pos + 1;
+        if (child >= count) {
+            return;
         }
+        if (child + 1 < count && trigger_index_after(trigger_index[child + 1], trigger_index[child])) {
+            child++;
+        }
+        if (!trigger_index_after(trigger_index[child], trigger_index[pos])) {
+            return;
+        }
+        const uint16_t swap  = trigger_index[pos];
+        trigger_index[pos]   = trigger_index[child];
+        trigger_index[child] = swap;
+        pos                  = child;
+    }
+}
 
-        if (register_replacement) {
-            const uint8_t override_mods = extract_mod_bits(override->replacement);
-            set_weak_override_mods(override_mods);
+/** Sorts the key overrides by trigger into the index, keeping overrides with the same trigger in the order they are defined in. */
+static void build_trigger_index(void) {
+    const uint16_t count = key_override_count();
 
-            // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
-            if (is_mod) {
-                key_override_printf("Deferring register replacement key\n");
-                schedule_deferred_register(mod_free_replacement);
-                send_keyboard_report();
-            } else {
-                if (IS_BASIC_KEYCODE(mod_free_replacement)) {
-                    add_key(mod_free_replacement);
-                } else {
-                    key_override_printf("NOT KEY 2\n");
-                    send_keyboard_report();
-                    // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
-                    wait_ms(10);
-                    register_code(mod_free_replacement);
-                }
+    trigger_index_count      = 0;
+    no_trigger_count         = 0;
+    no_trigger_requires_mods = true;
+    indexed_layers           = 0;
+    no_trigger_layers        = 0;
+
+    // The index only has room for the overrides in the keymap, fall back to checking all of them if there are more
+    if (count > key_override_count_raw()) {
+        trigger_index = NULL;
+        return;
+    }
+    trigger_index = key_override_index_raw();
+
+    for (uint16_t i = 0; i < count; i++) {
+        const key_override_t *const override = key_override_get(i);
+
+        // End of array
+        if (override == NULL) {
+            break;
+        }
+
+        trigger_index[trigger_index_count++] = i;
+
+        indexed_layers |= override->layers;
+        if (override->trigger == KC_NO) {
+            no_trigger_count++;
+            no_trigger_layers |= override->layers;
+            if (override->trigger_mods == 0) {
+                no_trigger_requires_mods = false;
             }
+        }
+    }
+
+    // Heap sort, in place and in O(n log n)
+    for (uint16_t pos = trigger_index_count / 2; pos-- > 0;) {
+        trigger_index_sift_down(pos, trigger_index_count);
+    }
+    for (uint16_t last = trigger_index_count; last-- > 1;) {
+        const uint16_t swap = trigger_index[0];
+        trigger_index[0]    = trigger_index[last];
+        trigger_index[last] = swap;
+        trigger_index_sift_down(0, last);
+    }
+}
+
+/** Returns the position of the first override with `trigger` in the index, and sets `end` to the position after the last one. */
+static uint16_t find_trigger(const uint16_t trigger, uint16_t *end) {
+    uint16_t low  = 0;
+    uint16_t high = trigger_index_count;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (key_override_get(trigger_index[mid])->trigger < trigger) {
+            low = mid + 1;
         } else {
-            // If not registering the replacement key send keyboard report to update the unregistered keys.
-            send_keyboard_report();
+            high = mid;
         }
+    }
 
-        *activated = true;
+    const uint16_t start = low;
 
-        // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
-        return !trigger_down;
+    high = trigger_index_count;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (key_override_get(trigger_index[mid])->trigger == trigger) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
     }
 
+    *end = low;
+    return start;
+}
+
+void key_override_init(void) {
+    build_trigger_index();
+}
+
+void key_override_reindex(void) {
+    build_trigger_index();
+}
+
+/** Tries activating the key overrides that the key event can activate, in the order they are defined in, until one activates. Returns true if the key action for `keycode` should be sent */
+static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
+    bool send_key_action = true;
+
     *activated = false;
 
-    return true;
+    if (trigger_index == NULL) {
+        for (uint16_t i = 0; i < key_override_count(); i++) {
+            const key_override_t *const override = key_override_get(i);
+
+            // End of array
+            if (override == NULL) {
+                break;
+            }
+
+            if (try_activating(override, keycode, layer, key_down, is_mod, active_mods, &send_key_action)) {
+                *activated = true;
+                break;
+            }
+        }
+
+        return send_key_action;
+    }
+
+    if ((indexed_layers & (1 << layer)) == 0) {
+        return true;
+    }
+
+    // An override can only activate if its trigger was just pressed or is the last key held down, or if it has no trigger.
+    uint16_t pos[3] = {0}, end[3] = {0};
+    if ((no_trigger_layers & (1 << layer)) != 0 && !(active_mods == 0 && no_trigger_requires_mods)) {
+        end[0] = no_trigger_count;
+    }
+    if (keycode != KC_NO) {
+        pos[1] = find_trigger(keycode, &end[1]);
+    }
+    if (last_key_down != KC_NO && last_key_down != keycode) {
+        pos[2] = find_trigger(last_key_down, &end[2]);
+    }
+
+    for (;;) {
+        // Take the candidate defined first
+        uint8_t next = ARRAY_SIZE(pos);
+        for (uint8_t j = 0; j < ARRAY_SIZE(pos); j++) {
+            if (pos[j] < end[j] && (next == ARRAY_SIZE(pos) || trigger_index[pos[j]] < trigger_index[pos[next]])) {
+                next = j;
+            }
+        }
+        if (next == ARRAY_SIZE(pos)) {
+            break;
+        }
+
+        const key_override_t *const override = key_override_get(trigger_index[pos[next]++]);
+
+        if (try_activating(override, keycode, layer, key_down, is_mod, active_mods, &send_key_action)) {
+            *activated = true;
+            break;
+        }
+    }
+
+    return send_key_action;
 }
 
 void key_override_task(void) {
     if (deferred_register == 0) {
+        deadline_clear(DEADLINE_KEY_OVERRIDE);
         return;
     }
 
@@ -402,6 +575,7 @@ void key_override_task(void) {
         deferred_register    = 0;
         defer_reference_time = 0;
         defer_delay          = 0;
+        deadline_clear(DEADLINE_KEY_OVERRIDE);
     }
 }
 
@@ -105,6 +105,12 @@ bool process_key_override(const uint16_t keycode, const keyrecord_t *const recor
 /** Perform any deferred keys */
 void key_override_task(void);
 
+/** Builds the lookup of key overrides by trigger, called by keyboard_init() */
+void key_override_init(void);
+
+/** Rebuilds the lookup of key overrides by trigger. Call this after changing what key_override_count() or key_override_get() return, or the trigger of an override */
+void key_override_reindex(void);
+
 /**
  *  Preferrably use these macros to create key overrides. They fix many of the options to a standard setting that should satisfy most basic use-cases. Only directly create a key_override_t struct when you really need to.
  */
@@ -21,10 +21,16 @@
 #include "action_util.h"
 #include "timer.h"
 #include "wait.h"
+#include "deferred_exec.h"
+#include "deadline.h"
 #include "keymap_introspection.h"
 
 static uint16_t active_td;
-static uint16_t last_tap_time;
+
+// Only the active tap dance can time out, so a single executor is enough
+static deferred_executor_t tap_dance_executors[1] = {0};
+static deferred_token      tap_dance_timeout      = INVALID_DEFERRED_TOKEN;
+static uint32_t            last_tap_dance_exec    = 0;
 
 void tap_dance_pair_on_each_tap(tap_dance_state_t *state, void *user_data) {
     tap_dance_pair_t *pair = (tap_dance_pair_t *)user_data;
@@ -110,6 +116,13 @@ static inline void process_tap_dance_action_on_reset(tap_dance_action_t *action)
     action->state = (const tap_dance_state_t){0};
 }
 
+static void tap_dance_cancel_timeout(void) {
+    if (tap_dance_timeout != INVALID_DEFERRED_TOKEN) {
+        cancel_deferred_exec_advanced(tap_dance_executors, ARRAY_SIZE(tap_dance_executors), tap_dance_timeout);
+        tap_dance_timeout = INVALID_DEFERRED_TOKEN;
+    }
+}
+
 static inline void process_tap_dance_action_on_dance_finished(tap_dance_action_t *action) {
     if (!action->state.finished) {
         action->state.finished = true;
@@ -121,12 +134,41 @@ static inline void process_tap_dance_action_on_dance_finished(tap_dance_action_t
         _process_tap_dance_action_fn(&action->state, action->user_data, action->fn.on_dance_finished);
     }
     active_td = 0;
+    tap_dance_cancel_timeout();
     if (!action->state.pressed) {
         // There will not be a key release event, so reset now.
         process_tap_dance_action_on_reset(action);
     }
 }
 
+static uint32_t tap_dance_timeout_callback(uint32_t trigger_time, void *cb_arg) {
+    tap_dance_timeout = INVALID_DEFERRED_TOKEN;
+    if (active_td) {
+        tap_dance_action_t *action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
+        if (!action->state.interrupted) {
+            process_tap_dance_action_on_dance_finished(action);
+        }
+    }
+    return 0;
+}
+
+/**
+ * \brief Restarts the timeout of the active tap dance.
+ *
+ * The dance finishes once more than the tapping term has passed since the last tap, without tap_dance_task() having to
+ * check the timer on every scan.
+ */
+static void tap_dance_start_timeout(uint16_t keycode, keyrecord_t *record) {
+    uint32_t delay_ms = GET_TAPPING_TERM(keycode, record) + 1;
+    deadline_set(DEADLINE_TAP_DANCE, delay_ms);
+    if (tap_dance_timeout != INVALID_DEFERRED_TOKEN && extend_deferred_exec_advanced(tap_dance_executors, ARRAY_SIZE(tap_dance_executors), tap_dance_timeout, delay_ms)) {
+        return;
+    }
+    // Nothing ran while idle, so the throttle restarts from now
+    last_tap_dance_exec = timer_read32() - 1;
+    tap_dance_timeout   = defer_exec_advanced(tap_dance_executors, ARRAY_SIZE(tap_dance_executors), delay_ms, tap_dance_timeout_callback, NULL);
+}
+
 bool preprocess_tap_dance(uint16_t keycode, keyrecord_t *record) {
     tap_dance_action_t *action;
 
@@ -164,9 +206,13 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 
             action->state.pressed = record->event.pressed;
             if (record->event.pressed) {
-                last_tap_time = timer_read();
                 process_tap_dance_action_on_each_tap(action);
                 active_td = action->state.finished ? 0 : keycode;
+                if (active_td) {
+                    tap_dance_start_timeout(keycode, record);
+                } else {
+                    tap_dance_cancel_timeout();
+                }
             } else {
                 process_tap_dance_action_on_each_release(action);
                 if (action->state.finished) {
@@ -184,17 +230,16 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 }
 
 void tap_dance_task(void) {
-    tap_dance_action_t *action;
-
-    if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
-
-    action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
-    if (!action->state.interrupted) {
-        process_tap_dance_action_on_dance_finished(action);
+    if (tap_dance_timeout == INVALID_DEFERRED_TOKEN) {
+        deadline_clear(DEADLINE_TAP_DANCE);
+        return;
     }
+
+    deferred_exec_advanced_task(tap_dance_executors, ARRAY_SIZE(tap_dance_executors), &last_tap_dance_exec);
 }
 
 void reset_tap_dance(tap_dance_state_t *state) {
     active_td = 0;
+    tap_dance_cancel_timeout();
     process_tap_dance_action_on_reset((tap_dance_action_t *)state);
 }
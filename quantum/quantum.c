@@ -305,6 +305,12 @@ bool process_record_quantum(keyrecord_t *record) {
     }
 #endif
 
+#if defined(SEND_STRING_ASYNC_ENABLE) && defined(SEND_STRING_ASYNC_ABORT_ON_KEYPRESS)
+    if (record->event.pressed) {
+        send_string_async_abort();
+    }
+#endif
+
 #ifdef WPM_ENABLE
     if (record->event.pressed) {
         update_wpm(keycode);
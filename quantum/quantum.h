@@ -154,6 +154,10 @@ extern layer_state_t layer_state;
 #    include "send_string.h"
 #endif
 
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include "send_string_async.h"
+#endif
+
 #ifdef HAPTIC_ENABLE
 #    include "haptic.h"
 #endif
@@ -39,12 +39,32 @@ __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+// Goes through rgb_matrix_hsv_to_rgb() unless told it has not been overridden
+__attribute__((weak)) void rgb_matrix_hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+#ifdef RGB_MATRIX_FAST_HSV_BATCH
+    hsv_to_rgb_batch(hsv, rgb, count, UINT8_MAX);
+#else
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = rgb_matrix_hsv_to_rgb(hsv[i]);
+    }
+#endif
+}
+
+void rgb_matrix_hsv_batch_flush(rgb_matrix_hsv_batch_t *batch) {
+    rgb_t rgb[RGB_MATRIX_HSV_BATCH_SIZE];
+    rgb_matrix_hsv_to_rgb_batch(batch->hsv, rgb, batch->count);
+    for (uint8_t i = 0; i < batch->count; i++) {
+        rgb_matrix_set_color(batch->index[i], rgb[i].r, rgb[i].g, rgb[i].b);
+    }
+    batch->count = 0;
+}
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
 // ------------------------------------------
 // -----Begin rgb effect includes macros-----
-#define RGB_MATRIX_EFFECT(name)
+#define RGB_MATRIX_EFFECT(name, ...)
 #define RGB_MATRIX_CUSTOM_EFFECT_IMPLS
 
 #include "rgb_matrix_effects.inc"
@@ -77,6 +97,16 @@ static uint8_t         rgb_last_effect   = UINT8_MAX;
 static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false};
 static rgb_task_states rgb_task_state    = SYNCING;
 
+// change detection, so that frames which would look the same as the last one are skipped
+static bool    rgb_effect_drawing   = false;
+static bool    rgb_leds_overwritten = true;
+static bool    rgb_frame_unchanged  = false;
+static hsv_t   rgb_last_hsv;
+static uint8_t rgb_last_speed;
+#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+static uint8_t rgb_last_hit_count;
+#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+
 // double buffers
 static uint32_t rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -153,10 +183,12 @@ __attribute__((weak)) int rgb_matrix_led_index(int index) {
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    if (!rgb_effect_drawing) rgb_leds_overwritten = true;
     rgb_matrix_driver.set_color(rgb_matrix_led_index(index), red, green, blue);
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    if (!rgb_effect_drawing) rgb_leds_overwritten = true;
 #if defined(RGB_MATRIX_SPLIT)
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
@@ -248,6 +280,62 @@ static bool rgb_matrix_none(effect_params_t *params) {
     return false;
 }
 
+// Picks the kind given to RGB_MATRIX_EFFECT(name, kind), defaulting to animated
+#define RGB_MATRIX_EFFECT_KIND(...) RGB_MATRIX_EFFECT_KIND_(_, ##__VA_ARGS__, ANIMATED)
+#define RGB_MATRIX_EFFECT_KIND_(_, kind, ...) RGB_MATRIX_EFFECT_KIND_##kind
+
+static rgb_matrix_effect_kind_t rgb_matrix_effect_kind(uint8_t effect) {
+    switch (effect) {
+// ---------------------------------------------
+// -----Begin rgb effect kind macros------------
+#define RGB_MATRIX_EFFECT(name, ...) \
+    case RGB_MATRIX_##name:          \
+        return RGB_MATRIX_EFFECT_KIND(__VA_ARGS__);
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+
+#if defined(RGB_MATRIX_CUSTOM_KB) || defined(RGB_MATRIX_CUSTOM_USER)
+#    define RGB_MATRIX_EFFECT(name, ...) \
+        case RGB_MATRIX_CUSTOM_##name:   \
+            return RGB_MATRIX_EFFECT_KIND(__VA_ARGS__);
+#    ifdef RGB_MATRIX_CUSTOM_KB
+#        include "rgb_matrix_kb.inc"
+#    endif
+#    ifdef RGB_MATRIX_CUSTOM_USER
+#        include "rgb_matrix_user.inc"
+#    endif
+#    undef RGB_MATRIX_EFFECT
+#endif
+            // -----End rgb effect kind macros--------------
+            // ---------------------------------------------
+
+        default:
+            return RGB_MATRIX_EFFECT_KIND_ANIMATED;
+    }
+}
+
+// Whether the effect would draw the same frame as last time, which the LEDs still show
+static bool rgb_task_frame_unchanged(uint8_t effect) {
+    if (rgb_effect_params.init || rgb_leds_overwritten) {
+        return false;
+    }
+    if (memcmp(&rgb_last_hsv, &rgb_matrix_config.hsv, sizeof(hsv_t)) != 0 || rgb_last_speed != rgb_matrix_config.speed) {
+        return false;
+    }
+
+    switch (rgb_matrix_effect_kind(effect)) {
+        case RGB_MATRIX_EFFECT_KIND_STATIC:
+            return true;
+#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+        case RGB_MATRIX_EFFECT_KIND_REACTIVE:
+            // Once all hits are forgotten, only the configuration is left
+            return g_last_hit_tracker.count == 0 && rgb_last_hit_count == 0;
+#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+        default:
+            return false;
+    }
+}
+
 static void rgb_task_timers(void) {
 #if defined(RGB_MATRIX_KEYREACTIVE_ENABLED)
     uint32_t deltaTime = sync_timer_elapsed32(rgb_timer_buffer);
@@ -295,8 +383,35 @@ static void rgb_task_render(uint8_t effect) {
         rgb_matrix_set_color_all(0, 0, 0);
     }
 
+    if (rgb_effect_params.iter == 0) {
+        rgb_frame_unchanged = rgb_task_frame_unchanged(effect);
+        if (!rgb_frame_unchanged) {
+            rgb_leds_overwritten = false;
+            rgb_last_hsv         = rgb_matrix_config.hsv;
+            rgb_last_speed       = rgb_matrix_config.speed;
+#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+            rgb_last_hit_count = g_last_hit_tracker.count;
+#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+        }
+    } else if (rgb_frame_unchanged && rgb_effect_params.init) {
+        // The effect changed partway through, so the next frame has to be drawn in full
+        rgb_frame_unchanged  = false;
+        rgb_leds_overwritten = true;
+    }
+
+    if (rgb_frame_unchanged) {
+        // Only the indicators are drawn, over what the LEDs already show
+        RGB_MATRIX_USE_LIMITS_ITER(led_min, led_max, rgb_effect_params.iter);
+        rgb_effect_params.iter++;
+        if (!rgb_matrix_check_finished_leds(led_max)) {
+            rgb_task_state = FLUSHING;
+        }
+        return;
+    }
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
+    rgb_effect_drawing = true;
     switch (effect) {
         case RGB_MATRIX_NONE:
             rendering = rgb_matrix_none(&rgb_effect_params);
@@ -330,10 +445,12 @@ static void rgb_task_render(uint8_t effect) {
         // Factory default magic value
         case UINT8_MAX: {
             rgb_matrix_test();
-            rgb_task_state = FLUSHING;
+            rgb_effect_drawing = false;
+            rgb_task_state     = FLUSHING;
         }
             return;
     }
+    rgb_effect_drawing = false;
 
     rgb_effect_params.iter++;
 
@@ -352,8 +469,10 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
 
-    // update pwm buffers
-    rgb_matrix_update_pwm_buffers();
+    // update pwm buffers, unless neither the effect nor anything else changed the LEDs
+    if (!rgb_frame_unchanged || rgb_leds_overwritten) {
+        rgb_matrix_update_pwm_buffers();
+    }
 
     // next task
     rgb_task_state = SYNCING;
@@ -90,6 +90,11 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+// How many colors the effect runners convert from HSV at once
+#ifndef RGB_MATRIX_HSV_BATCH_SIZE
+#    define RGB_MATRIX_HSV_BATCH_SIZE 16
+#endif
+
 struct rgb_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
@@ -150,6 +155,10 @@ int rgb_matrix_led_index(int index);
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 
+// Keyboards overriding the batch conversion, e.g. for speed, must keep it the same as rgb_matrix_hsv_to_rgb()
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv);
+void  rgb_matrix_hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count);
+
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed);
 
 void rgb_matrix_task(void);
@@ -270,6 +279,29 @@ static inline bool rgb_matrix_check_finished_leds(uint8_t led_idx) {
 #endif
 }
 
+// Colors waiting to be converted and set together
+typedef struct {
+    uint8_t count;
+    uint8_t index[RGB_MATRIX_HSV_BATCH_SIZE];
+    hsv_t   hsv[RGB_MATRIX_HSV_BATCH_SIZE];
+} rgb_matrix_hsv_batch_t;
+
+/**
+ * @brief Sets the colors of the LEDs waiting in the batch, and empties it.
+ */
+void rgb_matrix_hsv_batch_flush(rgb_matrix_hsv_batch_t *batch);
+
+/**
+ * @brief Queues setting an LED to an HSV color, setting the queued LEDs once the batch is full.
+ */
+static inline void rgb_matrix_hsv_batch_add(rgb_matrix_hsv_batch_t *batch, uint8_t index, hsv_t hsv) {
+    batch->index[batch->count] = index;
+    batch->hsv[batch->count]   = hsv;
+    if (++batch->count == RGB_MATRIX_HSV_BATCH_SIZE) {
+        rgb_matrix_hsv_batch_flush(batch);
+    }
+}
+
 extern rgb_config_t rgb_matrix_config;
 
 extern uint32_t     g_rgb_timer;
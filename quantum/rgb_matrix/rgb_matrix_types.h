@@ -16,6 +16,10 @@
 
 #pragma once
 
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
 #include <stdint.h>
 #include <stdbool.h>
 #include "color.h"
@@ -50,6 +54,20 @@ typedef struct PACKED {
     bool        init;
 } effect_params_t;
 
+// What the output of an effect depends on, given as RGB_MATRIX_EFFECT(name, kind)
+typedef enum rgb_matrix_effect_kind {
+    RGB_MATRIX_EFFECT_KIND_ANIMATED, // changes over time, rendered every frame
+    RGB_MATRIX_EFFECT_KIND_STATIC,   // only the configuration
+    RGB_MATRIX_EFFECT_KIND_REACTIVE, // the configuration and the recent key hits
+} rgb_matrix_effect_kind_t;
+
+// In gradient mode, the solid reactive effects also cycle through the hues
+#ifdef RGB_MATRIX_SOLID_REACTIVE_GRADIENT_MODE
+#    define RGB_MATRIX_SOLID_REACTIVE_KIND ANIMATED
+#else
+#    define RGB_MATRIX_SOLID_REACTIVE_KIND REACTIVE
+#endif
+
 typedef struct PACKED {
     uint8_t x;
     uint8_t y;
@@ -2,47 +2,33 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "atomic_util.h"
+#include "spsc_ring.h"
 
 #ifndef RBUF_SIZE
 #    define RBUF_SIZE 32
 #endif
 
-static uint8_t     rbuf[RBUF_SIZE];
-static uint8_t     rbuf_head = 0;
-static uint8_t     rbuf_tail = 0;
+// The ring wraps by masking, sizes that used to work with the modulo need rounding up
+_Static_assert(RBUF_SIZE >= 2 && RBUF_SIZE <= 256 && (RBUF_SIZE & (RBUF_SIZE - 1)) == 0, "RBUF_SIZE must be a power of two between 2 and 256");
+
+SPSC_RING_DECLARE(rbuf_ring, uint8_t, RBUF_SIZE)
+
+static rbuf_ring_t rbuf;
+
 static inline bool rbuf_enqueue(uint8_t data) {
-    bool ret = false;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        uint8_t next = (rbuf_head + 1) % RBUF_SIZE;
-        if (next != rbuf_tail) {
-            rbuf[rbuf_head] = data;
-            rbuf_head       = next;
-            ret             = true;
-        }
-    }
-    return ret;
+    return rbuf_ring_push(&rbuf, data);
 }
 static inline uint8_t rbuf_dequeue(void) {
     uint8_t val = 0;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        if (rbuf_head != rbuf_tail) {
-            val       = rbuf[rbuf_tail];
-            rbuf_tail = (rbuf_tail + 1) % RBUF_SIZE;
-        }
-    }
-
+    rbuf_ring_pop(&rbuf, &val);
     return val;
 }
+static inline uint8_t rbuf_dequeue_bulk(uint8_t *data, uint8_t len) {
+    return rbuf_ring_pop_bulk(&rbuf, data, len);
+}
 static inline bool rbuf_has_data(void) {
-    bool has_data;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        has_data = (rbuf_head != rbuf_tail);
-    }
-    return has_data;
+    return !rbuf_ring_empty(&rbuf);
 }
 static inline void rbuf_clear(void) {
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        rbuf_head = rbuf_tail = 0;
-    }
+    rbuf_ring_drain(&rbuf);
 }
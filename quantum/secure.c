@@ -3,6 +3,7 @@
 
 #include "secure.h"
 #include "timer.h"
+#include "deadline.h"
 #include "util.h"
 
 #ifndef SECURE_UNLOCK_TIMEOUT
@@ -41,6 +42,11 @@ void secure_lock(void) {
 void secure_unlock(void) {
     secure_status = SECURE_UNLOCKED;
     idle_time     = timer_read32();
+#if SECURE_IDLE_TIMEOUT != 0
+    deadline_set(DEADLINE_SECURE, SECURE_IDLE_TIMEOUT);
+#else
+    deadline_clear(DEADLINE_SECURE);
+#endif
     secure_hook(secure_status);
 }
 
@@ -48,6 +54,9 @@ void secure_request_unlock(void) {
     if (secure_status == SECURE_LOCKED) {
         secure_status = SECURE_PENDING;
         unlock_time   = timer_read32();
+#if SECURE_UNLOCK_TIMEOUT != 0
+        deadline_set(DEADLINE_SECURE, SECURE_UNLOCK_TIMEOUT);
+#endif
     }
     secure_hook(secure_status);
 }
@@ -55,6 +64,9 @@ void secure_request_unlock(void) {
 void secure_activity_event(void) {
     if (secure_status == SECURE_UNLOCKED) {
         idle_time = timer_read32();
+#if SECURE_IDLE_TIMEOUT != 0
+        deadline_set(DEADLINE_SECURE, SECURE_IDLE_TIMEOUT);
+#endif
     }
 }
 
@@ -76,6 +88,11 @@ void secure_keypress_event(uint8_t row, uint8_t col) {
 }
 
 void secure_task(void) {
+    if (secure_status == SECURE_LOCKED) {
+        deadline_clear(DEADLINE_SECURE);
+        return;
+    }
+
 #if SECURE_UNLOCK_TIMEOUT != 0
     // handle unlock timeout
     if (secure_status == SECURE_PENDING) {
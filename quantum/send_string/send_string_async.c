@@ -0,0 +1,307 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "send_string_async.h"
+
+#include <ctype.h>
+#include <string.h>
+
+#include "action.h"
+#include "deferred_exec.h"
+#include "keycode.h"
+#include "spsc_ring.h"
+#include "timer.h"
+#include "util.h"
+
+#ifdef POLL_GOVERNOR_ENABLE
+#    include "poll_governor.h"
+#endif
+
+// Shortest time between two key changes, when the host poll interval is unknown
+#ifndef SEND_STRING_ASYNC_STEP_MS
+#    define SEND_STRING_ASYNC_STEP_MS 1
+#endif
+
+// Longest key change sequence a single character expands to: shift, altgr and the key, plus a dead key space
+#define SEND_STRING_ASYNC_MAX_OPS 8
+
+#define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
+
+typedef struct {
+    char (*getter)(void *);
+    union {
+        void   *align;
+        uint8_t raw[SEND_STRING_ASYNC_STATE_SIZE];
+    } state;
+    uint8_t interval;
+} send_string_async_job_t;
+
+typedef struct {
+    uint8_t keycode;
+    bool    pressed;
+    uint8_t delay;
+} send_string_async_op_t;
+
+SPSC_RING_DECLARE(send_string_async_jobs, send_string_async_job_t, SEND_STRING_ASYNC_QUEUE_SIZE)
+SPSC_RING_DECLARE(send_string_async_buffer, char, SEND_STRING_ASYNC_BUFFER_SIZE)
+
+static send_string_async_jobs_t   jobs;
+static send_string_async_buffer_t buffer;
+
+static struct {
+    send_string_async_job_t job;
+    bool                    playing;
+    send_string_async_op_t  ops[SEND_STRING_ASYNC_MAX_OPS];
+    uint8_t                 op_count;
+    uint8_t                 op_index;
+    uint8_t                 held[SEND_STRING_ASYNC_MAX_HELD];
+    uint8_t                 held_count;
+} player;
+
+static deferred_executor_t send_string_async_executors[1] = {0};
+static deferred_token      send_string_async_token        = INVALID_DEFERRED_TOKEN;
+static uint32_t            last_send_string_async_exec    = 0;
+
+static char send_string_async_get_next_buffer(void *arg) {
+    char ret = 0;
+    send_string_async_buffer_pop(&buffer, &ret);
+    return ret;
+}
+
+#if defined(__AVR__)
+static char send_string_async_get_next_progmem(void *arg) {
+    const char **string = (const char **)arg;
+    char         ret    = pgm_read_byte(*string);
+    (*string)++;
+    return ret;
+}
+#else
+static char send_string_async_get_next_memory(void *arg) {
+    const char **string = (const char **)arg;
+    char         ret    = **string;
+    (*string)++;
+    return ret;
+}
+#endif
+
+/** \brief Time to wait after a key change, long enough for the host to pick up each report */
+static uint32_t send_string_async_step_delay(uint8_t delay) {
+    uint32_t step = SEND_STRING_ASYNC_STEP_MS;
+#ifdef POLL_GOVERNOR_ENABLE
+    uint32_t interval_us = poll_governor_get_interval_us();
+    if (interval_us) {
+        step = (interval_us + 999) / 1000;
+    }
+#endif
+    return MAX(delay, step);
+}
+
+static void send_string_async_add_op(uint8_t keycode, bool pressed, uint8_t delay) {
+    player.ops[player.op_count++] = (send_string_async_op_t){.keycode = keycode, .pressed = pressed, .delay = delay};
+}
+
+static void send_string_async_add_char(char ascii_code, uint8_t interval) {
+#if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') {
+        // only starts playing the bell, does not block
+        send_char_with_delay(ascii_code, 0);
+        return;
+    }
+#endif
+
+    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+
+    if (is_shifted) {
+        send_string_async_add_op(KC_LEFT_SHIFT, true, interval);
+    }
+    if (is_altgred) {
+        send_string_async_add_op(KC_RIGHT_ALT, true, interval);
+    }
+    send_string_async_add_op(keycode, true, interval);
+    send_string_async_add_op(keycode, false, interval);
+    if (is_altgred) {
+        send_string_async_add_op(KC_RIGHT_ALT, false, interval);
+    }
+    if (is_shifted) {
+        send_string_async_add_op(KC_LEFT_SHIFT, false, interval);
+    }
+    if (is_dead) {
+        send_string_async_add_op(KC_SPACE, true, TAP_CODE_DELAY);
+        send_string_async_add_op(KC_SPACE, false, interval);
+    }
+}
+
+/**
+ * \brief Decodes the next element of the current string into key changes.
+ *
+ * \return the time to wait before carrying on, for SS_DELAY()
+ */
+static uint32_t send_string_async_decode(void) {
+    char (*getter)(void *) = player.job.getter;
+    void   *arg            = player.job.state.raw;
+    uint8_t interval       = player.job.interval;
+
+    player.op_count = 0;
+    player.op_index = 0;
+
+    char ascii_code = getter(arg);
+    if (!ascii_code) {
+        player.playing = false;
+        return 0;
+    }
+    if (ascii_code != SS_QMK_PREFIX) {
+        send_string_async_add_char(ascii_code, interval);
+        return 0;
+    }
+
+    ascii_code      = getter(arg);
+    uint8_t keycode = 0;
+    switch (ascii_code) {
+        case SS_TAP_CODE:
+            keycode = getter(arg);
+            send_string_async_add_op(keycode, true, keycode == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY);
+            send_string_async_add_op(keycode, false, interval);
+            return 0;
+        case SS_DOWN_CODE:
+            keycode = getter(arg);
+            send_string_async_add_op(keycode, true, interval);
+            return 0;
+        case SS_UP_CODE:
+            keycode = getter(arg);
+            send_string_async_add_op(keycode, false, interval);
+            return 0;
+        case SS_DELAY_CODE: {
+            uint32_t ms = 0;
+            ascii_code  = getter(arg);
+            while (isdigit(ascii_code)) {
+                ms = ms * 10 + (ascii_code - '0');
+                ascii_code = getter(arg);
+            }
+            // if the delay was terminated with a null, the string is done
+            if (ascii_code == 0) {
+                player.playing = false;
+            }
+            return ms + interval;
+        }
+        case 0:
+            player.playing = false;
+            return 0;
+        default:
+            return interval;
+    }
+}
+
+static void send_string_async_hold(uint8_t keycode, bool pressed) {
+    for (uint8_t i = 0; i < player.held_count; i++) {
+        if (player.held[i] == keycode) {
+            if (!pressed) {
+                player.held[i] = player.held[--player.held_count];
+            }
+            return;
+        }
+    }
+    if (pressed && player.held_count < SEND_STRING_ASYNC_MAX_HELD) {
+        player.held[player.held_count++] = keycode;
+    }
+}
+
+static uint32_t send_string_async_step(uint32_t trigger_time, void *cb_arg) {
+    while (player.op_index == player.op_count) {
+        if (!player.playing) {
+            if (!send_string_async_jobs_pop(&jobs, &player.job)) {
+                send_string_async_token = INVALID_DEFERRED_TOKEN;
+                return 0;
+            }
+            player.playing = true;
+        }
+        uint32_t delay = send_string_async_decode();
+        if (delay) {
+            return delay;
+        }
+    }
+
+    // a single key change per step, so every one of them makes it to the host
+    send_string_async_op_t *op = &player.ops[player.op_index++];
+    if (op->pressed) {
+        register_code(op->keycode);
+    } else {
+        unregister_code(op->keycode);
+    }
+    send_string_async_hold(op->keycode, op->pressed);
+    return send_string_async_step_delay(op->delay);
+}
+
+static bool send_string_async_start(void) {
+    if (send_string_async_token == INVALID_DEFERRED_TOKEN) {
+        // nothing ran while idle, so the throttle restarts from now
+        last_send_string_async_exec = timer_read32() - 1;
+        send_string_async_token     = defer_exec_advanced(send_string_async_executors, ARRAY_SIZE(send_string_async_executors), 1, send_string_async_step, NULL);
+    }
+    return send_string_async_token != INVALID_DEFERRED_TOKEN;
+}
+
+bool send_string_async_impl(char (*getter)(void *), const void *state, uint8_t state_size, uint8_t interval) {
+    if (state_size > SEND_STRING_ASYNC_STATE_SIZE) {
+        return false;
+    }
+
+    send_string_async_job_t job = {.getter = getter, .interval = interval};
+    memcpy(job.state.raw, state, state_size);
+    if (!send_string_async_jobs_push(&jobs, job)) {
+        return false;
+    }
+    return send_string_async_start();
+}
+
+bool send_string_async_with_delay(const char *string, uint8_t interval) {
+    size_t length = strlen(string) + 1;
+    if (length > send_string_async_buffer_space(&buffer) || send_string_async_jobs_full(&jobs)) {
+        return false;
+    }
+
+    send_string_async_buffer_push_bulk(&buffer, string, length);
+    return send_string_async_impl(send_string_async_get_next_buffer, NULL, 0, interval);
+}
+
+bool send_string_async(const char *string) {
+    return send_string_async_with_delay(string, TAP_CODE_DELAY);
+}
+
+bool send_string_async_with_delay_P(const char *string, uint8_t interval) {
+#if defined(__AVR__)
+    return send_string_async_impl(send_string_async_get_next_progmem, &string, sizeof(string), interval);
+#else
+    return send_string_async_impl(send_string_async_get_next_memory, &string, sizeof(string), interval);
+#endif
+}
+
+bool send_string_async_is_active(void) {
+    return send_string_async_token != INVALID_DEFERRED_TOKEN;
+}
+
+void send_string_async_abort(void) {
+    if (!send_string_async_is_active()) {
+        return;
+    }
+
+    cancel_deferred_exec_advanced(send_string_async_executors, ARRAY_SIZE(send_string_async_executors), send_string_async_token);
+    send_string_async_token = INVALID_DEFERRED_TOKEN;
+
+    // release what the interrupted character and SS_DOWN() still hold
+    while (player.held_count) {
+        unregister_code(player.held[--player.held_count]);
+    }
+
+    player.playing  = false;
+    player.op_count = 0;
+    player.op_index = 0;
+    send_string_async_jobs_drain(&jobs);
+    send_string_async_buffer_drain(&buffer);
+}
+
+void send_string_async_task(void) {
+    deferred_exec_advanced_task(send_string_async_executors, ARRAY_SIZE(send_string_async_executors), &last_send_string_async_exec);
+}
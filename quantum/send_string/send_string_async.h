@@ -0,0 +1,121 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/**
+ * \file
+ *
+ * \defgroup send_string_async Asynchronous Send String API
+ *
+ * \brief Queues strings to be typed out in the background, without blocking the main loop.
+ *
+ * Strings use the same encoding as `SEND_STRING()`, including `SS_TAP()`, `SS_DOWN()`, `SS_UP()` and `SS_DELAY()`.
+ * Playback advances by one key press or release at a time from `send_string_async_task()`, so the matrix keeps
+ * being scanned, and lighting and split communication keep running while a long macro is typed.
+ * \{
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "send_string.h"
+
+/**
+ * \brief Number of strings that can be queued at once. Must be a power of two.
+ */
+#ifndef SEND_STRING_ASYNC_QUEUE_SIZE
+#    define SEND_STRING_ASYNC_QUEUE_SIZE 4
+#endif
+
+/**
+ * \brief Number of bytes available for strings copied from RAM. Must be a power of two.
+ */
+#ifndef SEND_STRING_ASYNC_BUFFER_SIZE
+#    define SEND_STRING_ASYNC_BUFFER_SIZE 128
+#endif
+
+/**
+ * \brief Number of keys that can be held down through `SS_DOWN()` at once.
+ */
+#ifndef SEND_STRING_ASYNC_MAX_HELD
+#    define SEND_STRING_ASYNC_MAX_HELD 6
+#endif
+
+/**
+ * \brief Size of the getter state copied by send_string_async_impl().
+ */
+#define SEND_STRING_ASYNC_STATE_SIZE (2 * sizeof(void *))
+
+/**
+ * \brief Queue a string to be typed out, with a delay between each key press and release.
+ *
+ * The string is copied, so it does not have to outlive the call.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait in between key presses.
+ * \return false if the string does not fit into the queue, in which case none of it is typed.
+ */
+bool send_string_async_with_delay(const char *string, uint8_t interval);
+
+/**
+ * \brief Queue a string to be typed out.
+ *
+ * This function simply calls `send_string_async_with_delay(string, TAP_CODE_DELAY)`.
+ *
+ * \param string The string to type out.
+ * \return false if the string does not fit into the queue.
+ */
+bool send_string_async(const char *string);
+
+/**
+ * \brief Queue a string stored in PROGMEM to be typed out.
+ *
+ * Only a reference is queued, so the string must stay valid until it has been typed. This is the case for string
+ * literals and PROGMEM data.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait in between key presses.
+ * \return false if the queue is full.
+ */
+bool send_string_async_with_delay_P(const char *string, uint8_t interval);
+
+/**
+ * \brief Shortcut macro for send_string_async_with_delay_P(PSTR(string), 0).
+ */
+#define SEND_STRING_ASYNC(string) send_string_async_with_delay_P(PSTR(string), 0)
+
+/**
+ * \brief Shortcut macro for send_string_async_with_delay_P(PSTR(string), interval).
+ */
+#define SEND_STRING_ASYNC_DELAY(string, interval) send_string_async_with_delay_P(PSTR(string), interval)
+
+/**
+ * \brief Queue a string read through a getter function, see send_string_with_delay_impl().
+ *
+ * Playback calls the getter once per character, so slow sources such as EEPROM are only read as the string is typed.
+ *
+ * \param getter Returns the next byte of the string, advancing the state passed to it.
+ * \param state The initial getter state, copied into the queue. At most SEND_STRING_ASYNC_STATE_SIZE bytes.
+ * \param state_size The size of `state`, in bytes.
+ * \param interval The amount of time, in milliseconds, to wait in between key presses.
+ * \return false if the queue is full or the state is too large.
+ */
+bool send_string_async_impl(char (*getter)(void *), const void *state, uint8_t state_size, uint8_t interval);
+
+/**
+ * \brief Whether a string is being typed out or queued.
+ */
+bool send_string_async_is_active(void);
+
+/**
+ * \brief Stop typing, drop all queued strings and release any keys held by the current one.
+ */
+void send_string_async_abort(void);
+
+/**
+ * \brief Advances playback. Called from the main loop.
+ */
+void send_string_async_task(void);
+
+/** \} */
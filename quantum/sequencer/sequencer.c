@@ -17,6 +17,7 @@
 #include "sequencer.h"
 #include "debug.h"
 #include "timer.h"
+#include "deadline.h"
 
 #ifdef MIDI_ENABLE
 #    include "process_midi.h"
@@ -47,6 +48,7 @@ void sequencer_on(void) {
     sequencer_internal_state.current_step  = 0;
     sequencer_internal_state.timer         = timer_read();
     sequencer_internal_state.phase         = SEQUENCER_PHASE_ATTACK;
+    deadline_set(DEADLINE_SEQUENCER, 0);
 }
 
 void sequencer_off(void) {
@@ -227,7 +229,10 @@ void sequencer_phase_release(void) {
 }
 
 void sequencer_phase_pause(void) {
-    if (timer_elapsed(sequencer_internal_state.timer) < sequencer_get_step_duration()) {
+    uint16_t elapsed = timer_elapsed(sequencer_internal_state.timer);
+    if (elapsed < sequencer_get_step_duration()) {
+        // Nothing to do until the next step
+        deadline_set(DEADLINE_SEQUENCER, sequencer_get_step_duration() - elapsed);
         return;
     }
 
@@ -237,6 +242,7 @@ void sequencer_phase_pause(void) {
 
 void sequencer_task(void) {
     if (!sequencer_config.enabled) {
+        deadline_clear(DEADLINE_SEQUENCER);
         return;
     }
 
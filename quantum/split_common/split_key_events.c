@@ -0,0 +1,71 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef SPLIT_KEY_EVENTS_ENABLE
+
+#    include "split_key_events.h"
+#    include "spsc_ring.h"
+#    include "crc.h"
+
+_Static_assert(SPLIT_KEY_EVENTS_SIZE >= 2 && SPLIT_KEY_EVENTS_SIZE <= 128 && (SPLIT_KEY_EVENTS_SIZE & (SPLIT_KEY_EVENTS_SIZE - 1)) == 0, "SPLIT_KEY_EVENTS_SIZE must be a power of two between 2 and 128");
+
+#    define SPLIT_KEY_EVENTS_CHECKSUMMED(shared) ((const uint8_t *)(shared) + sizeof((shared)->checksum))
+#    define SPLIT_KEY_EVENTS_CHECKSUMMED_SIZE (sizeof(split_slave_key_events_t) - sizeof(((split_slave_key_events_t *)0)->checksum))
+
+void split_key_events_record(split_slave_key_events_t *shared, const matrix_row_t matrix[], uint16_t time) {
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; row++) {
+        matrix_row_t changes = shared->matrix[row] ^ matrix[row];
+        for (uint8_t col = 0; changes; col++, changes >>= 1) {
+            if (changes & 1) {
+                split_key_event_t *event = &shared->events[shared->sequence % SPLIT_KEY_EVENTS_SIZE];
+                event->row               = row;
+                event->col               = col;
+                event->pressed           = (matrix[row] >> col) & 1;
+                event->time              = time;
+                shared->sequence++;
+            }
+        }
+        shared->matrix[row] = matrix[row];
+    }
+    shared->checksum = crc8(SPLIT_KEY_EVENTS_CHECKSUMMED(shared), SPLIT_KEY_EVENTS_CHECKSUMMED_SIZE);
+}
+
+// Room for a full ring of events, on top of any not processed yet
+SPSC_RING_DECLARE(split_key_event_ring, split_key_event_t, SPSC_RING_ROUND_UP(SPLIT_KEY_EVENTS_SIZE * 2 + 1))
+
+static split_key_event_ring_t split_key_event_queue;
+static uint8_t                split_key_events_sequence;
+static bool                   split_key_events_synced;
+
+bool split_key_events_receive(const split_slave_key_events_t *received, uint8_t row_offset) {
+    if (received->checksum != crc8(SPLIT_KEY_EVENTS_CHECKSUMMED(received), SPLIT_KEY_EVENTS_CHECKSUMMED_SIZE)) {
+        return false;
+    }
+
+    uint8_t count = received->sequence - split_key_events_sequence;
+    // Some events were missed, or lost while queueing, the matrix tells what they added up to
+    if (!split_key_events_synced || count > SPLIT_KEY_EVENTS_SIZE || count > split_key_event_ring_space(&split_key_event_queue)) {
+        count = 0;
+    }
+
+    for (uint8_t sequence = received->sequence - count; sequence != received->sequence; sequence++) {
+        split_key_event_t event = received->events[sequence % SPLIT_KEY_EVENTS_SIZE];
+        event.row += row_offset;
+        split_key_event_ring_push(&split_key_event_queue, event);
+    }
+
+    split_key_events_sequence = received->sequence;
+    split_key_events_synced   = true;
+    return true;
+}
+
+bool split_key_events_dequeue(split_key_event_t *event) {
+    return split_key_event_ring_pop(&split_key_event_queue, event);
+}
+
+void split_key_events_reset(void) {
+    split_key_event_ring_init(&split_key_event_queue);
+    split_key_events_synced = false;
+}
+
+#endif // SPLIT_KEY_EVENTS_ENABLE
@@ -0,0 +1,70 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "matrix.h"
+#include "util.h"
+
+/*
+    Key events of the slave half, for SPLIT_KEY_EVENTS_ENABLE.
+
+    The slave records every change of its matrix as an event, stamped with
+    sync_timer_read(), into a ring in the split shared memory. The master reads
+    the whole ring, along with the slave's matrix, in a single transaction on
+    every scan, and queues the events it has not seen yet. These are processed
+    in order and with the time the slave saw them, so a roll across both halves
+    keeps its order, and tap-hold decisions are not skewed by the transport.
+
+    Events are numbered by the slave, the ring keeping the last
+    SPLIT_KEY_EVENTS_SIZE of them. When the master misses more than that, or
+    after any failed transaction, it falls back to the slave's matrix, as
+    without SPLIT_KEY_EVENTS_ENABLE.
+*/
+
+// Must be a power of two, up to 128
+#ifndef SPLIT_KEY_EVENTS_SIZE
+#    define SPLIT_KEY_EVENTS_SIZE 8
+#endif
+
+typedef struct PACKED {
+    uint8_t  row : 7; // within the half, within the whole matrix once dequeued
+    uint8_t  pressed : 1;
+    uint8_t  col;
+    uint16_t time; // sync_timer_read() when the slave saw the change
+} split_key_event_t;
+
+// As held in the split shared memory
+typedef struct PACKED {
+    uint8_t           checksum;
+    uint8_t           sequence; // number of events recorded, modulo 256
+    matrix_row_t      matrix[(MATRIX_ROWS) / 2];
+    split_key_event_t events[SPLIT_KEY_EVENTS_SIZE]; // event n at events[n % SPLIT_KEY_EVENTS_SIZE]
+} split_slave_key_events_t;
+
+/**
+ * @brief Slave: records the changes of the matrix since the last call, and updates the checksum.
+ */
+void split_key_events_record(split_slave_key_events_t *shared, const matrix_row_t matrix[], uint16_t time);
+
+/**
+ * @brief Master: queues the events of a copy of the slave's ring that have not been queued yet.
+ *
+ * @param row_offset added to the row of each event, i.e. the first row of the slave half
+ * @return false if the checksum does not match, in which case nothing is queued
+ */
+bool split_key_events_receive(const split_slave_key_events_t *received, uint8_t row_offset);
+
+/**
+ * @brief Master: removes the oldest queued event, with its row in the whole matrix.
+ */
+bool split_key_events_dequeue(split_key_event_t *event);
+
+/**
+ * @brief Master: forgets the queued events, and the events seen so far.
+ *
+ * The next copy received is only used for its matrix, as its events may have been missed.
+ */
+void split_key_events_reset(void);
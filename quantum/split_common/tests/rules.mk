@@ -0,0 +1,9 @@
+split_key_events_DEFS := -DSPLIT_KEY_EVENTS_ENABLE -DMATRIX_ROWS=4 -DMATRIX_COLS=10 -DSPLIT_KEY_EVENTS_SIZE=4
+
+split_key_events_SRC := \
+    $(QUANTUM_PATH)/split_common/tests/split_key_events_tests.cpp \
+    $(QUANTUM_PATH)/split_common/split_key_events.c \
+    $(QUANTUM_PATH)/crc.c
+
+split_key_events_INC := \
+    $(QUANTUM_PATH)/split_common
@@ -0,0 +1,192 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "split_key_events.h"
+}
+
+namespace {
+
+// Both halves in one process, the transaction being a copy of the slave's shared memory
+class SplitKeyEvents : public ::testing::Test {
+   protected:
+    static constexpr uint8_t ROW_OFFSET = (MATRIX_ROWS) / 2;
+
+    split_slave_key_events_t shared                          = {};
+    matrix_row_t             slave_matrix[(MATRIX_ROWS) / 2] = {};
+    uint16_t                 now                             = 1000;
+
+    void SetUp() override {
+        split_key_events_reset();
+        split_key_events_record(&shared, slave_matrix, now);
+    }
+
+    // One run of the slave's main loop
+    void slave_scan(uint8_t row, uint8_t col, bool pressed) {
+        if (pressed) {
+            slave_matrix[row] |= (matrix_row_t)1 << col;
+        } else {
+            slave_matrix[row] &= ~((matrix_row_t)1 << col);
+        }
+        split_key_events_record(&shared, slave_matrix, now++);
+    }
+
+    bool transfer(int corrupt_byte = -1) {
+        split_slave_key_events_t received = shared;
+        if (corrupt_byte >= 0) {
+            ((uint8_t *)&received)[corrupt_byte] ^= 0x10;
+        }
+        return split_key_events_receive(&received, ROW_OFFSET);
+    }
+
+    std::vector<split_key_event_t> dequeue_all() {
+        std::vector<split_key_event_t> events;
+        split_key_event_t              event;
+        while (split_key_events_dequeue(&event)) {
+            events.push_back(event);
+        }
+        return events;
+    }
+};
+
+void expect_event(const split_key_event_t &event, uint8_t row, uint8_t col, bool pressed, uint16_t time) {
+    EXPECT_EQ(event.row, row);
+    EXPECT_EQ(event.col, col);
+    EXPECT_EQ(event.pressed, pressed);
+    EXPECT_EQ(event.time, time);
+}
+
+} // namespace
+
+TEST_F(SplitKeyEvents, FirstReadOnlyCatchesUp) {
+    slave_scan(0, 1, true);
+
+    EXPECT_TRUE(transfer());
+    EXPECT_TRUE(dequeue_all().empty());
+}
+
+TEST_F(SplitKeyEvents, QueuesEventsWithTheSlaveTime) {
+    EXPECT_TRUE(transfer());
+
+    slave_scan(0, 1, true);
+    slave_scan(1, 9, true);
+    slave_scan(0, 1, false);
+    EXPECT_TRUE(transfer());
+
+    auto events = dequeue_all();
+    ASSERT_EQ(events.size(), 3);
+    expect_event(events[0], ROW_OFFSET + 0, 1, true, 1000);
+    expect_event(events[1], ROW_OFFSET + 1, 9, true, 1001);
+    expect_event(events[2], ROW_OFFSET + 0, 1, false, 1002);
+}
+
+TEST_F(SplitKeyEvents, KeepsTapsBetweenReads) {
+    EXPECT_TRUE(transfer());
+
+    slave_scan(1, 2, true);
+    slave_scan(1, 2, false);
+    EXPECT_TRUE(transfer());
+
+    // The matrix did not change, the events still tell about the tap
+    EXPECT_EQ(shared.matrix[1], 0);
+    auto events = dequeue_all();
+    ASSERT_EQ(events.size(), 2);
+    expect_event(events[0], ROW_OFFSET + 1, 2, true, 1000);
+    expect_event(events[1], ROW_OFFSET + 1, 2, false, 1001);
+}
+
+TEST_F(SplitKeyEvents, OrdersChangesOfOneScan) {
+    EXPECT_TRUE(transfer());
+
+    slave_matrix[1] = 0b101;
+    slave_matrix[0] = 0b10;
+    split_key_events_record(&shared, slave_matrix, now);
+    EXPECT_TRUE(transfer());
+
+    auto events = dequeue_all();
+    ASSERT_EQ(events.size(), 3);
+    expect_event(events[0], ROW_OFFSET + 0, 1, true, 1000);
+    expect_event(events[1], ROW_OFFSET + 1, 0, true, 1000);
+    expect_event(events[2], ROW_OFFSET + 1, 2, true, 1000);
+}
+
+TEST_F(SplitKeyEvents, QueuesEachEventOnce) {
+    EXPECT_TRUE(transfer());
+
+    slave_scan(0, 0, true);
+    EXPECT_TRUE(transfer());
+    EXPECT_TRUE(transfer());
+    slave_scan(0, 0, false);
+    EXPECT_TRUE(transfer());
+
+    auto events = dequeue_all();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_TRUE(events[0].pressed);
+    EXPECT_FALSE(events[1].pressed);
+}
+
+TEST_F(SplitKeyEvents, FallsBackToTheMatrixWhenEventsAreMissed) {
+    EXPECT_TRUE(transfer());
+
+    // One more than the ring holds
+    for (uint8_t col = 0; col <= SPLIT_KEY_EVENTS_SIZE; col++) {
+        slave_scan(0, col, true);
+    }
+    EXPECT_TRUE(transfer());
+    EXPECT_TRUE(dequeue_all().empty());
+    EXPECT_EQ(shared.matrix[0], (1 << (SPLIT_KEY_EVENTS_SIZE + 1)) - 1);
+
+    // Back in step from there
+    slave_scan(1, 0, true);
+    EXPECT_TRUE(transfer());
+    auto events = dequeue_all();
+    ASSERT_EQ(events.size(), 1);
+    expect_event(events[0], ROW_OFFSET + 1, 0, true, 1000 + SPLIT_KEY_EVENTS_SIZE + 1);
+}
+
+TEST_F(SplitKeyEvents, RejectsCorruptedCopies) {
+    EXPECT_TRUE(transfer());
+
+    slave_scan(0, 3, true);
+    for (size_t i = 0; i < sizeof(shared); i++) {
+        EXPECT_FALSE(transfer(i)) << "byte " << i;
+    }
+    EXPECT_TRUE(dequeue_all().empty());
+
+    EXPECT_TRUE(transfer());
+    EXPECT_EQ(dequeue_all().size(), 1);
+}
+
+TEST_F(SplitKeyEvents, CatchesUpAfterAReset) {
+    EXPECT_TRUE(transfer());
+
+    slave_scan(0, 3, true);
+    split_key_events_reset();
+    EXPECT_TRUE(transfer());
+    EXPECT_TRUE(dequeue_all().empty());
+
+    slave_scan(0, 3, false);
+    EXPECT_TRUE(transfer());
+    EXPECT_EQ(dequeue_all().size(), 1);
+}
+
+TEST_F(SplitKeyEvents, WrapsTheSequence) {
+    EXPECT_TRUE(transfer());
+
+    unsigned count = 0;
+    for (int i = 0; i < 300; i++) {
+        slave_scan(1, 4, (i & 1) == 0);
+        if (i % 3 == 0) {
+            EXPECT_TRUE(transfer());
+            count += dequeue_all().size();
+        }
+    }
+    EXPECT_TRUE(transfer());
+    count += dequeue_all().size();
+
+    EXPECT_EQ(count, 300);
+}
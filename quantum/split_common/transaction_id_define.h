@@ -21,8 +21,12 @@ enum serial_transaction_id {
     I2C_EXECUTE_CALLBACK,
 #endif // USE_I2C
 
+#ifdef SPLIT_KEY_EVENTS_ENABLE
+    GET_SLAVE_KEY_EVENTS,
+#else // SPLIT_KEY_EVENTS_ENABLE
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
+#endif // SPLIT_KEY_EVENTS_ENABLE
 
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
@@ -30,6 +30,7 @@
 #include "transaction_id_define.h"
 #include "split_util.h"
 #include "synchronization_util.h"
+#include "keyboard.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -178,6 +179,43 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifdef SPLIT_KEY_EVENTS_ENABLE
+
+#    ifdef DISABLE_SYNC_TIMER
+#        error "SPLIT_KEY_EVENTS_ENABLE needs the sync timer to timestamp the events of the slave"
+#    endif
+
+static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static matrix_row_t      last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
+    split_slave_key_events_t temp_events;                          // holding area while we test whether or not checksum is correct
+
+    // The events and the matrix, in a single transaction whether or not anything changed
+    bool okay = transport_read(GET_SLAVE_KEY_EVENTS, &temp_events, sizeof(temp_events));
+    okay      = okay && split_key_events_receive(&temp_events, is_keyboard_left() ? (MATRIX_ROWS) / 2 : 0);
+    if (okay) {
+        memcpy(last_matrix, temp_events.matrix, sizeof(last_matrix));
+    } else {
+        // Events may be missed until the next successful read, which only catches up with the matrix
+        split_key_events_reset();
+    }
+    // Copy out the last-known-good matrix state to the slave matrix
+    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+    return okay;
+}
+
+static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_key_events_record(&split_shmem->skey_events, slave_matrix, sync_timer_read());
+}
+
+// clang-format off
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+    [GET_SLAVE_KEY_EVENTS] = trans_target2initiator_initializer(skey_events),
+// clang-format on
+
+#else // SPLIT_KEY_EVENTS_ENABLE
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
@@ -199,13 +237,15 @@ static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row
 }
 
 // clang-format off
-#define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
     [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
 // clang-format on
 
+#endif // SPLIT_KEY_EVENTS_ENABLE
+
 ////////////////////////////////////////////////////
 // Master matrix
 
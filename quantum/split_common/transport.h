@@ -52,6 +52,10 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 #    include "rgblight.h"
 #endif // RGBLIGHT_ENABLE
 
+#ifdef SPLIT_KEY_EVENTS_ENABLE
+#    include "split_key_events.h"
+#endif // SPLIT_KEY_EVENTS_ENABLE
+
 typedef struct _split_slave_matrix_sync_t {
     uint8_t      checksum;
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
@@ -152,7 +156,11 @@ typedef struct _split_shared_memory_t {
     int8_t transaction_id;
 #endif // USE_I2C
 
+#ifdef SPLIT_KEY_EVENTS_ENABLE
+    split_slave_key_events_t skey_events;
+#else // SPLIT_KEY_EVENTS_ENABLE
     split_slave_matrix_sync_t smatrix;
+#endif // SPLIT_KEY_EVENTS_ENABLE
 
 #ifdef SPLIT_TRANSPORT_MIRROR
     split_master_matrix_sync_t mmatrix;
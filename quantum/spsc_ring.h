@@ -0,0 +1,138 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+/*
+    Lock-free single-producer/single-consumer ring buffers.
+
+    SPSC_RING_DECLARE(name, type, size) generates the ring type `name_t`,
+    holding up to `size - 1` elements of `type`, along with static inline
+    functions to operate on it:
+
+      name_init(ring)                 - empties the ring
+      name_push(ring, item)           - producer: appends an item, false if full
+      name_push_bulk(ring, items, n)  - producer: appends as many of n items as fit
+      name_pop(ring, &item)           - consumer: removes the oldest item, false if empty
+      name_pop_bulk(ring, items, n)   - consumer: removes up to n items
+      name_peek(ring, &item)          - consumer: reads the oldest item without removing it
+      name_drain(ring)                - consumer: discards everything queued so far
+      name_count(ring), name_empty(ring), name_full(ring), name_space(ring)
+
+    Exactly one context may push and exactly one context may pop, e.g. an
+    interrupt handler producing events for the main loop. Neither side has to
+    disable interrupts: each side only ever writes its own position, and only
+    publishes it once the element it covers has been written or read.
+
+    `size` must be a power of two between 2 and 256. Positions wrap by masking
+    and fit a single byte, which is read and written atomically everywhere.
+*/
+
+#ifdef __cplusplus
+#    define SPSC_RING_STATIC_ASSERT static_assert
+#else
+#    define SPSC_RING_STATIC_ASSERT _Static_assert
+#endif
+
+#define SPSC_RING_LOAD(pos) __atomic_load_n(&(pos), __ATOMIC_ACQUIRE)
+#define SPSC_RING_STORE(pos, val) __atomic_store_n(&(pos), (val), __ATOMIC_RELEASE)
+
+// Smallest valid ring size holding at least n - 1 elements
+#define SPSC_RING_ROUND_UP(n) ((n) <= 2 ? 2 : (n) <= 4 ? 4 : (n) <= 8 ? 8 : (n) <= 16 ? 16 : (n) <= 32 ? 32 : (n) <= 64 ? 64 : (n) <= 128 ? 128 : 256)
+
+// clang-format off
+#define SPSC_RING_DECLARE(name, type, size)                                                                     \
+    SPSC_RING_STATIC_ASSERT((size) >= 2 && (size) <= 256 && ((size) & ((size) - 1)) == 0,                       \
+                            #name " size must be a power of two between 2 and 256");                            \
+                                                                                                                \
+    typedef struct {                                                                                            \
+        uint8_t head;                                                                                           \
+        uint8_t tail;                                                                                           \
+        type    buffer[size];                                                                                   \
+    } name##_t;                                                                                                 \
+                                                                                                                \
+    static inline void name##_init(name##_t *ring) {                                                            \
+        ring->head = 0;                                                                                         \
+        ring->tail = 0;                                                                                         \
+    }                                                                                                           \
+                                                                                                                \
+    static inline uint8_t name##_count(name##_t *ring) {                                                        \
+        return (uint8_t)(SPSC_RING_LOAD(ring->head) - SPSC_RING_LOAD(ring->tail)) & ((size) - 1);               \
+    }                                                                                                           \
+                                                                                                                \
+    static inline uint8_t name##_space(name##_t *ring) {                                                        \
+        return (size) - 1 - name##_count(ring);                                                                 \
+    }                                                                                                           \
+                                                                                                                \
+    static inline bool name##_empty(name##_t *ring) {                                                           \
+        return SPSC_RING_LOAD(ring->head) == SPSC_RING_LOAD(ring->tail);                                        \
+    }                                                                                                           \
+                                                                                                                \
+    static inline bool name##_full(name##_t *ring) {                                                            \
+        return name##_count(ring) == (size) - 1;                                                                \
+    }                                                                                                           \
+                                                                                                                \
+    static inline bool name##_push(name##_t *ring, type item) {                                                 \
+        uint8_t head = ring->head;                                                                              \
+        uint8_t next = (head + 1) & ((size) - 1);                                                               \
+        if (next == SPSC_RING_LOAD(ring->tail)) {                                                               \
+            return false;                                                                                       \
+        }                                                                                                       \
+        ring->buffer[head] = item;                                                                              \
+        SPSC_RING_STORE(ring->head, next);                                                                      \
+        return true;                                                                                            \
+    }                                                                                                           \
+                                                                                                                \
+    static inline uint8_t name##_push_bulk(name##_t *ring, const type *items, uint8_t n) {                      \
+        uint8_t head = ring->head;                                                                              \
+        uint8_t space = (uint8_t)(SPSC_RING_LOAD(ring->tail) - head - 1) & ((size) - 1);                        \
+        if (n > space) {                                                                                        \
+            n = space;                                                                                          \
+        }                                                                                                       \
+        uint8_t first = (size) - head < n ? (size) - head : n;                                                  \
+        memcpy(&ring->buffer[head], items, first * sizeof(type));                                               \
+        memcpy(&ring->buffer[0], items + first, (n - first) * sizeof(type));                                    \
+        SPSC_RING_STORE(ring->head, (uint8_t)(head + n) & ((size) - 1));                                        \
+        return n;                                                                                               \
+    }                                                                                                           \
+                                                                                                                \
+    static inline bool name##_peek(name##_t *ring, type *item) {                                                \
+        uint8_t tail = ring->tail;                                                                              \
+        if (tail == SPSC_RING_LOAD(ring->head)) {                                                               \
+            return false;                                                                                       \
+        }                                                                                                       \
+        *item = ring->buffer[tail];                                                                             \
+        return true;                                                                                            \
+    }                                                                                                           \
+                                                                                                                \
+    static inline bool name##_pop(name##_t *ring, type *item) {                                                 \
+        uint8_t tail = ring->tail;                                                                              \
+        if (tail == SPSC_RING_LOAD(ring->head)) {                                                               \
+            return false;                                                                                       \
+        }                                                                                                       \
+        *item = ring->buffer[tail];                                                                             \
+        SPSC_RING_STORE(ring->tail, (uint8_t)(tail + 1) & ((size) - 1));                                        \
+        return true;                                                                                            \
+    }                                                                                                           \
+                                                                                                                \
+    static inline uint8_t name##_pop_bulk(name##_t *ring, type *items, uint8_t n) {                             \
+        uint8_t tail  = ring->tail;                                                                             \
+        uint8_t avail = (uint8_t)(SPSC_RING_LOAD(ring->head) - tail) & ((size) - 1);                            \
+        if (n > avail) {                                                                                        \
+            n = avail;                                                                                          \
+        }                                                                                                       \
+        uint8_t first = (size) - tail < n ? (size) - tail : n;                                                  \
+        memcpy(items, &ring->buffer[tail], first * sizeof(type));                                               \
+        memcpy(items + first, &ring->buffer[0], (n - first) * sizeof(type));                                    \
+        SPSC_RING_STORE(ring->tail, (uint8_t)(tail + n) & ((size) - 1));                                        \
+        return n;                                                                                               \
+    }                                                                                                           \
+                                                                                                                \
+    static inline void name##_drain(name##_t *ring) {                                                           \
+        SPSC_RING_STORE(ring->tail, SPSC_RING_LOAD(ring->head));                                                \
+    }
+// clang-format on
@@ -0,0 +1,5 @@
+spsc_ring_SRC := \
+    $(QUANTUM_PATH)/spsc_ring/tests/spsc_ring_tests.cpp
+
+spsc_ring_INC := \
+    $(DRIVER_PATH)/bluetooth
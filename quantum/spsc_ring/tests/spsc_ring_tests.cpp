@@ -0,0 +1,221 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "spsc_ring.h"
+}
+#include "ringbuffer.hpp"
+
+namespace {
+
+typedef struct {
+    uint32_t seq;
+    uint32_t check;
+} sample_t;
+
+SPSC_RING_DECLARE(byte_ring, uint8_t, 8)
+SPSC_RING_DECLARE(sample_ring, sample_t, 16)
+SPSC_RING_DECLARE(large_ring, uint8_t, 256)
+
+const uint32_t STRESS_ITEMS = 500000;
+
+sample_t make_sample(uint32_t seq) {
+    return {seq, ~seq * 2654435761u};
+}
+
+} // namespace
+
+TEST(SpscRing, StartsEmpty) {
+    byte_ring_t ring;
+    byte_ring_init(&ring);
+    uint8_t val = 0xAA;
+
+    EXPECT_TRUE(byte_ring_empty(&ring));
+    EXPECT_FALSE(byte_ring_full(&ring));
+    EXPECT_EQ(byte_ring_count(&ring), 0);
+    EXPECT_EQ(byte_ring_space(&ring), 7);
+    EXPECT_FALSE(byte_ring_pop(&ring, &val));
+    EXPECT_FALSE(byte_ring_peek(&ring, &val));
+    EXPECT_EQ(val, 0xAA);
+}
+
+TEST(SpscRing, HoldsSizeMinusOne) {
+    byte_ring_t ring;
+    byte_ring_init(&ring);
+
+    for (uint8_t i = 0; i < 7; i++) {
+        EXPECT_TRUE(byte_ring_push(&ring, i));
+    }
+    EXPECT_TRUE(byte_ring_full(&ring));
+    EXPECT_FALSE(byte_ring_push(&ring, 7));
+    EXPECT_EQ(byte_ring_count(&ring), 7);
+
+    uint8_t val;
+    for (uint8_t i = 0; i < 7; i++) {
+        EXPECT_TRUE(byte_ring_peek(&ring, &val));
+        EXPECT_EQ(val, i);
+        EXPECT_TRUE(byte_ring_pop(&ring, &val));
+        EXPECT_EQ(val, i);
+    }
+    EXPECT_TRUE(byte_ring_empty(&ring));
+}
+
+TEST(SpscRing, WrapsAround) {
+    byte_ring_t ring;
+    byte_ring_init(&ring);
+
+    uint8_t next_in = 0, next_out = 0, val;
+    for (int round = 0; round < 100; round++) {
+        for (int i = 0; i < round % 7 + 1; i++) {
+            ASSERT_TRUE(byte_ring_push(&ring, next_in++));
+        }
+        while (byte_ring_pop(&ring, &val)) {
+            ASSERT_EQ(val, next_out++);
+        }
+    }
+    EXPECT_EQ(next_in, next_out);
+}
+
+TEST(SpscRing, BulkAcrossTheWrap) {
+    byte_ring_t ring;
+    byte_ring_init(&ring);
+
+    const uint8_t in[] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    uint8_t       out[9];
+
+    // move the positions near the end of the buffer first
+    EXPECT_EQ(byte_ring_push_bulk(&ring, in, 5), 5);
+    EXPECT_EQ(byte_ring_pop_bulk(&ring, out, 5), 5);
+
+    // only as many as fit are taken
+    EXPECT_EQ(byte_ring_push_bulk(&ring, in, 9), 7);
+    EXPECT_TRUE(byte_ring_full(&ring));
+    EXPECT_EQ(byte_ring_pop_bulk(&ring, out, 3), 3);
+    EXPECT_EQ(byte_ring_pop_bulk(&ring, out + 3, 9), 4);
+    EXPECT_EQ(0, memcmp(in, out, 7));
+    EXPECT_EQ(byte_ring_pop_bulk(&ring, out, 9), 0);
+}
+
+TEST(SpscRing, DrainDiscardsQueued) {
+    byte_ring_t ring;
+    byte_ring_init(&ring);
+
+    byte_ring_push(&ring, 1);
+    byte_ring_push(&ring, 2);
+    byte_ring_drain(&ring);
+    EXPECT_TRUE(byte_ring_empty(&ring));
+
+    uint8_t val;
+    byte_ring_push(&ring, 3);
+    EXPECT_TRUE(byte_ring_pop(&ring, &val));
+    EXPECT_EQ(val, 3);
+}
+
+TEST(SpscRing, FullByteSizedRing) {
+    large_ring_t ring;
+    large_ring_init(&ring);
+
+    uint8_t in[255], out[255];
+    for (int i = 0; i < 255; i++) {
+        in[i] = i;
+    }
+    EXPECT_EQ(large_ring_push_bulk(&ring, in, 255), 255);
+    EXPECT_TRUE(large_ring_full(&ring));
+    EXPECT_EQ(large_ring_count(&ring), 255);
+    EXPECT_EQ(large_ring_pop_bulk(&ring, out, 255), 255);
+    EXPECT_EQ(0, memcmp(in, out, sizeof(in)));
+}
+
+TEST(SpscRing, RoundUp) {
+    EXPECT_EQ(SPSC_RING_ROUND_UP(1), 2);
+    EXPECT_EQ(SPSC_RING_ROUND_UP(4), 4);
+    EXPECT_EQ(SPSC_RING_ROUND_UP(5), 8);
+    EXPECT_EQ(SPSC_RING_ROUND_UP(129), 256);
+}
+
+TEST(SpscRing, StressTwoThreads) {
+    sample_ring_t ring;
+    sample_ring_init(&ring);
+
+    std::thread producer([&] {
+        uint32_t seq = 0;
+        while (seq < STRESS_ITEMS) {
+            if (seq % 3) {
+                if (sample_ring_push(&ring, make_sample(seq))) {
+                    seq++;
+                } else {
+                    std::this_thread::yield();
+                }
+            } else {
+                sample_t batch[5];
+                uint8_t  n = std::min<uint32_t>(5, STRESS_ITEMS - seq);
+                for (uint8_t i = 0; i < n; i++) {
+                    batch[i] = make_sample(seq + i);
+                }
+                uint8_t pushed = sample_ring_push_bulk(&ring, batch, n);
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+                seq += pushed;
+            }
+        }
+    });
+
+    uint32_t expected = 0, errors = 0;
+    while (expected < STRESS_ITEMS) {
+        sample_t batch[7];
+        uint8_t  n;
+        if (expected % 2) {
+            n = sample_ring_pop(&ring, &batch[0]) ? 1 : 0;
+        } else {
+            n = sample_ring_pop_bulk(&ring, batch, 7);
+        }
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+        for (uint8_t i = 0; i < n; i++) {
+            sample_t want = make_sample(expected++);
+            if (batch[i].seq != want.seq || batch[i].check != want.check) {
+                errors++;
+            }
+        }
+    }
+    producer.join();
+
+    EXPECT_EQ(errors, 0u);
+    EXPECT_TRUE(sample_ring_empty(&ring));
+}
+
+TEST(SpscRing, StressRingBufferClass) {
+    RingBuffer<uint32_t, 4> ring;
+
+    std::thread producer([&] {
+        for (uint32_t seq = 0; seq < STRESS_ITEMS; seq++) {
+            while (!ring.enqueue(seq)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t expected = 0, errors = 0, item;
+    while (expected < STRESS_ITEMS) {
+        if (ring.peek(item)) {
+            ring.get(item);
+            if (item != expected) {
+                errors++;
+            }
+            expected++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT_EQ(errors, 0u);
+    EXPECT_TRUE(ring.empty());
+}
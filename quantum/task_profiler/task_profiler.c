@@ -0,0 +1,221 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "task_profiler.h"
+#include "timer.h"
+#include "debug.h"
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <hal.h>
+#    include "chibios_config.h"
+#endif
+
+#if defined(PROTOCOL_CHIBIOS) && defined(__CORTEX_M) && (__CORTEX_M >= 3)
+// Cycle counter of the Data Watchpoint and Trace unit
+#    define TASK_PROFILER_TICKS_PER_SECOND CPU_CLOCK
+
+static void task_profiler_timer_init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+uint32_t task_profiler_read(void) {
+    return DWT->CYCCNT;
+}
+#elif defined(PROTOCOL_CHIBIOS) || defined(__AVR__)
+// Only tells apart stages that take milliseconds, but is available everywhere
+#    define TASK_PROFILER_TICKS_PER_SECOND 1000
+
+static void task_profiler_timer_init(void) {}
+
+uint32_t task_profiler_read(void) {
+    return timer_read32();
+}
+#else
+#    include <time.h>
+#    define TASK_PROFILER_TICKS_PER_SECOND 1000000000
+
+static void task_profiler_timer_init(void) {}
+
+uint32_t task_profiler_read(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+#endif
+
+// Two buckets for every power of two, so the 99th percentile is within 50% of the actual value
+#define TASK_PROFILER_BUCKETS 64
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint16_t histogram[TASK_PROFILER_BUCKETS];
+} task_profiler_data_t;
+
+static task_profiler_data_t task_profiler_data[TASK_PROFILER_STAGE_COUNT];
+
+static const char *const task_profiler_stage_names[TASK_PROFILER_STAGE_COUNT] = {
+    [TASK_PROFILER_KEYBOARD_TASK]   = "keyboard_task",
+    [TASK_PROFILER_MATRIX]          = "matrix",
+    [TASK_PROFILER_QUANTUM]         = "quantum",
+    [TASK_PROFILER_RGB_MATRIX]      = "rgb_matrix",
+    [TASK_PROFILER_LED_MATRIX]      = "led_matrix",
+    [TASK_PROFILER_OLED]            = "oled",
+    [TASK_PROFILER_POINTING_DEVICE] = "pointing_device",
+    [TASK_PROFILER_ENCODER]         = "encoder",
+    [TASK_PROFILER_SPLIT]           = "split",
+    [TASK_PROFILER_HOUSEKEEPING]    = "housekeeping",
+};
+
+static uint8_t task_profiler_bucket(uint32_t ticks) {
+    if (ticks < 2) {
+        return ticks;
+    }
+    uint8_t msb = (sizeof(unsigned long) * 8 - 1) - __builtin_clzl(ticks);
+    return msb * 2 + ((ticks >> (msb - 1)) & 1);
+}
+
+// Largest value that falls into the bucket
+static uint32_t task_profiler_bucket_limit(uint8_t bucket) {
+    if (bucket < 2) {
+        return bucket;
+    }
+    uint8_t  msb   = bucket / 2;
+    uint32_t lower = ((uint32_t)1 << msb) | ((uint32_t)(bucket & 1) << (msb - 1));
+    return lower + (((uint32_t)1 << (msb - 1)) - 1);
+}
+
+static uint32_t task_profiler_ticks_to_ns(uint32_t ticks) {
+    uint64_t ns = (uint64_t)ticks * 1000000000 / TASK_PROFILER_TICKS_PER_SECOND;
+    return ns > UINT32_MAX ? UINT32_MAX : ns;
+}
+
+void task_profiler_record(task_profiler_stage_t stage, uint32_t ticks) {
+    task_profiler_data_t *data = &task_profiler_data[stage];
+
+    if (data->count == 0 || ticks < data->min) {
+        data->min = ticks;
+    }
+    if (ticks > data->max) {
+        data->max = ticks;
+    }
+    data->count++;
+    data->sum += ticks;
+
+    uint8_t bucket = task_profiler_bucket(ticks);
+    if (data->histogram[bucket] == UINT16_MAX) {
+        // Keeps the proportions, at a lower resolution
+        for (uint8_t i = 0; i < TASK_PROFILER_BUCKETS; i++) {
+            data->histogram[i] /= 2;
+        }
+    }
+    data->histogram[bucket]++;
+}
+
+bool task_profiler_get_stats(task_profiler_stage_t stage, task_profiler_stats_t *stats) {
+    const task_profiler_data_t *data = &task_profiler_data[stage];
+    if (data->count == 0) {
+        return false;
+    }
+
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < TASK_PROFILER_BUCKETS; i++) {
+        total += data->histogram[i];
+    }
+
+    // The bucket holding the sample that 99% of the samples do not exceed
+    uint32_t rank = total - total / 100;
+    uint32_t seen = 0;
+    uint32_t p99  = data->max;
+    for (uint8_t i = 0; i < TASK_PROFILER_BUCKETS; i++) {
+        seen += data->histogram[i];
+        if (seen >= rank) {
+            uint32_t limit = task_profiler_bucket_limit(i);
+            p99            = limit < data->max ? limit : data->max;
+            break;
+        }
+    }
+
+    stats->count = data->count;
+    stats->min   = task_profiler_ticks_to_ns(data->min);
+    stats->avg   = task_profiler_ticks_to_ns(data->sum / data->count);
+    stats->max   = task_profiler_ticks_to_ns(data->max);
+    stats->p99   = task_profiler_ticks_to_ns(p99);
+    return true;
+}
+
+const char *task_profiler_stage_name(task_profiler_stage_t stage) {
+    return stage < TASK_PROFILER_STAGE_COUNT ? task_profiler_stage_names[stage] : "unknown";
+}
+
+void task_profiler_reset(void) {
+    memset(task_profiler_data, 0, sizeof(task_profiler_data));
+}
+
+void task_profiler_init(void) {
+    task_profiler_timer_init();
+    task_profiler_reset();
+}
+
+void task_profiler_task(void) {
+#if TASK_PROFILER_REPORT_INTERVAL > 0
+    static uint32_t last_report = 0;
+    if (timer_elapsed32(last_report) < TASK_PROFILER_REPORT_INTERVAL) {
+        return;
+    }
+    last_report = timer_read32();
+
+    if (debug_enable) {
+        for (uint8_t stage = 0; stage < TASK_PROFILER_STAGE_COUNT; stage++) {
+            task_profiler_stats_t stats;
+            if (task_profiler_get_stats(stage, &stats)) {
+                dprintf("task_profiler: %-15s n=%lu min=%lu avg=%lu max=%lu p99=%lu ns\n", task_profiler_stage_name(stage), (unsigned long)stats.count, (unsigned long)stats.min, (unsigned long)stats.avg, (unsigned long)stats.max, (unsigned long)stats.p99);
+            }
+        }
+    }
+    task_profiler_reset();
+#endif
+}
+
+#ifdef RAW_ENABLE
+static void task_profiler_put_u32(uint8_t *data, uint32_t value) {
+    data[0] = value >> 24;
+    data[1] = value >> 16;
+    data[2] = value >> 8;
+    data[3] = value;
+}
+
+bool task_profiler_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 23 || data[0] != TASK_PROFILER_RAW_HID_ID) {
+        return false;
+    }
+
+    uint8_t               stage = data[1];
+    bool                  reset = data[2];
+    task_profiler_stats_t stats = {0};
+    if (stage < TASK_PROFILER_STAGE_COUNT) {
+        task_profiler_get_stats(stage, &stats);
+    }
+
+    data[2] = TASK_PROFILER_STAGE_COUNT;
+    task_profiler_put_u32(&data[3], stats.count);
+    task_profiler_put_u32(&data[7], stats.min);
+    task_profiler_put_u32(&data[11], stats.avg);
+    task_profiler_put_u32(&data[15], stats.max);
+    task_profiler_put_u32(&data[19], stats.p99);
+
+    if (reset && stage < TASK_PROFILER_STAGE_COUNT) {
+        memset(&task_profiler_data[stage], 0, sizeof(task_profiler_data[stage]));
+    }
+
+    raw_hid_send(data, length);
+    return true;
+}
+#endif
@@ -0,0 +1,113 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    The task profiler times each stage of the main loop, keeping the number
+    of runs, the shortest, average and longest run, and the 99th percentile
+    of each stage since the last reset.
+
+    Stages are timed with the DWT cycle counter on Cortex-M3 and up, with
+    clock_gettime() in host builds, and with the millisecond timer anywhere
+    else. Stages nest, e.g. the split transactions are also part of the
+    matrix stage, and keyboard_task covers all of the stages within it.
+
+    The results are printed over the console every
+    TASK_PROFILER_REPORT_INTERVAL milliseconds while debug is enabled, and
+    can be read with the raw HID request described at
+    task_profiler_raw_hid_receive().
+*/
+
+typedef enum {
+    TASK_PROFILER_KEYBOARD_TASK,
+    TASK_PROFILER_MATRIX,
+    TASK_PROFILER_QUANTUM,
+    TASK_PROFILER_RGB_MATRIX,
+    TASK_PROFILER_LED_MATRIX,
+    TASK_PROFILER_OLED,
+    TASK_PROFILER_POINTING_DEVICE,
+    TASK_PROFILER_ENCODER,
+    TASK_PROFILER_SPLIT,
+    TASK_PROFILER_HOUSEKEEPING,
+    TASK_PROFILER_STAGE_COUNT,
+} task_profiler_stage_t;
+
+#ifdef TASK_PROFILER_ENABLE
+
+// How often the results are printed and reset, 0 to never print them
+#    ifndef TASK_PROFILER_REPORT_INTERVAL
+#        define TASK_PROFILER_REPORT_INTERVAL 10000
+#    endif
+
+// First byte of the raw HID requests, clear of the VIA command IDs
+#    ifndef TASK_PROFILER_RAW_HID_ID
+#        define TASK_PROFILER_RAW_HID_ID 0xF0
+#    endif
+
+// All times in nanoseconds
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t avg;
+    uint32_t max;
+    uint32_t p99;
+} task_profiler_stats_t;
+
+/**
+ * @brief Reads the profiler's timer, in a unit depending on the platform.
+ */
+uint32_t task_profiler_read(void);
+
+/**
+ * @brief Records one run of a stage.
+ *
+ * @param ticks the duration, as a difference between two task_profiler_read() values
+ */
+void task_profiler_record(task_profiler_stage_t stage, uint32_t ticks);
+
+/**
+ * @brief Gets the results of a stage since the last reset.
+ *
+ * @return false if the stage has not run
+ */
+bool task_profiler_get_stats(task_profiler_stage_t stage, task_profiler_stats_t *stats);
+
+const char *task_profiler_stage_name(task_profiler_stage_t stage);
+
+void task_profiler_init(void);
+void task_profiler_reset(void);
+
+/**
+ * @brief Prints the results over the console, if they are due.
+ */
+void task_profiler_task(void);
+
+#    ifdef RAW_ENABLE
+/**
+ * @brief Answers a raw HID request, for keyboards handling raw HID themselves.
+ *
+ * request: [ TASK_PROFILER_RAW_HID_ID, stage, reset after reading ]
+ * reply:   [ TASK_PROFILER_RAW_HID_ID, stage, stage count, count, min, avg, max, p99 ]
+ *          the results being 32 bit big-endian, with a count of 0 for an unknown stage
+ *
+ * @return true if it was a profiler request, and the reply has been sent
+ */
+bool task_profiler_raw_hid_receive(uint8_t *data, uint8_t length);
+#    endif
+
+#    define TASK_PROFILE(stage, call)                                                  \
+        do {                                                                           \
+            uint32_t task_profiler_start = task_profiler_read();                       \
+            call;                                                                      \
+            task_profiler_record((stage), task_profiler_read() - task_profiler_start); \
+        } while (0)
+
+#else
+
+#    define TASK_PROFILE(stage, call) call
+
+#endif // TASK_PROFILER_ENABLE
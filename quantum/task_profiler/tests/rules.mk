@@ -0,0 +1,11 @@
+task_profiler_DEFS := -DTASK_PROFILER_ENABLE -DRAW_ENABLE
+
+task_profiler_SRC := \
+    $(QUANTUM_PATH)/task_profiler/tests/task_profiler_tests.cpp \
+    $(QUANTUM_PATH)/task_profiler/task_profiler.c \
+    $(QUANTUM_PATH)/logging/debug.c \
+    $(PLATFORM_PATH)/timer.c \
+    $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+task_profiler_INC := \
+    $(QUANTUM_PATH)/task_profiler
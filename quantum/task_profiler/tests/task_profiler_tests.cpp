@@ -0,0 +1,136 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "task_profiler.h"
+}
+
+namespace {
+
+std::vector<std::vector<uint8_t>> replies;
+
+uint32_t get_u32(const std::vector<uint8_t> &data, size_t offset) {
+    return ((uint32_t)data[offset] << 24) | ((uint32_t)data[offset + 1] << 16) | ((uint32_t)data[offset + 2] << 8) | data[offset + 3];
+}
+
+void busy_wait_ns(uint32_t ns) {
+    uint32_t start = task_profiler_read();
+    while (task_profiler_read() - start < ns) {
+    }
+}
+
+} // namespace
+
+extern "C" void raw_hid_send(uint8_t *data, uint8_t length) {
+    replies.emplace_back(data, data + length);
+}
+
+class TaskProfiler : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        task_profiler_init();
+        replies.clear();
+    }
+};
+
+// On the host the timer counts nanoseconds
+TEST_F(TaskProfiler, Stats) {
+    for (uint32_t i = 1; i <= 100; i++) {
+        task_profiler_record(TASK_PROFILER_MATRIX, i * 10);
+    }
+
+    task_profiler_stats_t stats;
+    ASSERT_TRUE(task_profiler_get_stats(TASK_PROFILER_MATRIX, &stats));
+    EXPECT_EQ(stats.count, 100u);
+    EXPECT_EQ(stats.min, 10u);
+    EXPECT_EQ(stats.avg, 505u);
+    EXPECT_EQ(stats.max, 1000u);
+    EXPECT_GE(stats.p99, 990u);
+    EXPECT_LE(stats.p99, 1000u);
+
+    EXPECT_FALSE(task_profiler_get_stats(TASK_PROFILER_QUANTUM, &stats));
+}
+
+TEST_F(TaskProfiler, PercentileIgnoresRareOutliers) {
+    for (int i = 0; i < 995; i++) {
+        task_profiler_record(TASK_PROFILER_RGB_MATRIX, 1000);
+    }
+    for (int i = 0; i < 5; i++) {
+        task_profiler_record(TASK_PROFILER_RGB_MATRIX, 1000000);
+    }
+
+    task_profiler_stats_t stats;
+    ASSERT_TRUE(task_profiler_get_stats(TASK_PROFILER_RGB_MATRIX, &stats));
+    EXPECT_EQ(stats.max, 1000000u);
+    // Within the resolution of the histogram
+    EXPECT_GE(stats.p99, 1000u);
+    EXPECT_LT(stats.p99, 1500u);
+
+    // Once they are more than 1%, they show up
+    for (int i = 0; i < 10; i++) {
+        task_profiler_record(TASK_PROFILER_RGB_MATRIX, 1000000);
+    }
+    ASSERT_TRUE(task_profiler_get_stats(TASK_PROFILER_RGB_MATRIX, &stats));
+    EXPECT_GE(stats.p99, 1000000u * 2 / 3);
+    EXPECT_LE(stats.p99, 1000000u);
+}
+
+TEST_F(TaskProfiler, HistogramSaturates) {
+    for (uint32_t i = 0; i < 100000; i++) {
+        task_profiler_record(TASK_PROFILER_OLED, 100);
+    }
+    task_profiler_record(TASK_PROFILER_OLED, 5000);
+
+    task_profiler_stats_t stats;
+    ASSERT_TRUE(task_profiler_get_stats(TASK_PROFILER_OLED, &stats));
+    EXPECT_EQ(stats.count, 100001u);
+    EXPECT_LT(stats.p99, 150u);
+}
+
+TEST_F(TaskProfiler, ProfilesCall) {
+    TASK_PROFILE(TASK_PROFILER_QUANTUM, busy_wait_ns(200000));
+    TASK_PROFILE(TASK_PROFILER_QUANTUM, busy_wait_ns(100000));
+
+    task_profiler_stats_t stats;
+    ASSERT_TRUE(task_profiler_get_stats(TASK_PROFILER_QUANTUM, &stats));
+    EXPECT_EQ(stats.count, 2u);
+    EXPECT_GE(stats.min, 100000u);
+    EXPECT_GE(stats.max, 200000u);
+    EXPECT_LT(stats.min, stats.max);
+}
+
+TEST_F(TaskProfiler, RawHid) {
+    task_profiler_record(TASK_PROFILER_SPLIT, 300);
+    task_profiler_record(TASK_PROFILER_SPLIT, 100);
+
+    std::vector<uint8_t> request(32);
+    request[0] = TASK_PROFILER_RAW_HID_ID;
+    request[1] = TASK_PROFILER_SPLIT;
+    request[2] = true;
+    ASSERT_TRUE(task_profiler_raw_hid_receive(request.data(), request.size()));
+
+    ASSERT_EQ(replies.size(), 1u);
+    auto &reply = replies[0];
+    EXPECT_EQ(reply[0], TASK_PROFILER_RAW_HID_ID);
+    EXPECT_EQ(reply[1], TASK_PROFILER_SPLIT);
+    EXPECT_EQ(reply[2], TASK_PROFILER_STAGE_COUNT);
+    EXPECT_EQ(get_u32(reply, 3), 2u);
+    EXPECT_EQ(get_u32(reply, 7), 100u);
+    EXPECT_EQ(get_u32(reply, 11), 200u);
+    EXPECT_EQ(get_u32(reply, 15), 300u);
+    EXPECT_EQ(get_u32(reply, 19), 300u);
+
+    // Reset after reading
+    task_profiler_stats_t stats;
+    EXPECT_FALSE(task_profiler_get_stats(TASK_PROFILER_SPLIT, &stats));
+
+    // Anything else is left alone
+    std::vector<uint8_t> other(32);
+    other[0] = 0x01;
+    EXPECT_FALSE(task_profiler_raw_hid_receive(other.data(), other.size()));
+    EXPECT_EQ(replies.size(), 1u);
+}
@@ -22,6 +22,8 @@
 #    error "DYNAMIC_KEYMAP_ENABLE is not enabled"
 #endif
 
+#include <string.h>
+
 #include "via.h"
 
 #include "raw_hid.h"
@@ -57,6 +59,14 @@
 #    include "led_matrix.h"
 #endif
 
+#if defined(TASK_PROFILER_ENABLE)
+#    include "task_profiler.h"
+#endif
+
+#if defined(KEYSTROKE_TRACE_ENABLE)
+#    include "keystroke_trace.h"
+#endif
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void) {
@@ -286,6 +296,18 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
         return;
     }
 
+#ifdef TASK_PROFILER_ENABLE
+    if (task_profiler_raw_hid_receive(data, length)) {
+        return;
+    }
+#endif
+
+#ifdef KEYSTROKE_TRACE_ENABLE
+    if (keystroke_trace_raw_hid_receive(data, length)) {
+        return;
+    }
+#endif
+
     switch (*command_id) {
         case id_get_protocol_version: {
             command_data[0] = VIA_PROTOCOL_VERSION >> 8;
@@ -447,6 +469,15 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
             dynamic_keymap_set_encoder(command_data[0], command_data[1], command_data[2] != 0, (command_data[3] << 8) | command_data[4]);
             break;
         }
+#endif
+#ifdef VIA_BULK_TRANSFER_ENABLE
+        case id_bulk_transfer: {
+            // Data packets are only acknowledged once per window
+            if (!via_bulk_transfer_command(data, length)) {
+                return;
+            }
+            break;
+        }
 #endif
         default: {
             // The command ID is not known
@@ -461,6 +492,147 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
     raw_hid_send(data, length);
 }
 
+#ifdef VIA_BULK_TRANSFER_ENABLE
+
+// Bulk transfers send a start packet with the target and size, then a
+// stream of sequence-numbered data packets, and finally a commit packet.
+// The decoded data is staged in RAM, and only written to EEPROM on commit.
+//
+// start:  [ id_bulk_transfer, id_bulk_transfer_start, target, offset (2), size (2) ]
+//      -> [ ..., status, window, max size (2) ]
+// data:   [ id_bulk_transfer, id_bulk_transfer_data, sequence, payload size, payload ]
+//      -> [ ..., status, next sequence ], only at the end of a window, once all
+//         of the data was received, or straight away on an error
+// commit: [ id_bulk_transfer, id_bulk_transfer_commit ]
+//      -> [ ..., status ]
+//
+// Each payload is decoded on its own, as a sequence of:
+//   0x00..0x7F  marker + 1 literal bytes follow
+//   0x80..0xBF  (marker & 0x3F) + 1 zero bytes
+//   0xC0..0xFF  the last two decoded bytes, repeated (marker & 0x3F) + 1 times
+
+static struct {
+    bool     active;
+    uint8_t  target;
+    uint8_t  sequence;
+    uint16_t offset;
+    uint16_t size;
+    uint16_t received;
+    uint8_t  buffer[VIA_BULK_TRANSFER_BUFFER_SIZE];
+} via_bulk_transfer;
+
+// Decodes a payload onto the end of the staged data, leaving it untouched if the payload is malformed or too long
+static bool via_bulk_transfer_decode(const uint8_t *payload, uint8_t payload_size) {
+    uint8_t *output    = &via_bulk_transfer.buffer[via_bulk_transfer.received];
+    uint16_t available = via_bulk_transfer.size - via_bulk_transfer.received;
+    uint16_t produced  = 0;
+    uint8_t  i         = 0;
+
+    while (i < payload_size) {
+        uint8_t marker = payload[i++];
+        if (marker < 0x80) {
+            uint8_t count = marker + 1;
+            if (count > payload_size - i || count > available - produced) {
+                return false;
+            }
+            memcpy(&output[produced], &payload[i], count);
+            i += count;
+            produced += count;
+        } else if (marker < 0xC0) {
+            uint8_t count = (marker & 0x3F) + 1;
+            if (count > available - produced) {
+                return false;
+            }
+            memset(&output[produced], 0, count);
+            produced += count;
+        } else {
+            uint16_t count = ((marker & 0x3F) + 1) * 2;
+            if (produced < 2 || count > available - produced) {
+                return false;
+            }
+            for (uint16_t j = 0; j < count; j++, produced++) {
+                output[produced] = output[produced - 2];
+            }
+        }
+    }
+
+    via_bulk_transfer.received += produced;
+    return true;
+}
+
+bool via_bulk_transfer_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, bulk_transfer_id, bulk_transfer_data ]
+    uint8_t *bulk_transfer_id   = &(data[1]);
+    uint8_t *bulk_transfer_data = &(data[2]);
+
+    switch (*bulk_transfer_id) {
+        case id_bulk_transfer_start: {
+            uint8_t  target = bulk_transfer_data[0];
+            uint16_t offset = (bulk_transfer_data[1] << 8) | bulk_transfer_data[2];
+            uint16_t size   = (bulk_transfer_data[3] << 8) | bulk_transfer_data[4];
+            bool     valid  = (target == id_bulk_transfer_keymap || target == id_bulk_transfer_macros) && size <= VIA_BULK_TRANSFER_BUFFER_SIZE;
+
+            via_bulk_transfer.active   = valid;
+            via_bulk_transfer.target   = target;
+            via_bulk_transfer.sequence = 0;
+            via_bulk_transfer.offset   = offset;
+            via_bulk_transfer.size     = size;
+            via_bulk_transfer.received = 0;
+
+            bulk_transfer_data[0] = valid ? id_bulk_transfer_ok : id_bulk_transfer_invalid;
+            bulk_transfer_data[1] = VIA_BULK_TRANSFER_WINDOW;
+            bulk_transfer_data[2] = VIA_BULK_TRANSFER_BUFFER_SIZE >> 8;
+            bulk_transfer_data[3] = VIA_BULK_TRANSFER_BUFFER_SIZE & 0xFF;
+            return true;
+        }
+        case id_bulk_transfer_data: {
+            uint8_t sequence     = bulk_transfer_data[0];
+            uint8_t payload_size = bulk_transfer_data[1];
+            uint8_t status       = id_bulk_transfer_ok;
+
+            if (!via_bulk_transfer.active || payload_size > length - 4) {
+                status = id_bulk_transfer_invalid;
+            } else if (sequence != via_bulk_transfer.sequence) {
+                status = id_bulk_transfer_sequence_error;
+            } else if (!via_bulk_transfer_decode(&bulk_transfer_data[2], payload_size)) {
+                status = id_bulk_transfer_invalid;
+            } else {
+                via_bulk_transfer.sequence++;
+                // Stay quiet until the end of the window, or the end of the data
+                if ((via_bulk_transfer.sequence % VIA_BULK_TRANSFER_WINDOW) != 0 && via_bulk_transfer.received < via_bulk_transfer.size) {
+                    return false;
+                }
+            }
+
+            bulk_transfer_data[0] = status;
+            bulk_transfer_data[1] = via_bulk_transfer.sequence;
+            return true;
+        }
+        case id_bulk_transfer_commit: {
+            uint8_t status = id_bulk_transfer_ok;
+            if (!via_bulk_transfer.active) {
+                status = id_bulk_transfer_invalid;
+            } else if (via_bulk_transfer.received != via_bulk_transfer.size) {
+                status = id_bulk_transfer_incomplete;
+            } else if (via_bulk_transfer.target == id_bulk_transfer_keymap) {
+                dynamic_keymap_set_buffer(via_bulk_transfer.offset, via_bulk_transfer.size, via_bulk_transfer.buffer);
+            } else {
+                dynamic_keymap_macro_set_buffer(via_bulk_transfer.offset, via_bulk_transfer.size, via_bulk_transfer.buffer);
+            }
+            via_bulk_transfer.active = false;
+
+            bulk_transfer_data[0] = status;
+            return true;
+        }
+        default: {
+            *bulk_transfer_id = id_unhandled;
+            return true;
+        }
+    }
+}
+
+#endif // VIA_BULK_TRANSFER_ENABLE
+
 #if defined(BACKLIGHT_ENABLE)
 
 void via_qmk_backlight_command(uint8_t *data, uint8_t length) {
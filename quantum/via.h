@@ -71,6 +71,21 @@
 #    define VIA_FIRMWARE_VERSION 0x00000000
 #endif
 
+// Bulk transfers are staged in RAM and written to EEPROM in one go, so
+// they are only available when enabled in config.h, with a buffer large
+// enough for the biggest transfer the host makes in one go (e.g. a whole
+// keymap is DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2 bytes).
+// Hosts detect support by the bulk transfer command not returning id_unhandled.
+#ifdef VIA_BULK_TRANSFER_ENABLE
+#    ifndef VIA_BULK_TRANSFER_BUFFER_SIZE
+#        define VIA_BULK_TRANSFER_BUFFER_SIZE 1024
+#    endif
+// Number of data packets the host sends before waiting for an acknowledgement
+#    ifndef VIA_BULK_TRANSFER_WINDOW
+#        define VIA_BULK_TRANSFER_WINDOW 8
+#    endif
+#endif
+
 enum via_command_id {
     id_get_protocol_version                 = 0x01, // always 0x01
     id_get_keyboard_value                   = 0x02,
@@ -93,9 +108,28 @@ enum via_command_id {
     id_dynamic_keymap_set_buffer            = 0x13,
     id_dynamic_keymap_get_encoder           = 0x14,
     id_dynamic_keymap_set_encoder           = 0x15,
+    id_bulk_transfer                        = 0x16,
     id_unhandled                            = 0xFF,
 };
 
+enum via_bulk_transfer_id {
+    id_bulk_transfer_start  = 0x01,
+    id_bulk_transfer_data   = 0x02,
+    id_bulk_transfer_commit = 0x03,
+};
+
+enum via_bulk_transfer_target {
+    id_bulk_transfer_keymap = 0x00,
+    id_bulk_transfer_macros = 0x01,
+};
+
+enum via_bulk_transfer_status {
+    id_bulk_transfer_ok             = 0x00,
+    id_bulk_transfer_sequence_error = 0x01, // a data packet was missed, resend starting from the expected sequence number
+    id_bulk_transfer_invalid        = 0x02, // the transfer does not fit, or a packet could not be decoded
+    id_bulk_transfer_incomplete     = 0x03, // committed before all of the data was received
+};
+
 enum via_keyboard_value_id {
     id_uptime              = 0x01,
     id_layout_options      = 0x02,
@@ -165,6 +199,11 @@ void     via_set_layout_options_kb(uint32_t value);
 // between devices.
 void via_set_device_indication(uint8_t value);
 
+#ifdef VIA_BULK_TRANSFER_ENABLE
+// Handles id_bulk_transfer, returns true if a response should be sent.
+bool via_bulk_transfer_command(uint8_t *data, uint8_t length);
+#endif
+
 // Called by QMK core to process VIA-specific keycodes.
 bool process_record_via(uint16_t keycode, keyrecord_t *record);
 
@@ -17,6 +17,7 @@
 
 #include "wpm.h"
 #include "timer.h"
+#include "deadline.h"
 #include "keycode.h"
 #include "quantum_keycodes.h"
 #include "action_util.h"
@@ -58,8 +59,50 @@ static uint8_t  prev_wpm        = 0;
 static uint8_t  next_wpm        = 0;
 #endif
 
+/* Once every period is empty and the reported WPM has dropped to zero, there
+ * is nothing left to decay, so decay_wpm() is no longer run until the next key
+ * press. The timers are then restarted, as if they had kept running.
+ */
+#if defined(WPM_LAUNCH_CONTROL)
+#    define SETTLED_PERIODS 0
+#else
+#    define SETTLED_PERIODS (MAX_PERIODS - 1)
+#endif
+static bool wpm_settled = true;
+
+static void wake_wpm(void) {
+    if (wpm_settled) {
+        wpm_settled    = false;
+        current_period = 0;
+        periods        = SETTLED_PERIODS;
+        wpm_timer      = timer_read32();
+#if !defined(WPM_UNFILTERED)
+        smoothing_timer = wpm_timer;
+#endif
+    }
+    deadline_set(DEADLINE_WPM, 0);
+}
+
+static bool wpm_has_settled(int32_t presses) {
+    if (presses != 0 || current_wpm != 0 || periods != SETTLED_PERIODS) {
+        return false;
+    }
+#if !defined(WPM_UNFILTERED)
+    if (prev_wpm != 0 || next_wpm != 0) {
+        return false;
+    }
+#endif
+    for (uint8_t i = 0; i <= periods; i++) {
+        if (period_presses[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void set_current_wpm(uint8_t new_wpm) {
     current_wpm = new_wpm;
+    wake_wpm();
 }
 uint8_t get_current_wpm(void) {
     return current_wpm;
@@ -110,6 +153,7 @@ __attribute__((weak)) uint8_t wpm_regress_count(uint16_t keycode) {
 // Outside 'raw' mode we smooth results over time.
 
 void update_wpm(uint16_t keycode) {
+    wake_wpm();
     if (wpm_keycode(keycode) && period_presses[current_period] < INT16_MAX) {
         period_presses[current_period]++;
     }
@@ -126,6 +170,7 @@ void decay_wpm(void) {
     for (int i = 1; i <= periods; i++) {
         presses += period_presses[i];
     }
+    int32_t total = presses;
     if (presses < 0) {
         presses = 0;
     }
@@ -175,4 +220,9 @@ void decay_wpm(void) {
 
     current_wpm = prev_wpm + (latency * ((int)next_wpm - (int)prev_wpm) / LATENCY);
 #endif
+
+    if (wpm_has_settled(total)) {
+        wpm_settled = true;
+        deadline_clear(DEADLINE_WPM);
+    }
 }
@@ -20,6 +20,11 @@
 #include "keyboard_report_util.hpp"
 #include "test_common.hpp"
 
+extern "C" {
+extern bool audio_driver_running;
+void        advance_time(uint32_t ms);
+}
+
 namespace {
 
 class AudioTest : public TestFixture {
@@ -115,4 +120,38 @@ TEST_F(AudioTest, BpmConversion) {
     }
 }
 
+TEST_F(AudioTest, StopsTheDriverFromTheMainLoop) {
+    audio_on();
+    audio_stop_all();
+
+    audio_play_note(440.0f, 10);
+    EXPECT_TRUE(audio_driver_running);
+
+    // The end of the note is noticed by the driver, possibly in its interrupt
+    advance_time(20);
+    audio_update_state();
+    EXPECT_FALSE(audio_is_playing_note());
+    EXPECT_TRUE(audio_driver_running);
+
+    audio_task();
+    EXPECT_FALSE(audio_driver_running);
+}
+
+TEST_F(AudioTest, KeepsTheDriverForANoteStartedMeanwhile) {
+    audio_on();
+    audio_stop_all();
+
+    audio_play_note(440.0f, 10);
+    advance_time(20);
+    audio_update_state();
+
+    audio_play_note(880.0f, 10);
+    audio_task();
+    EXPECT_TRUE(audio_driver_running);
+    EXPECT_TRUE(audio_is_playing_note());
+
+    audio_stop_all();
+    EXPECT_FALSE(audio_driver_running);
+}
+
 } // namespace
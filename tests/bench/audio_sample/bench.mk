@@ -0,0 +1,5 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+AUDIO_ENABLE = yes
+AUDIO_SAMPLE_ENABLE = yes
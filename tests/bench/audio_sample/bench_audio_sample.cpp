@@ -0,0 +1,53 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "bench_fixture.hpp"
+
+extern "C" {
+#include "audio_sample.h"
+}
+
+class AudioSample : public BenchFixture {
+   protected:
+    static constexpr uint32_t SAMPLE_COUNT = 1 << 14;
+
+    // Every nibble is a valid IMA-ADPCM code, the decoder does the same work whatever they are
+    std::vector<uint8_t> encoded = std::vector<uint8_t>(SAMPLE_COUNT / 2);
+
+    void SetUp() override {
+        uint32_t seed = 1;
+        for (auto &byte : encoded) {
+            seed = seed * 1103515245 + 12345;
+            byte = seed >> 16;
+        }
+    }
+
+    void TearDown() override {
+        audio_sample_stop();
+    }
+
+    // Renders the whole clip in 'half-buffer' sized chunks, as the driver would
+    void render(const audio_sample_t &clip, uint32_t output_rate) {
+        int16_t chunk[128];
+        audio_sample_start(&clip);
+        while (audio_sample_render(chunk, 128, output_rate) > 0) {
+        }
+    }
+};
+
+// One event being one sample of the clip
+TEST_F(AudioSample, Decode) {
+    audio_sample_t clip = {
+        .format       = AUDIO_SAMPLE_FORMAT_IMA_ADPCM,
+        .sample_rate  = 16000,
+        .sample_count = SAMPLE_COUNT,
+        .data_length  = (uint32_t)encoded.size(),
+        .data         = encoded.data(),
+    };
+
+    benchmark(SAMPLE_COUNT, [&]() { render(clip, 16000); }, "native_rate");
+    benchmark(SAMPLE_COUNT, [&]() { render(clip, 44100); }, "resampled");
+}
@@ -0,0 +1,7 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+AUTOCORRECT_ENABLE = yes
+
+# For the dictionary in the format it was shipped in before
+VPATH += $(QUANTUM_PATH)/autocorrect/tests
@@ -0,0 +1,75 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "bench_fixture.hpp"
+
+extern "C" {
+#include "autocorrect.h"
+}
+
+// The default dictionary in the byte-packed trie format it was shipped in before
+namespace legacy {
+#include "autocorrect_data_legacy.h"
+}
+
+namespace {
+
+// Words from the default dictionary, spelled correctly and as typos
+const std::vector<std::string> WORDS = {
+    "the",      "their",  "thier",    "false",      "fales",     "flase",    "length",  "lenght",  "output", "ouput",
+    "ouptut",   "loses",  "looses",   "accomodate", "apparent",  "aparrent", "because", "becuase", "width",  "widht",
+    "ture",     "true",   "guage",    "return",     "retrun",    "reutrn",   "switch",  "swtich",  "string", "strign",
+    "occassion", "occured", "recieve", "seperate",  "threshold", "thresold", "update",  "udpate",  "don't",  "signed",
+};
+
+bool find_legacy(const autocorrect_buffer_t *buffer, autocorrect_match_t *match) {
+    return autocorrect_find_trie(legacy::autocorrect_data, DICTIONARY_SIZE, buffer, match);
+}
+
+} // namespace
+
+class Autocorrect : public BenchFixture {
+   protected:
+    // The keycodes of random words from WORDS, each followed by a space
+    std::vector<uint8_t> text;
+
+    void SetUp() override {
+        std::mt19937                          rng(2);
+        std::uniform_int_distribution<size_t> pick(0, WORDS.size() - 1);
+        for (int i = 0; i < 2000; i++) {
+            for (char c : WORDS[pick(rng)]) {
+                text.push_back(c == '\'' ? KC_QUOTE : KC_A + c - 'a');
+            }
+            text.push_back(KC_SPACE);
+        }
+    }
+
+    // Looks up the buffer after each keystroke like process_autocorrect() does
+    template <typename Find>
+    void type(Find find) {
+        autocorrect_buffer_t buffer = {};
+        autocorrect_buffer_push(&buffer, KC_SPACE);
+        for (uint8_t keycode : text) {
+            autocorrect_buffer_push(&buffer, keycode);
+            autocorrect_match_t match;
+            if (buffer.size >= AUTOCORRECT_MIN_LENGTH && find(&buffer, &match)) {
+                buffer = {};
+                if (keycode == KC_SPACE) {
+                    autocorrect_buffer_push(&buffer, KC_SPACE);
+                }
+            }
+        }
+    }
+};
+
+// One event being one keystroke
+TEST_F(Autocorrect, Lookup) {
+    benchmark(text.size(), [&]() { type(autocorrect_find); }, "double_array");
+    benchmark(text.size(), [&]() { type(find_legacy); }, "legacy_trie");
+}
@@ -0,0 +1,187 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bench_fixture.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+extern "C" {
+#include "host.h"
+#include "keyboard.h"
+#include "task_profiler.h"
+#include "test_matrix.h"
+
+void advance_time(uint32_t ms);
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+}
+
+#ifndef BENCH_SUITE
+#    define BENCH_SUITE "unknown"
+#endif
+
+namespace {
+
+bool     counting_allocations = false;
+uint32_t allocations          = 0;
+uint32_t reports              = 0;
+
+uint8_t bench_keyboard_leds(void) {
+    return 0;
+}
+
+void bench_send_keyboard(report_keyboard_t *report) {
+    reports++;
+}
+
+void bench_send_nkro(report_nkro_t *report) {
+    reports++;
+}
+
+void bench_send_mouse(report_mouse_t *report) {
+    reports++;
+}
+
+void bench_send_extra(report_extra_t *report) {
+    reports++;
+}
+
+host_driver_t bench_driver = {bench_keyboard_leds, bench_send_keyboard, bench_send_nkro, bench_send_mouse, bench_send_extra};
+
+unsigned min_time_ms() {
+    const char *value = getenv("QMK_BENCH_MIN_TIME_MS");
+    return value ? strtoul(value, nullptr, 10) : 250;
+}
+
+std::string format_ns(double ns) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.1f", ns);
+    return buffer;
+}
+
+} // namespace
+
+extern "C" void *__wrap_malloc(size_t size) {
+    allocations += counting_allocations;
+    return __real_malloc(size);
+}
+
+extern "C" void *__wrap_calloc(size_t count, size_t size) {
+    allocations += counting_allocations;
+    return __real_calloc(count, size);
+}
+
+extern "C" void *__wrap_realloc(void *ptr, size_t size) {
+    allocations += counting_allocations;
+    return __real_realloc(ptr, size);
+}
+
+BenchFixture::BenchFixture() {
+    host_set_driver(&bench_driver);
+}
+
+BenchFixture::~BenchFixture() {}
+
+void BenchFixture::benchmark(unsigned events, const std::function<void()> &body, const std::string &variant) {
+    const ::testing::TestInfo *const test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+
+    std::string name = std::string(test_info->test_suite_name()) + "." + test_info->name();
+    if (!variant.empty()) {
+        name += "/" + variant;
+    }
+
+    body();
+
+    task_profiler_reset();
+    reports              = 0;
+    allocations          = 0;
+    counting_allocations = true;
+
+    using clock        = std::chrono::steady_clock;
+    auto     min_time  = std::chrono::milliseconds(min_time_ms());
+    auto     start     = clock::now();
+    uint32_t runs      = 0;
+    do {
+        body();
+        runs++;
+    } while (clock::now() - start < min_time);
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+
+    counting_allocations = false;
+
+    uint64_t total_events = (uint64_t)runs * events;
+    double   ns_per_event = total_events ? (double)elapsed / total_events : 0;
+
+    std::ostringstream json;
+    json << "{\"suite\": \"" << BENCH_SUITE << "\", \"benchmark\": \"" << name << "\", \"runs\": " << runs << ", \"events\": " << total_events << ", \"ns_per_event\": " << format_ns(ns_per_event) << ", \"allocations\": " << allocations << ", \"reports\": " << reports << ", \"stages\": {";
+
+    std::cout << "[   BENCH  ] " << name << ": " << format_ns(ns_per_event) << " ns/event, " << allocations << " allocations, " << runs << " runs" << std::endl;
+
+    bool first = true;
+    for (uint8_t stage = 0; stage < TASK_PROFILER_STAGE_COUNT; stage++) {
+        task_profiler_stats_t stats;
+        if (!task_profiler_get_stats((task_profiler_stage_t)stage, &stats)) {
+            continue;
+        }
+
+        json << (first ? "" : ", ") << "\"" << task_profiler_stage_name((task_profiler_stage_t)stage) << "\": {\"count\": " << stats.count << ", \"avg_ns\": " << stats.avg << ", \"p99_ns\": " << stats.p99 << ", \"max_ns\": " << stats.max << "}";
+        first = false;
+
+        std::cout << "[   BENCH  ]     " << task_profiler_stage_name((task_profiler_stage_t)stage) << ": avg " << stats.avg << " ns, p99 " << stats.p99 << " ns, max " << stats.max << " ns" << std::endl;
+    }
+    json << "}}";
+
+    const char *output = getenv("QMK_BENCH_OUTPUT");
+    if (output) {
+        std::ofstream file(output, std::ios::app);
+        file << json.str() << std::endl;
+    }
+}
+
+void BenchFixture::scan_for(unsigned ms) {
+    for (unsigned i = 0; i < ms; i++) {
+        TASK_PROFILE(TASK_PROFILER_KEYBOARD_TASK, keyboard_task());
+        TASK_PROFILE(TASK_PROFILER_HOUSEKEEPING, housekeeping_task());
+        advance_time(1);
+    }
+}
+
+void BenchFixture::play(const std::vector<TraceEvent> &trace, unsigned settle_ms) {
+    uint32_t now = 0;
+    for (const TraceEvent &event : trace) {
+        scan_for(event.time_ms - now);
+        now = event.time_ms;
+
+        if (event.pressed) {
+            press_key(event.position.col, event.position.row);
+        } else {
+            release_key(event.position.col, event.position.row);
+        }
+    }
+    scan_for(settle_ms);
+}
+
+void BenchFixture::press(const KeymapKey &key) {
+    press_key(key.position.col, key.position.row);
+}
+
+void BenchFixture::release(const KeymapKey &key) {
+    release_key(key.position.col, key.position.row);
+}
+
+void BenchFixture::tap(const KeymapKey &key, unsigned delay_ms) {
+    press(key);
+    scan_for(delay_ms);
+    release(key);
+    scan_for(1);
+}
+
+uint32_t BenchFixture::reports_sent() const {
+    return reports;
+}
@@ -0,0 +1,61 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "test_fixture.hpp"
+#include "bench_trace.hpp"
+
+/**
+ * @brief A TestFixture that measures how long the firmware takes to process its input.
+ *
+ * Each benchmark is written like a test, with a keymap set through the fixture, and calls
+ * benchmark() with the work to measure. The results are printed, and appended as a line of
+ * JSON to the file named by the QMK_BENCH_OUTPUT environment variable:
+ *
+ *   {"suite": "keyboard", "benchmark": "typing", "runs": 120, "events": 48000,
+ *    "ns_per_event": 812.4, "allocations": 0, "reports": 24000,
+ *    "stages": {"matrix": {"count": 1200, "avg_ns": 240, "p99_ns": 511, "max_ns": 9000}, ...}}
+ *
+ * Reports go to a driver that only counts them, and keys are pressed without logging, so the
+ * time is spent in the firmware rather than in the test framework.
+ */
+class BenchFixture : public TestFixture {
+   public:
+    BenchFixture();
+    ~BenchFixture();
+
+   protected:
+    /**
+     * @brief Runs `body` once to warm up, then repeatedly for at least QMK_BENCH_MIN_TIME_MS
+     * (250ms by default), and reports the results.
+     *
+     * @param events how many events a single run processes, e.g. key presses and releases
+     * @param variant appended to the name of the test, for benchmarks measuring several things
+     */
+    void benchmark(unsigned events, const std::function<void()>& body, const std::string& variant = "");
+
+    /**
+     * @brief Same as idle_for(), timing keyboard_task() and housekeeping_task() as stages.
+     */
+    void scan_for(unsigned ms);
+
+    /**
+     * @brief Plays back a trace, scanning for `settle_ms` after the last event.
+     */
+    void play(const std::vector<TraceEvent>& trace, unsigned settle_ms);
+
+    void press(const KeymapKey& key);
+    void release(const KeymapKey& key);
+
+    /**
+     * @brief Taps `key` for `delay_ms`, then scans once more.
+     */
+    void tap(const KeymapKey& key, unsigned delay_ms = 1);
+
+    uint32_t reports_sent() const;
+};
@@ -0,0 +1,61 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bench_trace.hpp"
+#include <algorithm>
+#include <random>
+#include "keycode.h"
+
+std::vector<TraceEvent> make_trace(const std::vector<KeymapKey>& sequence, unsigned interval_ms, unsigned hold_ms) {
+    std::vector<TraceEvent> trace;
+
+    for (size_t i = 0; i < sequence.size(); i++) {
+        uint32_t press_time   = i * interval_ms;
+        uint32_t release_time = press_time + hold_ms;
+
+        for (size_t j = i + 1; j < sequence.size(); j++) {
+            uint32_t next_press = j * interval_ms;
+            if (next_press > release_time) {
+                break;
+            }
+            if (sequence[j].position.col == sequence[i].position.col && sequence[j].position.row == sequence[i].position.row) {
+                release_time = next_press;
+                break;
+            }
+        }
+
+        trace.push_back({press_time, sequence[i].position, true});
+        trace.push_back({release_time, sequence[i].position, false});
+    }
+
+    // Releases go first when they coincide with a press, so no key is ever pressed twice
+    std::stable_sort(trace.begin(), trace.end(), [](const TraceEvent& a, const TraceEvent& b) { return a.time_ms < b.time_ms || (a.time_ms == b.time_ms && !a.pressed && b.pressed); });
+    return trace;
+}
+
+std::vector<KeymapKey> random_sequence(const std::vector<KeymapKey>& keys, size_t length, uint32_t seed) {
+    // The output of mt19937 is fixed by the standard, unlike that of the distributions
+    std::mt19937           rng(seed);
+    std::vector<KeymapKey> sequence;
+
+    for (size_t i = 0; i < length; i++) {
+        sequence.push_back(keys[rng() % keys.size()]);
+    }
+    return sequence;
+}
+
+std::vector<KeymapKey> qwerty_keys(layer_t layer) {
+    // clang-format off
+    static const uint16_t keycodes[] = {
+        KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y, KC_U, KC_I,    KC_O,   KC_P,
+        KC_A, KC_S, KC_D, KC_F, KC_G, KC_H, KC_J, KC_K,    KC_L,   KC_SCLN,
+        KC_Z, KC_X, KC_C, KC_V, KC_B, KC_N, KC_M, KC_COMM, KC_DOT, KC_SLSH
+    };
+    // clang-format on
+    std::vector<KeymapKey> keys;
+
+    for (uint8_t i = 0; i < sizeof(keycodes) / sizeof(keycodes[0]); i++) {
+        keys.push_back(KeymapKey(layer, i % 10, i / 10, keycodes[i]));
+    }
+    return keys;
+}
@@ -0,0 +1,32 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "test_keymap_key.hpp"
+
+struct TraceEvent {
+    uint32_t time_ms;
+    keypos_t position;
+    bool     pressed;
+};
+
+/**
+ * @brief Presses each key of `sequence` `interval_ms` after the previous one, holding it for `hold_ms`.
+ *
+ * With `hold_ms` longer than `interval_ms` the keys roll into each other. A key that comes up again
+ * while it is still held is released right before it is pressed again.
+ */
+std::vector<TraceEvent> make_trace(const std::vector<KeymapKey>& sequence, unsigned interval_ms, unsigned hold_ms);
+
+/**
+ * @brief Picks `length` keys out of `keys`, the same ones for the same `seed` on every platform.
+ */
+std::vector<KeymapKey> random_sequence(const std::vector<KeymapKey>& keys, size_t length, uint32_t seed);
+
+/**
+ * @brief The 30 keys of the letter block of a QWERTY layout, on rows 0 to 2.
+ */
+std::vector<KeymapKey> qwerty_keys(layer_t layer = 0);
@@ -0,0 +1,21 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+CUSTOM_MATRIX = yes
+
+# Each stage of keyboard_task() is timed by the task profiler
+TASK_PROFILER_ENABLE = yes
+
+# Benchmarks are only meaningful with the optimisations of a firmware build
+OPT = s
+
+OPT_DEFS += -DBENCH_SUITE=\"$(TEST)\"
+
+# Counts the heap allocations made by the firmware code
+LDFLAGS += -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc
+
+BENCH_COMMON_SRC := \
+	tests/bench/bench_common/bench_fixture.cpp \
+	tests/bench/bench_common/bench_trace.cpp
+
+VPATH += $(TOP_DIR)/tests/bench/bench_common
@@ -0,0 +1,52 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "bench_fixture.hpp"
+
+class Combo : public BenchFixture {
+   protected:
+    std::vector<KeymapKey> letters = qwerty_keys();
+
+    void SetUp() override {
+        for (auto &key : letters) {
+            add_key(key);
+        }
+    }
+
+    const KeymapKey &letter(uint16_t keycode) {
+        for (auto &key : letters) {
+            if (key.code == keycode) {
+                return key;
+            }
+        }
+        return letters[0];
+    }
+};
+
+// Plain typing, where every key is held back until it can no longer be part of a combo
+TEST_F(Combo, Typing) {
+    auto trace = make_trace(random_sequence(letters, 500, 1), 120, 90);
+
+    benchmark(trace.size(), [&]() { play(trace, COMBO_TERM + 10); });
+}
+
+TEST_F(Combo, Chords) {
+    const uint16_t chords[][3] = {{KC_W, KC_E}, {KC_J, KC_K}, {KC_S, KC_D, KC_F}, {KC_X, KC_C}, {KC_F, KC_J}, {KC_J, KC_K, KC_L}, {KC_M, KC_COMM}, {KC_U, KC_I}};
+
+    std::vector<TraceEvent> trace;
+    uint32_t                now = 0;
+    for (uint16_t i = 0; i < 200; i++) {
+        auto &chord = chords[i % (sizeof(chords) / sizeof(chords[0]))];
+        for (uint8_t k = 0; k < 3 && chord[k]; k++) {
+            trace.push_back({now + k * 5, letter(chord[k]).position, true});
+        }
+        for (uint8_t k = 0; k < 3 && chord[k]; k++) {
+            trace.push_back({now + 60 + k * 5, letter(chord[k]).position, false});
+        }
+        now += 150;
+    }
+
+    benchmark(trace.size(), [&]() { play(trace, COMBO_TERM + 10); });
+}
@@ -0,0 +1,39 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// Chords across the home and top rows, as on keyboards with many combos
+const uint16_t PROGMEM we_combo[]   = {KC_W, KC_E, COMBO_END};
+const uint16_t PROGMEM er_combo[]   = {KC_E, KC_R, COMBO_END};
+const uint16_t PROGMEM ui_combo[]   = {KC_U, KC_I, COMBO_END};
+const uint16_t PROGMEM io_combo[]   = {KC_I, KC_O, COMBO_END};
+const uint16_t PROGMEM sd_combo[]   = {KC_S, KC_D, COMBO_END};
+const uint16_t PROGMEM df_combo[]   = {KC_D, KC_F, COMBO_END};
+const uint16_t PROGMEM jk_combo[]   = {KC_J, KC_K, COMBO_END};
+const uint16_t PROGMEM kl_combo[]   = {KC_K, KC_L, COMBO_END};
+const uint16_t PROGMEM sdf_combo[]  = {KC_S, KC_D, KC_F, COMBO_END};
+const uint16_t PROGMEM jkl_combo[]  = {KC_J, KC_K, KC_L, COMBO_END};
+const uint16_t PROGMEM xc_combo[]   = {KC_X, KC_C, COMBO_END};
+const uint16_t PROGMEM cv_combo[]   = {KC_C, KC_V, COMBO_END};
+const uint16_t PROGMEM mcom_combo[] = {KC_M, KC_COMM, COMBO_END};
+const uint16_t PROGMEM fj_combo[]   = {KC_F, KC_J, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    COMBO(we_combo, KC_ESC),
+    COMBO(er_combo, KC_TAB),
+    COMBO(ui_combo, KC_BSPC),
+    COMBO(io_combo, KC_DEL),
+    COMBO(sd_combo, KC_LPRN),
+    COMBO(df_combo, KC_RPRN),
+    COMBO(jk_combo, KC_ENT),
+    COMBO(kl_combo, KC_QUOT),
+    COMBO(sdf_combo, KC_LBRC),
+    COMBO(jkl_combo, KC_RBRC),
+    COMBO(xc_combo, KC_MINS),
+    COMBO(cv_combo, KC_EQL),
+    COMBO(mcom_combo, KC_SCLN),
+    COMBO(fj_combo, KC_CAPS),
+};
+// clang-format on
@@ -0,0 +1,78 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "bench_fixture.hpp"
+
+extern "C" const key_override_t *key_overrides[512];
+
+namespace {
+
+std::vector<key_override_t> overrides;
+
+// The ko_make_* initializers list their designators out of declaration order, which C++ does not allow.
+key_override_t make_override(uint8_t mods, uint16_t trigger, uint16_t replacement) {
+    key_override_t override  = {};
+    override.trigger         = trigger;
+    override.trigger_mods    = mods;
+    override.layers          = ~0;
+    override.suppressed_mods = mods;
+    override.replacement     = replacement;
+    override.options         = ko_options_default;
+    return override;
+}
+
+} // namespace
+
+extern "C" uint16_t key_override_count(void) {
+    return overrides.size();
+}
+
+class KeyOverride : public BenchFixture {
+   protected:
+    void TearDown() override {
+        clear_mods();
+        set_overrides({});
+    }
+
+    void set_overrides(std::vector<key_override_t> list) {
+        overrides = list;
+        for (size_t i = 0; i < overrides.size(); i++) {
+            key_overrides[i] = &overrides[i];
+        }
+        key_override_reindex();
+    }
+};
+
+// A key event with shift held, so every override has its modifiers down, but none is triggered
+TEST_F(KeyOverride, EventCost) {
+    keyrecord_t record = {};
+    record.event.type  = KEY_EVENT;
+
+    for (uint16_t count : {10, 100, 500}) {
+        std::vector<key_override_t> list;
+        for (uint16_t i = 0; i < count; i++) {
+            list.push_back(make_override(MOD_MASK_SHIFT, KC_A + (i % 26) + (i / 26) * 0x100, KC_B));
+        }
+        set_overrides(list);
+        add_mods(MOD_BIT(KC_LEFT_SHIFT));
+
+        const uint32_t events = 1000;
+        uint32_t       sent   = 0;
+        benchmark(
+            events,
+            [&]() {
+                for (uint32_t i = 0; i < events; i++) {
+                    record.event.pressed = i % 2 == 0;
+                    sent += process_key_override(KC_SPACE, &record);
+                }
+            },
+            std::to_string(count) + "_overrides");
+        EXPECT_EQ(sent % events, 0);
+        clear_mods();
+    }
+}
@@ -0,0 +1,7 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// Filled in by the benchmarks, see key_override_count() in bench_key_override.cpp
+const key_override_t *key_overrides[512] = {NULL};
@@ -0,0 +1,80 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "bench_fixture.hpp"
+
+class Keyboard : public BenchFixture {
+   protected:
+    std::vector<KeymapKey> letters = qwerty_keys();
+};
+
+TEST_F(Keyboard, Idle) {
+    set_keymap({});
+
+    benchmark(1000, [&]() { scan_for(1000); });
+}
+
+TEST_F(Keyboard, Typing) {
+    std::vector<KeymapKey> keymap = letters;
+    keymap.push_back(KeymapKey(0, 0, 3, KC_SPACE));
+    for (auto &key : keymap) {
+        add_key(key);
+    }
+
+    // About 100 words per minute, with each key held past the next press
+    auto trace = make_trace(random_sequence(keymap, 500, 1), 120, 150);
+
+    benchmark(trace.size(), [&]() { play(trace, 10); });
+}
+
+TEST_F(Keyboard, LayerChanges) {
+    auto layer_key = KeymapKey(0, 0, 3, MO(1));
+    add_key(layer_key);
+    for (auto &key : letters) {
+        add_key(key);
+        add_key(KeymapKey(1, key.position.col, key.position.row, KC_1 + key.position.col));
+    }
+
+    // Every other group of three keys comes from the upper layer
+    std::vector<TraceEvent> trace;
+    uint32_t                now      = 0;
+    auto                    sequence = random_sequence(letters, 300, 2);
+    for (size_t i = 0; i < sequence.size(); i++) {
+        bool upper = i % 6 < 3;
+        if (upper && i % 3 == 0) {
+            trace.push_back({now, layer_key.position, true});
+            now += 50;
+        }
+        trace.push_back({now, sequence[i].position, true});
+        trace.push_back({now + 60, sequence[i].position, false});
+        now += 100;
+        if (upper && i % 3 == 2) {
+            trace.push_back({now, layer_key.position, false});
+            now += 50;
+        }
+    }
+
+    benchmark(trace.size(), [&]() { play(trace, 10); });
+    EXPECT_EQ(layer_state, 0u);
+}
+
+TEST_F(Keyboard, TapHoldRolls) {
+    // Home row mods, rolled into the next key well within the tapping term
+    std::vector<KeymapKey> keymap;
+    const uint16_t         keycodes[] = {LGUI_T(KC_A), LALT_T(KC_S), LCTL_T(KC_D), LSFT_T(KC_F), KC_G, KC_H, RSFT_T(KC_J), RCTL_T(KC_K), RALT_T(KC_L), RGUI_T(KC_SCLN)};
+    for (uint8_t i = 0; i < sizeof(keycodes) / sizeof(keycodes[0]); i++) {
+        keymap.push_back(KeymapKey(0, i, 1, keycodes[i]));
+    }
+    for (auto &key : keymap) {
+        add_key(key);
+    }
+
+    auto rolls = make_trace(random_sequence(keymap, 500, 3), 80, 110);
+    benchmark(rolls.size(), [&]() { play(rolls, TAPPING_TERM + 10); }, "rolls");
+
+    // The same keys held past the tapping term
+    auto holds = make_trace(random_sequence(keymap, 200, 4), TAPPING_TERM, TAPPING_TERM + 50);
+    benchmark(holds.size(), [&]() { play(holds, TAPPING_TERM + 10); }, "holds");
+}
@@ -0,0 +1,82 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "bench_fixture.hpp"
+
+extern "C" {
+#include "action_util.h"
+#include "report.h"
+}
+
+class Nkro : public BenchFixture {
+   protected:
+    void TearDown() override {
+        clear_keys();
+        send_keyboard_report();
+    }
+};
+
+struct Keys {
+    std::vector<uint8_t> keys;
+    const char          *name;
+};
+
+// Looks up the keys of the NKRO bitmap, as done by the tapping and caps word code
+TEST_F(Nkro, Lookup) {
+    const Keys cases[] = {
+        {{}, "empty"},
+        {{KC_F24}, "last_key"},
+        {{KC_A, KC_S, KC_D, KC_F, KC_J, KC_K}, "six_keys"},
+    };
+    const unsigned calls = 1000;
+
+    for (auto &c : cases) {
+        clear_keys();
+        for (uint8_t key : c.keys) {
+            ::add_key(key);
+        }
+
+        volatile uint8_t result = 0;
+        benchmark(
+            calls,
+            [&]() {
+                for (unsigned i = 0; i < calls; i++) {
+                    result = result + has_anykey() + get_first_key();
+                }
+            },
+            c.name);
+    }
+}
+
+// Sends the report repeatedly, either unchanged and suppressed, or with a key toggled each time
+TEST_F(Nkro, SendReport) {
+    const unsigned calls = 1000;
+
+    ::add_key(KC_A);
+    send_keyboard_report();
+    benchmark(
+        calls,
+        [&]() {
+            for (unsigned i = 0; i < calls; i++) {
+                send_keyboard_report();
+            }
+        },
+        "unchanged");
+    EXPECT_EQ(reports_sent(), 0);
+
+    benchmark(
+        calls,
+        [&]() {
+            for (unsigned i = 0; i < calls; i++) {
+                if (i & 1) {
+                    ::del_key(KC_B);
+                } else {
+                    ::add_key(KC_B);
+                }
+                send_keyboard_report();
+            }
+        },
+        "changed");
+}
@@ -0,0 +1,83 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include "test_common.hpp"
+#include "bench_fixture.hpp"
+#include "qp_test_assets.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+}
+
+namespace {
+
+constexpr uint16_t SIZE = 240;
+
+uint8_t          framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SIZE, SIZE, 16)];
+painter_device_t surface;
+
+struct Format {
+    qp_image_format_t format;
+    uint8_t           bpp;
+};
+
+const Format PALETTE_FORMATS[] = {{PALETTE_1BPP, 1}, {PALETTE_2BPP, 2}, {PALETTE_4BPP, 4}, {PALETTE_8BPP, 8}};
+
+const painter_compression_t COMPRESSIONS[] = {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE, IMAGE_COMPRESSED_LZ};
+
+std::string describe(const Format &format, painter_compression_t compression) {
+    const char *names[] = {"raw", "rle", "lz"};
+    return std::to_string(format.bpp) + "bpp_" + names[compression];
+}
+
+} // namespace
+
+// Draws to an rgb565 surface, whose comms are no-ops, so the time is spent decoding and converting pixels
+class Painter : public BenchFixture {
+   protected:
+    void SetUp() override {
+        // Surfaces can not be freed, the same one is used by all of the benchmarks
+        if (!surface) {
+            surface = qp_make_rgb565_surface(SIZE, SIZE, framebuffer);
+        }
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    }
+};
+
+// A full screen image, one event being one pixel
+TEST_F(Painter, DrawImage) {
+    for (auto &format : PALETTE_FORMATS) {
+        auto pixels = qp_test_pixels(SIZE * SIZE, format.bpp, 42);
+        for (auto compression : COMPRESSIONS) {
+            auto                   image  = qp_test_make_qgf(SIZE, SIZE, format.format, format.bpp, qp_test_palette(format.bpp), pixels, compression);
+            painter_image_handle_t handle = qp_load_image_mem(image.data());
+            ASSERT_NE(handle, nullptr);
+            benchmark(SIZE * SIZE, [&]() { qp_drawimage(surface, 0, 0, handle); }, describe(format, compression));
+            qp_close_image(handle);
+        }
+    }
+}
+
+// A line of text in a font of 16 pixel high glyphs, one event being one pixel
+TEST_F(Painter, DrawText) {
+    const uint8_t     line_height = 16;
+    const std::string text        = "The quick brown fox";
+
+    for (auto &format : PALETTE_FORMATS) {
+        std::vector<QpTestGlyph> glyphs;
+        for (char c = 0x20; c < 0x7F; c++) {
+            glyphs.push_back({c, 10, qp_test_pixels(10 * line_height, format.bpp, c)});
+        }
+        for (auto compression : COMPRESSIONS) {
+            auto                  font   = qp_test_make_qff(line_height, format.format, format.bpp, qp_test_palette(format.bpp), glyphs, compression);
+            painter_font_handle_t handle = qp_load_font_mem(font.data());
+            ASSERT_NE(handle, nullptr);
+            benchmark(text.size() * 10 * line_height, [&]() { qp_drawtext(surface, 0, 0, handle, text.c_str()); }, describe(format, compression));
+            qp_close_font(handle);
+        }
+    }
+}
@@ -0,0 +1,97 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "bench_fixture.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+}
+
+class RgbMatrix : public BenchFixture {
+   protected:
+    std::vector<KeymapKey> letters = qwerty_keys();
+
+    void SetUp() override {
+        for (auto &key : letters) {
+            add_key(key);
+        }
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            add_key(KeymapKey(0, col, 3, KC_SPACE));
+        }
+        rgb_matrix_enable_noeeprom();
+    }
+};
+
+struct Effect {
+    uint8_t     mode;
+    const char *name;
+};
+
+// Renders each effect on its own, one event being one scan of the matrix
+TEST_F(RgbMatrix, Effects) {
+    const Effect effects[] = {
+        {RGB_MATRIX_SOLID_COLOR, "solid_color"},
+        {RGB_MATRIX_BREATHING, "breathing"},
+        {RGB_MATRIX_CYCLE_LEFT_RIGHT, "cycle_left_right"},
+        {RGB_MATRIX_RAINBOW_MOVING_CHEVRON, "rainbow_moving_chevron"},
+        {RGB_MATRIX_CYCLE_PINWHEEL, "cycle_pinwheel"},
+        {RGB_MATRIX_RAINDROPS, "raindrops"},
+        {RGB_MATRIX_DIGITAL_RAIN, "digital_rain"},
+    };
+
+    for (auto &effect : effects) {
+        rgb_matrix_mode_noeeprom(effect.mode);
+        benchmark(1000, [&]() { scan_for(1000); }, effect.name);
+    }
+}
+
+// Reactive effects, rendering the key presses of a typing trace
+TEST_F(RgbMatrix, Typing) {
+    const Effect effects[] = {
+        {RGB_MATRIX_SOLID_REACTIVE_SIMPLE, "solid_reactive_simple"},
+        {RGB_MATRIX_SOLID_REACTIVE_MULTIWIDE, "solid_reactive_multiwide"},
+        {RGB_MATRIX_SPLASH, "splash"},
+        {RGB_MATRIX_TYPING_HEATMAP, "typing_heatmap"},
+    };
+    auto trace = make_trace(random_sequence(letters, 300, 1), 120, 150);
+
+    for (auto &effect : effects) {
+        rgb_matrix_mode_noeeprom(effect.mode);
+        benchmark(trace.size(), [&]() { play(trace, 10); }, effect.name);
+    }
+}
+
+// Converts a frame's worth of colors, one at a time and in batches like the effect runners
+TEST_F(RgbMatrix, HsvToRgb) {
+    std::vector<hsv_t> hsv(RGB_MATRIX_HSV_BATCH_SIZE);
+    std::vector<rgb_t> rgb(RGB_MATRIX_HSV_BATCH_SIZE);
+    for (uint8_t i = 0; i < hsv.size(); i++) {
+        hsv[i] = {(uint8_t)(i * 37), (uint8_t)(255 - i * 5), (uint8_t)(i * 13)};
+    }
+    const unsigned frames = 1000;
+
+    benchmark(
+        frames * hsv.size(),
+        [&]() {
+            for (unsigned frame = 0; frame < frames; frame++) {
+                for (uint8_t i = 0; i < hsv.size(); i++) {
+                    hsv[i].h++;
+                    rgb[i] = rgb_matrix_hsv_to_rgb(hsv[i]);
+                }
+            }
+        },
+        "single");
+    benchmark(
+        frames * hsv.size(),
+        [&]() {
+            for (unsigned frame = 0; frame < frames; frame++) {
+                for (uint8_t i = 0; i < hsv.size(); i++) {
+                    hsv[i].h++;
+                }
+                rgb_matrix_hsv_to_rgb_batch(hsv.data(), rgb.data(), hsv.size());
+            }
+        },
+        "batch");
+}
@@ -0,0 +1,50 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "bench_fixture.hpp"
+
+class TapDance : public BenchFixture {
+   protected:
+    std::vector<KeymapKey> dances;
+
+    void SetUp() override {
+        for (uint8_t i = 0; i < 9; i++) {
+            dances.push_back(KeymapKey(0, i, 2, TD(i)));
+            add_key(dances.back());
+        }
+    }
+};
+
+// The cost of a scan, one event being one scan of the matrix
+TEST_F(TapDance, Scan) {
+    benchmark(TAPPING_TERM, [&]() { scan_for(TAPPING_TERM); }, "no_dance");
+
+    // A single tap, waiting for the tapping term to finish it
+    benchmark(
+        TAPPING_TERM + 2,
+        [&]() {
+            tap(dances[0]);
+            scan_for(TAPPING_TERM + 1);
+        },
+        "one_dance");
+
+    // Four dances held down, each one interrupting the one before, the last one waiting for the tapping term
+    benchmark(
+        TAPPING_TERM + 5,
+        [&]() {
+            for (uint8_t i = 0; i < 4; i++) {
+                press(dances[i]);
+                scan_for(1);
+            }
+            scan_for(TAPPING_TERM + 1);
+            for (uint8_t i = 0; i < 4; i++) {
+                release(dances[i]);
+            }
+            scan_for(1);
+        },
+        "four_dances");
+}
@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// A tap dance on each key of the home row, tapped once for the letter and twice for the digit
+tap_dance_action_t tap_dance_actions[] = {
+    ACTION_TAP_DANCE_DOUBLE(KC_A, KC_1), ACTION_TAP_DANCE_DOUBLE(KC_S, KC_2), ACTION_TAP_DANCE_DOUBLE(KC_D, KC_3), ACTION_TAP_DANCE_DOUBLE(KC_F, KC_4), ACTION_TAP_DANCE_DOUBLE(KC_G, KC_5),
+    ACTION_TAP_DANCE_DOUBLE(KC_H, KC_6), ACTION_TAP_DANCE_DOUBLE(KC_J, KC_7), ACTION_TAP_DANCE_DOUBLE(KC_K, KC_8), ACTION_TAP_DANCE_DOUBLE(KC_L, KC_9),
+};
@@ -0,0 +1,257 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+extern "C" const key_override_t *key_overrides[512];
+
+namespace {
+
+std::vector<key_override_t> overrides;
+
+// The ko_make_* initializers list their designators out of declaration order, which C++ does not allow.
+key_override_t make_override(uint8_t mods, uint16_t trigger, uint16_t replacement, layer_state_t layers = ~0) {
+    key_override_t override  = {};
+    override.trigger         = trigger;
+    override.trigger_mods    = mods;
+    override.layers          = layers;
+    override.suppressed_mods = mods;
+    override.replacement     = replacement;
+    override.options         = ko_options_default;
+    return override;
+}
+
+} // namespace
+
+extern "C" uint16_t key_override_count(void) {
+    return overrides.size();
+}
+
+class KeyOverride : public TestFixture {
+   public:
+    void SetUp() override {
+        set_overrides({});
+    }
+
+    void set_overrides(std::vector<key_override_t> list) {
+        overrides = list;
+        for (size_t i = 0; i < overrides.size(); i++) {
+            key_overrides[i] = &overrides[i];
+        }
+        key_override_reindex();
+    }
+};
+
+TEST_F(KeyOverride, ShiftBackspaceSendsDelete) {
+    TestDriver driver;
+    auto       key_shift = KeymapKey(0, 0, 0, KC_LEFT_SHIFT);
+    auto       key_bspc  = KeymapKey(0, 1, 0, KC_BACKSPACE);
+    set_keymap({key_shift, key_bspc});
+    set_overrides({make_override(MOD_MASK_SHIFT, KC_BACKSPACE, KC_DELETE)});
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    key_shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_DELETE));
+    key_bspc.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    key_bspc.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, FirstDefinedOverrideWins) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_shift = KeymapKey(0, 0, 0, KC_LEFT_SHIFT);
+    auto       key_a     = KeymapKey(0, 1, 0, KC_A);
+    set_keymap({key_shift, key_a});
+    // only activated by pressing a key, so that it is still a candidate once a is pressed
+    key_override_t any_key = make_override(MOD_MASK_SHIFT, KC_NO, KC_D);
+    any_key.options        = ko_option_activation_trigger_down;
+    set_overrides({
+        make_override(MOD_MASK_CTRL, KC_A, KC_X),
+        make_override(MOD_MASK_SHIFT, KC_A, KC_B),
+        make_override(MOD_MASK_SHIFT, KC_A, KC_C),
+        any_key,
+    });
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    key_shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // the override without a trigger is defined last, so it yields to the ones for a
+    EXPECT_REPORT(driver, (KC_B));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    key_a.release();
+    run_one_scan_loop();
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, ModifierActivatesWhileTriggerHeld) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_shift = KeymapKey(0, 0, 0, KC_LEFT_SHIFT);
+    auto       key_a     = KeymapKey(0, 1, 0, KC_A);
+    set_keymap({key_shift, key_a});
+    set_overrides({
+        make_override(MOD_MASK_CTRL, KC_B, KC_X),
+        make_override(MOD_MASK_SHIFT, KC_A, KC_B),
+    });
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // a is removed, and b only follows once the key repeat delay has passed
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_B));
+    key_shift.press();
+    idle_for(KEY_OVERRIDE_REPEAT_DELAY);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    key_shift.release();
+    run_one_scan_loop();
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, ModifiersOnlyOverride) {
+    TestDriver driver;
+    auto       key_ctrl  = KeymapKey(0, 0, 0, KC_LEFT_CTRL);
+    auto       key_shift = KeymapKey(0, 1, 0, KC_LEFT_SHIFT);
+    set_keymap({key_ctrl, key_shift});
+    set_overrides({make_override(MOD_BIT(KC_LEFT_CTRL) | MOD_BIT(KC_LEFT_SHIFT), KC_NO, KC_ESCAPE)});
+
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    key_ctrl.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    key_shift.press();
+    idle_for(KEY_OVERRIDE_REPEAT_DELAY);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    key_shift.release();
+    run_one_scan_loop();
+    key_ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, OnlyOnConfiguredLayers) {
+    TestDriver driver;
+    auto       key_shift   = KeymapKey(0, 0, 0, KC_LEFT_SHIFT);
+    auto       key_a       = KeymapKey(0, 1, 0, KC_A);
+    auto       key_shift_1 = KeymapKey(1, 0, 0, KC_LEFT_SHIFT);
+    auto       key_a_1     = KeymapKey(1, 1, 0, KC_A);
+    set_keymap({key_shift, key_a, key_shift_1, key_a_1});
+    set_overrides({make_override(MOD_MASK_SHIFT, KC_A, KC_B, 1 << 1)});
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.press();
+    run_one_scan_loop();
+    tap_key(key_a);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    layer_on(1);
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    key_shift_1.press();
+    run_one_scan_loop();
+    tap_key(key_a_1);
+    key_shift_1.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    layer_clear();
+}
+
+TEST_F(KeyOverride, FindsOverrideAmongMany) {
+    TestDriver                  driver;
+    auto                        key_shift = KeymapKey(0, 0, 0, KC_LEFT_SHIFT);
+    auto                        key_f12   = KeymapKey(0, 1, 0, KC_F12);
+    std::vector<key_override_t> list;
+    // triggers in descending order, so that sorting them moves every one
+    for (uint16_t trigger = 0x200; list.size() < 500; trigger--) {
+        if (!IS_MODIFIER_KEYCODE(trigger)) {
+            list.push_back(make_override(MOD_MASK_SHIFT, trigger, trigger == KC_F12 ? KC_F2 : KC_NO));
+        }
+    }
+    list.push_back(make_override(MOD_MASK_SHIFT, KC_F12, KC_F1));
+    set_keymap({key_shift, key_f12});
+    set_overrides(list);
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_F2));
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    key_shift.press();
+    run_one_scan_loop();
+    tap_key(key_f12);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, FirstDefinedWinsAmongManyWithTheSameTrigger) {
+    TestDriver                  driver;
+    auto                        key_shift = KeymapKey(0, 0, 0, KC_LEFT_SHIFT);
+    auto                        key_a     = KeymapKey(0, 1, 0, KC_A);
+    std::vector<key_override_t> list;
+    // interleaved triggers, so that the overrides for a end up all over the heap while sorting
+    for (uint16_t i = 0; i < 300; i++) {
+        uint16_t trigger = (i % 3 == 0) ? KC_A : KC_B + (i % 7);
+        list.push_back(make_override(MOD_MASK_SHIFT, trigger, list.empty() ? KC_1 : KC_2));
+    }
+    set_keymap({key_shift, key_a});
+    set_overrides(list);
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    key_shift.press();
+    run_one_scan_loop();
+    tap_key(key_a);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
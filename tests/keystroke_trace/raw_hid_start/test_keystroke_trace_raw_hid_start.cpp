@@ -0,0 +1,65 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "keystroke_trace.hpp"
+
+extern "C" {
+#include "keystroke_trace.h"
+#include "raw_hid.h"
+}
+
+namespace {
+
+std::vector<std::vector<uint8_t>> replies;
+
+std::vector<uint8_t> request(uint8_t command) {
+    std::vector<uint8_t> data(32);
+    data[0] = KEYSTROKE_TRACE_RAW_HID_ID;
+    data[1] = command;
+    return data;
+}
+
+} // namespace
+
+extern "C" void raw_hid_send(uint8_t *data, uint8_t length) {
+    replies.emplace_back(data, data + length);
+}
+
+class KeystrokeTraceRawHidStart : public TestFixture {
+   protected:
+    void SetUp() override {
+        replies.clear();
+    }
+
+    void TearDown() override {
+        keystroke_trace_stop();
+    }
+};
+
+TEST_F(KeystrokeTraceRawHidStart, StartsAndStops) {
+    ReportRecorder recorder;
+    KeymapKey      key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    auto start = request(KEYSTROKE_TRACE_CMD_START);
+    ASSERT_TRUE(keystroke_trace_raw_hid_receive(start.data(), start.size()));
+    EXPECT_TRUE(keystroke_trace_is_recording());
+
+    tap_key(key_a);
+
+    auto stop = request(KEYSTROKE_TRACE_CMD_STOP);
+    ASSERT_TRUE(keystroke_trace_raw_hid_receive(stop.data(), stop.size()));
+    EXPECT_FALSE(keystroke_trace_is_recording());
+
+    auto read = request(KEYSTROKE_TRACE_CMD_READ);
+    ASSERT_TRUE(keystroke_trace_raw_hid_receive(read.data(), read.size()));
+
+    ASSERT_EQ(replies.size(), 3u);
+    EXPECT_EQ(replies[0][2], true);
+    EXPECT_EQ(replies[1][2], false);
+    EXPECT_EQ(replies[2][3], 6);
+}
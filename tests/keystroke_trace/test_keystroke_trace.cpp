@@ -0,0 +1,254 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <sstream>
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "keystroke_trace.hpp"
+
+extern "C" {
+#include "keystroke_trace.h"
+#include "raw_hid.h"
+}
+
+using testing::ElementsAre;
+
+namespace {
+
+std::vector<std::vector<uint8_t>> replies;
+std::vector<bool>                 recording_changes;
+
+std::vector<uint8_t> read_all() {
+    std::vector<uint8_t> data;
+    uint8_t              chunk[16];
+    uint8_t              size;
+    while ((size = keystroke_trace_read(chunk, sizeof(chunk)))) {
+        data.insert(data.end(), chunk, chunk + size);
+    }
+    return data;
+}
+
+MATCHER_P4(Event, time_ms, col, row, pressed, "") {
+    return arg.time_ms == (uint32_t)time_ms && arg.position.col == col && arg.position.row == row && arg.pressed == pressed;
+}
+
+} // namespace
+
+extern "C" void raw_hid_send(uint8_t *data, uint8_t length) {
+    replies.emplace_back(data, data + length);
+}
+
+extern "C" void keystroke_trace_recording_user(bool recording) {
+    recording_changes.push_back(recording);
+}
+
+class KeystrokeTraceTest : public TestFixture {
+   protected:
+    void SetUp() override {
+        replies.clear();
+        recording_changes.clear();
+    }
+
+    void TearDown() override {
+        keystroke_trace_stop();
+        read_all();
+    }
+};
+
+TEST_F(KeystrokeTraceTest, RecordsNothingUntilStarted) {
+    ReportRecorder recorder;
+    KeymapKey      key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    tap_key(key_a);
+
+    EXPECT_FALSE(keystroke_trace_is_recording());
+    EXPECT_TRUE(read_all().empty());
+}
+
+TEST_F(KeystrokeTraceTest, RecordsMatrixEvents) {
+    ReportRecorder recorder;
+    KeymapKey      key_a(0, 0, 0, KC_A);
+    KeymapKey      key_b(0, 3, 2, KC_B);
+    set_keymap({key_a, key_b});
+
+    keystroke_trace_start(KEYSTROKE_TRACE_RAW_HID);
+    idle_for(500);
+    key_a.press();
+    idle_for(40);
+    key_b.press();
+    idle_for(25);
+    key_a.release();
+    idle_for(1000);
+    key_b.release();
+    run_one_scan_loop();
+
+    auto data = read_all();
+    // Delta times below 64ms take a single byte, the 500ms and 1000ms ones two
+    EXPECT_EQ(data.size(), 4 * 3 + 2);
+
+    auto trace = decode_keystroke_trace(data);
+    EXPECT_FALSE(trace.lost);
+    EXPECT_THAT(trace.events, ElementsAre(Event(0, 0, 0, true), Event(40, 3, 2, true), Event(65, 0, 0, false), Event(1065, 3, 2, false)));
+}
+
+TEST_F(KeystrokeTraceTest, MarksLostEvents) {
+    ReportRecorder recorder;
+    KeymapKey      key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    keystroke_trace_start(KEYSTROKE_TRACE_RAW_HID);
+    for (int i = 0; i < KEYSTROKE_TRACE_BUFFER_SIZE; i++) {
+        tap_key(key_a);
+    }
+    auto first = read_all();
+
+    tap_key(key_a);
+    auto second = read_all();
+
+    auto trace = decode_keystroke_trace(first);
+    EXPECT_FALSE(trace.lost);
+    EXPECT_LT(trace.events.size(), 2u * KEYSTROKE_TRACE_BUFFER_SIZE);
+    EXPECT_GT(trace.events.size(), 0u);
+
+    trace = decode_keystroke_trace(second);
+    EXPECT_TRUE(trace.lost);
+    EXPECT_THAT(trace.events, ElementsAre(Event(0, 0, 0, true), Event(1, 0, 0, false)));
+}
+
+TEST_F(KeystrokeTraceTest, RawHid) {
+    ReportRecorder recorder;
+    KeymapKey      key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    std::vector<uint8_t> request(32);
+    request[0] = KEYSTROKE_TRACE_RAW_HID_ID;
+    request[1] = KEYSTROKE_TRACE_CMD_START;
+    ASSERT_TRUE(keystroke_trace_raw_hid_receive(request.data(), request.size()));
+    EXPECT_FALSE(keystroke_trace_is_recording());
+
+    // Without KEYSTROKE_TRACE_RAW_HID_START, only the keyboard can start recording
+    keystroke_trace_start(KEYSTROKE_TRACE_RAW_HID);
+    tap_key(key_a, 10);
+
+    request.assign(32, 0);
+    request[0] = KEYSTROKE_TRACE_RAW_HID_ID;
+    request[1] = KEYSTROKE_TRACE_CMD_READ;
+    ASSERT_TRUE(keystroke_trace_raw_hid_receive(request.data(), request.size()));
+
+    ASSERT_EQ(replies.size(), 2u);
+    EXPECT_EQ(replies[0][2], false);
+    auto &reply = replies[1];
+    EXPECT_EQ(reply[0], KEYSTROKE_TRACE_RAW_HID_ID);
+    EXPECT_EQ(reply[1], KEYSTROKE_TRACE_CMD_READ);
+    EXPECT_EQ(reply[2], true);
+    ASSERT_EQ(reply[3], 6);
+
+    auto trace = decode_keystroke_trace(std::vector<uint8_t>(reply.begin() + 4, reply.begin() + 4 + reply[3]));
+    EXPECT_THAT(trace.events, ElementsAre(Event(0, 0, 0, true), Event(10, 0, 0, false)));
+
+    request.assign(32, 0);
+    request[0] = 0x01;
+    EXPECT_FALSE(keystroke_trace_raw_hid_receive(request.data(), request.size()));
+}
+
+TEST_F(KeystrokeTraceTest, ReportsRecordingChanges) {
+    keystroke_trace_start(KEYSTROKE_TRACE_CONSOLE);
+    keystroke_trace_start(KEYSTROKE_TRACE_RAW_HID);
+    keystroke_trace_stop();
+    keystroke_trace_stop();
+
+    EXPECT_THAT(recording_changes, ElementsAre(true, false));
+}
+
+TEST_F(KeystrokeTraceTest, ReadsConsoleLog) {
+    // A roll from a mod-tap key into the next key, within the tapping term
+    std::istringstream log(
+        "Listening:\n"
+        "keyboard:1: kt:010000650001\r\n"
+        "keyboard:1: layer: 0\n"
+        "keyboard:1: kt:3C0000500001\n");
+
+    auto trace = read_keystroke_trace(log);
+    EXPECT_FALSE(trace.lost);
+    EXPECT_THAT(trace.events, ElementsAre(Event(0, 0, 0, true), Event(50, 1, 0, true), Event(80, 0, 0, false), Event(120, 1, 0, false)));
+
+    ReportRecorder recorder;
+    KeymapKey      key_a(0, 0, 0, LSFT_T(KC_A));
+    KeymapKey      key_b(0, 1, 0, KC_B);
+    set_keymap({key_a, key_b});
+
+    uint32_t start = timer_read32();
+    replay_keystroke_trace(*this, trace);
+
+    ASSERT_EQ(recorder.reports.size(), 4u);
+    EXPECT_TRUE(KeyboardReport(KC_A).Matches(recorder.reports[0].report)) << recorder.reports[0].report;
+    EXPECT_TRUE(KeyboardReport(KC_A, KC_B).Matches(recorder.reports[1].report)) << recorder.reports[1].report;
+    EXPECT_TRUE(KeyboardReport(KC_B).Matches(recorder.reports[2].report)) << recorder.reports[2].report;
+    EXPECT_TRUE(KeyboardReport().Matches(recorder.reports[3].report)) << recorder.reports[3].report;
+
+    // The tap is only known once the mod-tap key is released
+    EXPECT_EQ(recorder.reports[0].time_ms - start, 80u);
+    EXPECT_EQ(recorder.reports[3].time_ms - start, 120u);
+}
+
+// Replaying a recording gives back the reports the keyboard sent, at the same times
+TEST_F(KeystrokeTraceTest, ReplayMatchesRecording) {
+    KeymapKey key_a(0, 0, 0, LSFT_T(KC_A));
+    KeymapKey key_b(0, 1, 0, KC_B);
+    KeymapKey key_c(0, 2, 0, LT(1, KC_C));
+    KeymapKey key_d(0, 3, 0, KC_D);
+    KeymapKey key_e(1, 3, 0, KC_E);
+    set_keymap({key_a, key_b, key_c, key_d, key_e});
+
+    std::vector<ReportRecorder::Report> recorded;
+    uint32_t                            recorded_start;
+    {
+        ReportRecorder recorder;
+        keystroke_trace_start(KEYSTROKE_TRACE_RAW_HID);
+        idle_for(100);
+        recorded_start = timer_read32();
+
+        key_a.press();
+        idle_for(30);
+        key_b.press();
+        idle_for(30);
+        key_a.release();
+        idle_for(5);
+        key_b.release();
+        idle_for(300);
+        key_a.press();
+        idle_for(TAPPING_TERM + 20);
+        key_b.press();
+        idle_for(10);
+        key_b.release();
+        idle_for(10);
+        key_a.release();
+        idle_for(50);
+        key_c.press();
+        idle_for(TAPPING_TERM + 5);
+        key_d.press();
+        idle_for(20);
+        key_c.release();
+        idle_for(20);
+        key_d.release();
+        idle_for(1000);
+
+        recorded = recorder.reports;
+    }
+    auto trace = decode_keystroke_trace(read_all());
+    ASSERT_FALSE(trace.lost);
+    ASSERT_EQ(trace.events.size(), 12u);
+
+    ReportRecorder recorder;
+    uint32_t       replayed_start = timer_read32();
+    replay_keystroke_trace(*this, trace);
+
+    ASSERT_EQ(recorder.reports.size(), recorded.size());
+    for (size_t i = 0; i < recorded.size(); i++) {
+        EXPECT_EQ(recorder.reports[i].report, recorded[i].report) << "report " << i;
+        EXPECT_EQ(recorder.reports[i].time_ms - replayed_start, recorded[i].time_ms - recorded_start) << "report " << i;
+    }
+}
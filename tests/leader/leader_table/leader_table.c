@@ -0,0 +1,26 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/* The trie lib/python/qmk/keymap.py builds for these leader_sequences:
+ *
+ *   KC_A                     -> KC_1
+ *   KC_A KC_B                -> KC_2
+ *   KC_A KC_B KC_C           -> KC_3
+ *   KC_A KC_C                -> KC_4
+ *   KC_D KC_E                -> LCTL(KC_E)
+ *   KC_F KC_G KC_H KC_I KC_J -> KC_5
+ */
+const leader_node_t PROGMEM leader_trie[] = {
+    [0] = {KC_NO, KC_NO, 1, 3}, // root
+    [1] = {KC_A, KC_1, 4, 2}, // KC_A
+    [2] = {KC_D, KC_NO, 6, 1}, // KC_D
+    [3] = {KC_F, KC_NO, 7, 1}, // KC_F
+    [4] = {KC_B, KC_2, 8, 1}, // KC_A KC_B
+    [5] = {KC_C, KC_4, 0, 0}, // KC_A KC_C
+    [6] = {KC_E, LCTL(KC_E), 0, 0}, // KC_D KC_E
+    [7] = {KC_G, KC_NO, 9, 1}, // KC_F KC_G
+    [8] = {KC_C, KC_3, 0, 0}, // KC_A KC_B KC_C
+    [9] = {KC_H, KC_NO, 10, 1}, // KC_F KC_G KC_H
+    [10] = {KC_I, KC_NO, 11, 1}, // KC_F KC_G KC_H KC_I
+    [11] = {KC_J, KC_5, 0, 0}, // KC_F KC_G KC_H KC_I KC_J
+};
@@ -0,0 +1,9 @@
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+LEADER_ENABLE = yes
+LEADER_ENABLE = yes
+LEADER_TABLE_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = ../leader_table/leader_table.c
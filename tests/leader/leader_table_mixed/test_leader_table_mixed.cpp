@@ -0,0 +1,92 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+// Sequences handled in code, next to those of the table
+extern "C" void leader_end_user(void) {
+    if (leader_sequence_one_key(KC_Z)) {
+        tap_code(KC_8);
+    } else if (leader_sequence_three_keys(KC_A, KC_C, KC_D)) {
+        tap_code(KC_9);
+    }
+}
+
+class LeaderTableMixed : public TestFixture {};
+
+TEST_F(LeaderTableMixed, unambiguous_sequence_triggers_on_timeout) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_c      = KeymapKey(0, 2, 0, KC_C);
+
+    set_keymap({key_leader, key_a, key_c});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_keys(key_a, key_c);
+    VERIFY_AND_CLEAR(driver);
+
+    // leader_end_user() may still continue a c
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    EXPECT_REPORT(driver, (KC_4));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderTableMixed, sequence_missing_from_the_table) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_z      = KeymapKey(0, 1, 0, KC_Z);
+
+    set_keymap({key_leader, key_z});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_z);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    EXPECT_REPORT(driver, (KC_8));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderTableMixed, sequence_continuing_one_from_the_table) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_c      = KeymapKey(0, 2, 0, KC_C);
+    auto key_d      = KeymapKey(0, 3, 0, KC_D);
+
+    set_keymap({key_leader, key_a, key_c, key_d});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_keys(key_a, key_c, key_d);
+    VERIFY_AND_CLEAR(driver);
+
+    // Only leader_end_user() handles a c d, the table does not tap a c
+    EXPECT_REPORT(driver, (KC_9));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+    VERIFY_AND_CLEAR(driver);
+}
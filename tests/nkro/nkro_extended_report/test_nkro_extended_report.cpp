@@ -0,0 +1,65 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstddef>
+
+#include "keycode.h"
+#include "report.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+class NkroExtendedReport : public TestFixture {};
+
+TEST_F(NkroExtendedReport, ModifiersAreTheLastBitmapByte) {
+    EXPECT_EQ(sizeof(report_nkro_t), 30u);
+    EXPECT_EQ(offsetof(report_nkro_t, mods), offsetof(report_nkro_t, bits) + (KC_LEFT_CTRL >> 3));
+
+    report_nkro_t report = {};
+    report.mods          = MOD_BIT(KC_RIGHT_GUI);
+    EXPECT_EQ(report.bits[KC_RIGHT_GUI >> 3], 1 << (KC_RIGHT_GUI & 7));
+    // the modifiers do not count as keys
+    EXPECT_FALSE(nkro_bits_any(&report));
+    EXPECT_EQ(nkro_bits_count(&report), 0);
+    EXPECT_EQ(nkro_bits_first(&report), KC_NO);
+}
+
+TEST_F(NkroExtendedReport, ModifiersAndKeysShareTheBitmap) {
+    TestDriver driver;
+    auto       key_ctrl = KeymapKey(0, 0, 0, KC_LEFT_CTRL);
+    auto       key_c    = KeymapKey(0, 1, 0, KC_C);
+
+    set_keymap({key_ctrl, key_c});
+
+    key_ctrl.press();
+    EXPECT_CALL(driver, send_nkro_mock(_)).WillOnce([](report_nkro_t &report) {
+        EXPECT_EQ(report.bits[KC_LEFT_CTRL >> 3], MOD_BIT(KC_LEFT_CTRL));
+        EXPECT_FALSE(nkro_bits_any(&report));
+    });
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_c.press();
+    EXPECT_CALL(driver, send_nkro_mock(_)).WillOnce([](report_nkro_t &report) {
+        EXPECT_EQ(report.mods, MOD_BIT(KC_LEFT_CTRL));
+        EXPECT_EQ(nkro_bits_first(&report), KC_C);
+        EXPECT_EQ(nkro_bits_count(&report), 1);
+    });
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // clearing the keys leaves the modifiers alone
+    EXPECT_CALL(driver, send_nkro_mock(_)).WillOnce([](report_nkro_t &report) {
+        EXPECT_EQ(report.mods, MOD_BIT(KC_LEFT_CTRL));
+        EXPECT_FALSE(nkro_bits_any(&report));
+    });
+    clear_keys_from_report();
+    send_keyboard_report();
+    VERIFY_AND_CLEAR(driver);
+
+    key_c.release();
+    key_ctrl.release();
+    EXPECT_CALL(driver, send_nkro_mock(_)).Times(1);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,173 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "report.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+MATCHER_P2(NkroReport, mods, keys, "") {
+    report_nkro_t expected = {};
+    for (uint8_t key : keys) {
+        add_key_bit(&expected, key);
+    }
+    return arg.mods == mods && nkro_bits_equal(&arg, &expected);
+}
+
+#define EXPECT_NKRO_REPORT(driver, mods, ...) EXPECT_CALL((driver), send_nkro_mock(NkroReport((mods), std::vector<uint8_t>{__VA_ARGS__})))
+#define EXPECT_NO_NKRO_REPORT(driver) EXPECT_CALL((driver), send_nkro_mock(_)).Times(0)
+
+class Nkro : public TestFixture {};
+
+TEST_F(Nkro, KeysAreReportedInTheBitmap) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_z = KeymapKey(0, 1, 0, KC_Z);
+
+    set_keymap({key_a, key_z});
+
+    EXPECT_NO_REPORT(driver);
+    key_a.press();
+    EXPECT_NKRO_REPORT(driver, 0, KC_A);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_z.press();
+    EXPECT_NKRO_REPORT(driver, 0, KC_A, KC_Z);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_a.release();
+    EXPECT_NKRO_REPORT(driver, 0, KC_Z);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_z.release();
+    EXPECT_NKRO_REPORT(driver, 0);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Nkro, ModifiersAreReportedSeparately) {
+    TestDriver driver;
+    auto       key_shift = KeymapKey(0, 0, 0, KC_LEFT_SHIFT);
+    auto       key_a     = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_shift, key_a});
+
+    key_shift.press();
+    EXPECT_NKRO_REPORT(driver, MOD_BIT(KC_LEFT_SHIFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_a.press();
+    EXPECT_NKRO_REPORT(driver, MOD_BIT(KC_LEFT_SHIFT), KC_A);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // the modifier is never part of the key bitmap
+    EXPECT_EQ(has_anykey(), 1);
+    EXPECT_EQ(get_first_key(), KC_A);
+
+    key_shift.release();
+    EXPECT_NKRO_REPORT(driver, 0, KC_A);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_a.release();
+    EXPECT_NKRO_REPORT(driver, 0);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Nkro, UnchangedReportIsNotResent) {
+    TestDriver driver;
+
+    EXPECT_NKRO_REPORT(driver, 0, KC_B);
+    add_key_to_report(KC_B);
+    send_keyboard_report();
+    VERIFY_AND_CLEAR(driver);
+
+    // adding a key that is already pressed does not change the report
+    EXPECT_NO_NKRO_REPORT(driver);
+    add_key_to_report(KC_B);
+    send_keyboard_report();
+    send_keyboard_report();
+    VERIFY_AND_CLEAR(driver);
+
+    // neither does adding and removing a key in between two reports
+    EXPECT_NO_NKRO_REPORT(driver);
+    add_key_to_report(KC_C);
+    del_key_from_report(KC_C);
+    send_keyboard_report();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NKRO_REPORT(driver, 0);
+    clear_keys_from_report();
+    send_keyboard_report();
+    VERIFY_AND_CLEAR(driver);
+
+    // clearing an empty report has nothing to send
+    EXPECT_NO_NKRO_REPORT(driver);
+    clear_keys_from_report();
+    send_keyboard_report();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Nkro, ReportQueries) {
+    TestDriver driver;
+
+    EXPECT_EQ(has_anykey(), 0);
+    EXPECT_EQ(get_first_key(), KC_NO);
+
+    add_mods(MOD_BIT(KC_RIGHT_ALT));
+    add_key_to_report(KC_F24);
+    add_key_to_report(KC_ESCAPE);
+    add_key_to_report(KC_LANGUAGE_9);
+
+    EXPECT_EQ(has_anykey(), 3);
+    EXPECT_EQ(get_first_key(), KC_ESCAPE);
+    EXPECT_TRUE(is_key_pressed(KC_F24));
+    EXPECT_TRUE(is_key_pressed(KC_LANGUAGE_9));
+    EXPECT_FALSE(is_key_pressed(KC_A));
+    EXPECT_FALSE(is_key_pressed(KC_RIGHT_ALT));
+
+    del_key_from_report(KC_ESCAPE);
+    EXPECT_EQ(get_first_key(), KC_F24);
+
+    EXPECT_NKRO_REPORT(driver, MOD_BIT(KC_RIGHT_ALT), KC_F24, KC_LANGUAGE_9);
+    send_keyboard_report();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NKRO_REPORT(driver, 0);
+    clear_keyboard();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST(NkroBits, HelpersTrackChanges) {
+    report_nkro_t report = {};
+
+    EXPECT_FALSE(nkro_bits_any(&report));
+    EXPECT_EQ(nkro_bits_first(&report), KC_NO);
+
+    EXPECT_TRUE(add_key_bit(&report, KC_LANGUAGE_9));
+    EXPECT_FALSE(add_key_bit(&report, KC_LANGUAGE_9));
+    EXPECT_TRUE(nkro_bits_any(&report));
+    EXPECT_EQ(nkro_bits_first(&report), KC_LANGUAGE_9);
+
+    for (uint8_t key = KC_A; key <= KC_Z; key++) {
+        add_key_bit(&report, key);
+    }
+    EXPECT_EQ(nkro_bits_count(&report), 27);
+    EXPECT_EQ(nkro_bits_first(&report), KC_A);
+
+    report_nkro_t other = report;
+    EXPECT_TRUE(nkro_bits_equal(&report, &other));
+    other.mods = MOD_BIT(KC_LEFT_GUI);
+    EXPECT_TRUE(nkro_bits_equal(&report, &other));
+    EXPECT_TRUE(del_key_bit(&other, KC_Q));
+    EXPECT_FALSE(del_key_bit(&other, KC_Q));
+    EXPECT_FALSE(nkro_bits_equal(&report, &other));
+}
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define QP_LVGL_DOUBLE_BUFFER
+#define QP_LVGL_FLUSH_CHUNK_PIXELS 40
@@ -0,0 +1,50 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The parts of the LVGL 8 API used by qp_lvgl.c, implemented by the test
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LV_COLOR_DEPTH 16
+#define LV_COLOR_16_SWAP 1
+
+typedef int16_t lv_coord_t;
+
+typedef union {
+    uint16_t full;
+} lv_color_t;
+
+typedef struct {
+    lv_coord_t x1;
+    lv_coord_t y1;
+    lv_coord_t x2;
+    lv_coord_t y2;
+} lv_area_t;
+
+typedef struct {
+    void *   buf1;
+    void *   buf2;
+    uint32_t size;
+} lv_disp_draw_buf_t;
+
+typedef struct _lv_disp_drv_t {
+    lv_coord_t          hor_res;
+    lv_coord_t          ver_res;
+    lv_disp_draw_buf_t *draw_buf;
+    uint32_t            direct_mode : 1;
+    void (*flush_cb)(struct _lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+    void (*wait_cb)(struct _lv_disp_drv_t *disp_drv);
+} lv_disp_drv_t;
+
+typedef struct _lv_disp_t lv_disp_t;
+
+void       lv_init(void);
+void       lv_tick_inc(uint32_t tick_period);
+uint32_t   lv_task_handler(void);
+void       lv_disp_drv_init(lv_disp_drv_t *driver);
+void       lv_disp_draw_buf_init(lv_disp_draw_buf_t *draw_buf, void *buf1, void *buf2, uint32_t size_in_px_cnt);
+lv_disp_t *lv_disp_drv_register(lv_disp_drv_t *driver);
+void       lv_disp_flush_ready(lv_disp_drv_t *disp_drv);
@@ -0,0 +1,11 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface
+
+# LVGL itself is not needed, lvgl.h here declares the few parts of it that qp_lvgl.c uses
+OPT_DEFS += -DQUANTUM_PAINTER_LVGL_INTEGRATION_ENABLE
+DEFERRED_EXEC_ENABLE = yes
+VPATH += $(QUANTUM_DIR)/painter/lvgl
+SRC += qp_lvgl.c
@@ -0,0 +1,143 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+#include "qp_lvgl.h"
+
+extern painter_device_t selected_display;
+
+void qp_lvgl_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p);
+void qp_lvgl_internal_tick(void);
+}
+
+namespace {
+
+constexpr uint16_t SURFACE_WIDTH  = 64;
+constexpr uint16_t SURFACE_HEIGHT = 16;
+constexpr uint16_t WHITE          = 0xFFFF;
+
+int flush_ready_count;
+
+} // namespace
+
+extern "C" {
+void lv_init(void) {}
+void lv_tick_inc(uint32_t tick_period) {}
+uint32_t lv_task_handler(void) {
+    return 0;
+}
+void lv_disp_drv_init(lv_disp_drv_t *driver) {}
+void lv_disp_draw_buf_init(lv_disp_draw_buf_t *draw_buf, void *buf1, void *buf2, uint32_t size_in_px_cnt) {}
+lv_disp_t *lv_disp_drv_register(lv_disp_drv_t *driver) {
+    return nullptr;
+}
+void lv_disp_flush_ready(lv_disp_drv_t *disp_drv) {
+    flush_ready_count++;
+}
+}
+
+/*
+ * Hands LVGL areas straight to qp_lvgl_flush(), as LVGL would, and sends
+ * them to a surface in chunks while other drawing happens in between.
+ */
+class QpLvgl : public ::testing::Test {
+   protected:
+    static uint16_t         pixels[SURFACE_WIDTH * SURFACE_HEIGHT];
+    static painter_device_t surface;
+    lv_disp_drv_t           disp = {};
+
+    static void SetUpTestSuite() {
+        surface = qp_make_rgb565_surface(SURFACE_WIDTH, SURFACE_HEIGHT, pixels);
+    }
+
+    void SetUp() override {
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        memset(pixels, 0, sizeof(pixels));
+        flush_ready_count = 0;
+        selected_display  = surface;
+    }
+
+    void TearDown() override {
+        selected_display = NULL;
+    }
+
+    static std::vector<lv_color_t> area_pixels(const lv_area_t &area) {
+        std::vector<lv_color_t> colors((area.x2 - area.x1 + 1) * (area.y2 - area.y1 + 1));
+        for (size_t i = 0; i < colors.size(); i++) {
+            colors[i].full = i + 1;
+        }
+        return colors;
+    }
+
+    // Every pixel of the area as sent by LVGL, the rectangle drawn in white if any, and nothing else
+    static void expect_surface(const lv_area_t &area, uint16_t l = 1, uint16_t t = 1, uint16_t r = 0, uint16_t b = 0) {
+        uint16_t width = area.x2 - area.x1 + 1;
+        for (uint16_t y = 0; y < SURFACE_HEIGHT; y++) {
+            for (uint16_t x = 0; x < SURFACE_WIDTH; x++) {
+                uint16_t expected = 0;
+                if (x >= area.x1 && x <= area.x2 && y >= area.y1 && y <= area.y2) {
+                    expected = (y - area.y1) * width + (x - area.x1) + 1;
+                } else if (x >= l && x <= r && y >= t && y <= b) {
+                    expected = WHITE;
+                }
+                ASSERT_EQ(pixels[y * SURFACE_WIDTH + x], expected) << "at " << x << "," << y;
+            }
+        }
+    }
+};
+
+uint16_t         QpLvgl::pixels[SURFACE_WIDTH * SURFACE_HEIGHT];
+painter_device_t QpLvgl::surface;
+
+TEST_F(QpLvgl, SendsWholeRowsPerChunk) {
+    // 10 pixels wide, so 4 rows fit in each chunk of 40 pixels
+    lv_area_t area   = {4, 2, 13, 11};
+    auto      colors = area_pixels(area);
+    qp_lvgl_flush(&disp, &area, colors.data());
+
+    qp_lvgl_internal_tick();
+    qp_lvgl_internal_tick();
+    EXPECT_EQ(flush_ready_count, 0);
+    qp_lvgl_internal_tick();
+    EXPECT_EQ(flush_ready_count, 1);
+
+    expect_surface(area);
+}
+
+TEST_F(QpLvgl, OtherDrawingBetweenChunks) {
+    lv_area_t area   = {4, 2, 13, 11};
+    auto      colors = area_pixels(area);
+    qp_lvgl_flush(&disp, &area, colors.data());
+
+    // Each draw moves the surface's viewport, as an animation would
+    qp_lvgl_internal_tick();
+    ASSERT_TRUE(qp_rect(surface, 20, 0, 27, 3, 0, 0, 255, true));
+    qp_lvgl_internal_tick();
+    ASSERT_TRUE(qp_rect(surface, 20, 0, 27, 3, 0, 0, 255, true));
+    qp_lvgl_internal_tick();
+    EXPECT_EQ(flush_ready_count, 1);
+
+    expect_surface(area, 20, 0, 27, 3);
+}
+
+TEST_F(QpLvgl, SendsAtLeastOneRow) {
+    // Wider than a chunk, each row is sent on its own
+    lv_area_t area   = {2, 5, 61, 7};
+    auto      colors = area_pixels(area);
+    qp_lvgl_flush(&disp, &area, colors.data());
+
+    qp_lvgl_internal_tick();
+    ASSERT_TRUE(qp_rect(surface, 0, 12, 7, 15, 0, 0, 255, true));
+    qp_lvgl_internal_tick();
+    EXPECT_EQ(flush_ready_count, 0);
+    qp_lvgl_internal_tick();
+    EXPECT_EQ(flush_ready_count, 1);
+
+    expect_surface(area, 0, 12, 7, 15);
+}
@@ -0,0 +1,235 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+extern "C" {
+#include "qp_internal.h"
+}
+
+/*
+    Builds QGF images and QFF fonts in memory, the same way
+    `qmk painter-convert-graphics` and `qmk painter-make-font-image` lay them
+    out, so that the decoders can be checked against pixels known up front.
+*/
+
+struct QpTestPalette {
+    uint8_t h, s, v;
+};
+
+// A distinct color for each palette index
+inline std::vector<QpTestPalette> qp_test_palette(uint8_t bpp) {
+    std::vector<QpTestPalette> palette;
+    for (uint16_t i = 0; i < (1u << bpp); i++) {
+        palette.push_back({(uint8_t)(i * 37), (uint8_t)(255 - (i & 0x3F)), (uint8_t)(255 - i / 2)});
+    }
+    return palette;
+}
+
+// Palette indices in runs of random lengths, similar to artwork
+inline std::vector<uint8_t> qp_test_pixels(uint32_t count, uint8_t bpp, uint32_t seed) {
+    std::vector<uint8_t> pixels;
+    const uint8_t        mask = (1 << bpp) - 1;
+    while (pixels.size() < count) {
+        seed          = seed * 1103515245 + 12345;
+        uint8_t index = (seed >> 16) & mask;
+        uint8_t run   = (seed >> 8) % 4 == 0 ? 1 : (seed >> 24) % 40 + 1;
+        for (uint8_t i = 0; i < run && pixels.size() < count; i++) {
+            pixels.push_back(index);
+        }
+    }
+    return pixels;
+}
+
+// Packs palette indices, lowest bits first
+inline std::vector<uint8_t> qp_test_pack(const std::vector<uint8_t> &pixels, uint8_t bpp) {
+    const uint8_t        pixels_per_byte = 8 / bpp;
+    std::vector<uint8_t> packed((pixels.size() + pixels_per_byte - 1) / pixels_per_byte);
+    for (size_t i = 0; i < pixels.size(); i++) {
+        packed[i / pixels_per_byte] |= pixels[i] << ((i % pixels_per_byte) * bpp);
+    }
+    return packed;
+}
+
+// See docs/quantum_painter_rle.md
+inline std::vector<uint8_t> qp_test_compress_rle(const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> out;
+    size_t               i = 0;
+    while (i < data.size()) {
+        size_t run = 1;
+        while (i + run < data.size() && data[i + run] == data[i] && run < 127) {
+            run++;
+        }
+        if (run >= 3) {
+            out.push_back(run);
+            out.push_back(data[i]);
+            i += run;
+            continue;
+        }
+
+        size_t start = i;
+        while (i < data.size() && i - start < 128 && !(i + 2 < data.size() && data[i] == data[i + 1] && data[i] == data[i + 2])) {
+            i++;
+        }
+        out.push_back(127 + (i - start));
+        out.insert(out.end(), data.begin() + start, data.begin() + i);
+    }
+    return out;
+}
+
+// See docs/quantum_painter_lz.md, taking the longest match within the window, and the closest one of those
+inline std::vector<uint8_t> qp_test_compress_lz(const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> out;
+    std::vector<uint8_t> literals;
+    auto                 flush_literals = [&]() {
+        if (!literals.empty()) {
+            out.push_back(literals.size() - 1);
+            out.insert(out.end(), literals.begin(), literals.end());
+            literals.clear();
+        }
+    };
+
+    size_t i = 0;
+    while (i < data.size()) {
+        size_t best_length = 0, best_distance = 0;
+        for (size_t distance = 1; distance <= 256 && distance <= i; distance++) {
+            size_t length = 0;
+            // Matches may overlap the bytes being produced, which covers repeated runs
+            while (length < 130 && i + length < data.size() && data[i + length - distance] == data[i + length]) {
+                length++;
+            }
+            if (length > best_length) {
+                best_length   = length;
+                best_distance = distance;
+            }
+        }
+
+        if (best_length >= 3) {
+            flush_literals();
+            out.push_back(128 + best_length - 3);
+            out.push_back(best_distance - 1);
+            i += best_length;
+        } else {
+            literals.push_back(data[i++]);
+            if (literals.size() == 128) {
+                flush_literals();
+            }
+        }
+    }
+    flush_literals();
+    return out;
+}
+
+inline std::vector<uint8_t> qp_test_compress(const std::vector<uint8_t> &data, painter_compression_t compression) {
+    switch (compression) {
+        case IMAGE_COMPRESSED_RLE:
+            return qp_test_compress_rle(data);
+        case IMAGE_COMPRESSED_LZ:
+            return qp_test_compress_lz(data);
+        default:
+            return data;
+    }
+}
+
+inline void qp_test_put(std::vector<uint8_t> &out, uint32_t value, uint8_t bytes) {
+    for (uint8_t i = 0; i < bytes; i++) {
+        out.push_back((value >> (8 * i)) & 0xFF);
+    }
+}
+
+inline void qp_test_put_block_header(std::vector<uint8_t> &out, uint8_t type_id, uint32_t length) {
+    out.push_back(type_id);
+    out.push_back(~type_id);
+    qp_test_put(out, length, 3);
+}
+
+inline void qp_test_put_palette(std::vector<uint8_t> &out, const std::vector<QpTestPalette> &palette) {
+    qp_test_put_block_header(out, 0x03, palette.size() * 3);
+    for (auto &entry : palette) {
+        out.insert(out.end(), {entry.h, entry.s, entry.v});
+    }
+}
+
+inline void qp_test_put_total_size(std::vector<uint8_t> &out) {
+    // Both follow the block header, the magic and the version
+    for (uint8_t i = 0; i < 4; i++) {
+        out[9 + i]  = (out.size() >> (8 * i)) & 0xFF;
+        out[13 + i] = (~out.size() >> (8 * i)) & 0xFF;
+    }
+}
+
+// A single frame image, see docs/quantum_painter_qgf.md
+inline std::vector<uint8_t> qp_test_make_qgf(uint16_t width, uint16_t height, qp_image_format_t format, uint8_t bpp, const std::vector<QpTestPalette> &palette, const std::vector<uint8_t> &pixels, painter_compression_t compression) {
+    std::vector<uint8_t> data = qp_test_compress(qp_test_pack(pixels, bpp), compression);
+    std::vector<uint8_t> out;
+
+    qp_test_put_block_header(out, 0x00, 18);
+    qp_test_put(out, 0x464751, 3);
+    out.push_back(0x01);
+    qp_test_put(out, 0, 8); // total size, filled in below
+    qp_test_put(out, width, 2);
+    qp_test_put(out, height, 2);
+    qp_test_put(out, 1, 2);
+
+    qp_test_put_block_header(out, 0x01, 4);
+    qp_test_put(out, out.size() + 4, 4);
+
+    qp_test_put_block_header(out, 0x02, 6);
+    out.insert(out.end(), {(uint8_t)format, 0, (uint8_t)compression, 0});
+    qp_test_put(out, 0, 2);
+
+    if (!palette.empty()) {
+        qp_test_put_palette(out, palette);
+    }
+
+    qp_test_put_block_header(out, 0x05, data.size());
+    out.insert(out.end(), data.begin(), data.end());
+
+    qp_test_put_total_size(out);
+    return out;
+}
+
+struct QpTestGlyph {
+    char                 c;
+    uint8_t              width;
+    std::vector<uint8_t> pixels; // width * line height palette indices
+};
+
+// A font with an ASCII table, each glyph packed and compressed on its own, see docs/quantum_painter_qff.md
+inline std::vector<uint8_t> qp_test_make_qff(uint8_t line_height, qp_image_format_t format, uint8_t bpp, const std::vector<QpTestPalette> &palette, const std::vector<QpTestGlyph> &glyphs, painter_compression_t compression) {
+    std::vector<uint8_t>  data;
+    std::vector<uint32_t> ascii(95, 0);
+    for (auto &glyph : glyphs) {
+        ascii[glyph.c - 0x20] = glyph.width | (data.size() << 6);
+        auto packed           = qp_test_compress(qp_test_pack(glyph.pixels, bpp), compression);
+        data.insert(data.end(), packed.begin(), packed.end());
+    }
+
+    std::vector<uint8_t> out;
+    qp_test_put_block_header(out, 0x00, 20);
+    qp_test_put(out, 0x464651, 3);
+    out.push_back(0x01);
+    qp_test_put(out, 0, 8); // total size, filled in below
+    out.push_back(line_height);
+    out.push_back(1); // has an ASCII table
+    qp_test_put(out, 0, 2);
+    out.insert(out.end(), {(uint8_t)format, 0, (uint8_t)compression, 0});
+
+    qp_test_put_block_header(out, 0x01, 95 * 3);
+    for (uint32_t value : ascii) {
+        qp_test_put(out, value, 3);
+    }
+
+    if (!palette.empty()) {
+        qp_test_put_palette(out, palette);
+    }
+
+    qp_test_put_block_header(out, 0x04, data.size());
+    out.insert(out.end(), data.begin(), data.end());
+
+    qp_test_put_total_size(out);
+    return out;
+}
@@ -0,0 +1,166 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "qp_test_assets.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+}
+
+namespace {
+
+constexpr uint16_t SURFACE_WIDTH  = 64;
+constexpr uint16_t SURFACE_HEIGHT = 48;
+
+struct Format {
+    qp_image_format_t format;
+    uint8_t           bpp;
+};
+
+const Format PALETTE_FORMATS[] = {{PALETTE_1BPP, 1}, {PALETTE_2BPP, 2}, {PALETTE_4BPP, 4}, {PALETTE_8BPP, 8}};
+
+const painter_compression_t COMPRESSIONS[] = {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE, IMAGE_COMPRESSED_LZ};
+
+std::string describe(const Format &format, painter_compression_t compression) {
+    const char *names[] = {"raw", "rle", "lz"};
+    return std::to_string(format.bpp) + "bpp " + names[compression];
+}
+
+} // namespace
+
+/*
+ * Draws the same pixels through the decode pipeline onto one surface, and a
+ * pixel at a time with qp_setpixel() onto another, and compares the two.
+ */
+class QpDraw : public ::testing::Test {
+   protected:
+    static uint8_t          drawn[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_WIDTH, SURFACE_HEIGHT, 16)];
+    static uint8_t          expected[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_WIDTH, SURFACE_HEIGHT, 16)];
+    static painter_device_t drawn_surface;
+    static painter_device_t expected_surface;
+
+    // Surfaces can not be freed, both are made once for all of the tests
+    static void SetUpTestSuite() {
+        drawn_surface    = qp_make_rgb565_surface(SURFACE_WIDTH, SURFACE_HEIGHT, drawn);
+        expected_surface = qp_make_rgb565_surface(SURFACE_WIDTH, SURFACE_HEIGHT, expected);
+    }
+
+    void SetUp() override {
+        ASSERT_TRUE(qp_init(drawn_surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(expected_surface, QP_ROTATION_0));
+    }
+
+    void clear() {
+        memset(drawn, 0, sizeof(drawn));
+        memset(expected, 0, sizeof(expected));
+    }
+
+    void expect_pixels(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const std::vector<QpTestPalette> &palette, const std::vector<uint8_t> &pixels) {
+        for (uint16_t row = 0; row < height; row++) {
+            for (uint16_t col = 0; col < width; col++) {
+                auto &color = palette[pixels[row * width + col]];
+                qp_setpixel(expected_surface, x + col, y + row, color.h, color.s, color.v);
+            }
+        }
+    }
+};
+
+uint8_t          QpDraw::drawn[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_WIDTH, SURFACE_HEIGHT, 16)];
+uint8_t          QpDraw::expected[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_WIDTH, SURFACE_HEIGHT, 16)];
+painter_device_t QpDraw::drawn_surface;
+painter_device_t QpDraw::expected_surface;
+
+TEST_F(QpDraw, Images) {
+    // Odd sizes, so that neither rows nor blocks line up with bytes
+    const uint16_t width = 37, height = 23;
+
+    for (auto &format : PALETTE_FORMATS) {
+        auto palette = qp_test_palette(format.bpp);
+        auto pixels  = qp_test_pixels(width * height, format.bpp, format.bpp);
+        for (auto compression : COMPRESSIONS) {
+            SCOPED_TRACE(describe(format, compression));
+            clear();
+            auto image = qp_test_make_qgf(width, height, format.format, format.bpp, palette, pixels, compression);
+
+            painter_image_handle_t handle = qp_load_image_mem(image.data());
+            ASSERT_NE(handle, nullptr);
+            EXPECT_TRUE(qp_drawimage(drawn_surface, 3, 5, handle));
+            qp_close_image(handle);
+
+            expect_pixels(3, 5, width, height, palette, pixels);
+            EXPECT_EQ(0, memcmp(drawn, expected, sizeof(drawn)));
+        }
+    }
+}
+
+TEST_F(QpDraw, Text) {
+    const uint8_t line_height = 11;
+
+    for (auto &format : PALETTE_FORMATS) {
+        auto                     palette = qp_test_palette(format.bpp);
+        std::vector<QpTestGlyph> glyphs;
+        for (char c : std::string("Hi!")) {
+            uint8_t glyph_width = 3 + c % 7;
+            glyphs.push_back({c, glyph_width, qp_test_pixels(glyph_width * line_height, format.bpp, c)});
+        }
+        for (auto compression : COMPRESSIONS) {
+            SCOPED_TRACE(describe(format, compression));
+            clear();
+            auto font = qp_test_make_qff(line_height, format.format, format.bpp, palette, glyphs, compression);
+
+            painter_font_handle_t handle = qp_load_font_mem(font.data());
+            ASSERT_NE(handle, nullptr);
+            uint16_t x = 2;
+            EXPECT_EQ(qp_drawtext(drawn_surface, x, 7, handle, "i!Hi"), 2 * glyphs[1].width + glyphs[2].width + glyphs[0].width);
+            qp_close_font(handle);
+
+            for (char c : std::string("i!Hi")) {
+                for (auto &glyph : glyphs) {
+                    if (glyph.c == c) {
+                        expect_pixels(x, 7, glyph.width, line_height, palette, glyph.pixels);
+                        x += glyph.width;
+                    }
+                }
+            }
+            EXPECT_EQ(0, memcmp(drawn, expected, sizeof(drawn)));
+        }
+    }
+}
+
+// Data that only LZ handles specially: one long run, noise, and a pattern repeating at the far end of the window
+TEST_F(QpDraw, LzMatchesRaw) {
+    const uint16_t width = 61, height = 29;
+    auto           palette = qp_test_palette(8);
+
+    std::vector<std::vector<uint8_t>> samples(3, std::vector<uint8_t>(width * height, 7));
+    uint32_t                          seed = 1;
+    for (size_t i = 0; i < samples[1].size(); i++) {
+        seed          = seed * 1103515245 + 12345;
+        samples[1][i] = seed >> 24;
+        samples[2][i] = i % 256 < 200 ? samples[1][i % 256] : i;
+    }
+
+    for (auto &pixels : samples) {
+        clear();
+        auto raw = qp_test_make_qgf(width, height, PALETTE_8BPP, 8, palette, pixels, IMAGE_UNCOMPRESSED);
+        auto lz  = qp_test_make_qgf(width, height, PALETTE_8BPP, 8, palette, pixels, IMAGE_COMPRESSED_LZ);
+
+        painter_image_handle_t handle = qp_load_image_mem(raw.data());
+        ASSERT_NE(handle, nullptr);
+        EXPECT_TRUE(qp_drawimage(expected_surface, 1, 2, handle));
+        qp_close_image(handle);
+
+        handle = qp_load_image_mem(lz.data());
+        ASSERT_NE(handle, nullptr);
+        EXPECT_TRUE(qp_drawimage(drawn_surface, 1, 2, handle));
+        qp_close_image(handle);
+
+        EXPECT_EQ(0, memcmp(drawn, expected, sizeof(drawn)));
+    }
+}
@@ -0,0 +1,32 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+}
+
+// The value is scaled before the curve is applied, as with hsv_to_rgb() on the scaled color
+TEST(HsvToRgbBatchCie1931, MatchesHsvToRgb) {
+    std::vector<hsv_t> hsv(256);
+    std::vector<rgb_t> rgb(256);
+
+    for (uint8_t brightness : {127, 255}) {
+        for (int h = 0; h < 256; h++) {
+            for (int s = 0; s < 256; s++) {
+                for (int v = 0; v < 256; v++) {
+                    hsv[v] = {(uint8_t)h, (uint8_t)s, (uint8_t)v};
+                }
+                hsv_to_rgb_batch(hsv.data(), rgb.data(), 255, brightness);
+                hsv_to_rgb_batch(&hsv[255], &rgb[255], 1, brightness);
+
+                for (int v = 0; v < 256; v++) {
+                    rgb_t expected = hsv_to_rgb({(uint8_t)h, (uint8_t)s, (uint8_t)((v * (brightness + 1)) >> 8)});
+                    ASSERT_TRUE(rgb[v].r == expected.r && rgb[v].g == expected.g && rgb[v].b == expected.b) << "hsv " << h << "," << s << "," << v << " at brightness " << (int)brightness;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,55 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+
+// clang-format off
+led_config_t g_led_config = { {
+    {      0,      1,      2,      3,      4,      5,      6,      7,      8,      9 },
+    { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+    { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+    { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED }
+}, {
+    { 0, 32 }, { 24, 32 }, { 49, 32 }, { 74, 32 }, { 99, 32 }, { 124, 32 }, { 149, 32 }, { 174, 32 }, { 199, 32 }, { 224, 32 }
+}, {
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4
+} };
+// clang-format on
+
+// Keeps what the LEDs show, and how often they were written to
+rgb_t    test_leds[RGB_MATRIX_LED_COUNT];
+uint32_t test_set_color_count;
+uint32_t test_flush_count;
+
+static void init(void) {}
+
+static void set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    test_leds[index] = (rgb_t){.r = r, .g = g, .b = b};
+    test_set_color_count++;
+}
+
+static void set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        set_color(i, r, g, b);
+    }
+}
+
+static void flush(void) {
+    test_flush_count++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = init,
+    .set_color     = set_color,
+    .set_color_all = set_color_all,
+    .flush         = flush,
+};
+
+bool test_indicator = false;
+
+bool rgb_matrix_indicators_user(void) {
+    if (test_indicator) {
+        rgb_matrix_set_color(0, 0, 0, 255);
+    }
+    return true;
+}
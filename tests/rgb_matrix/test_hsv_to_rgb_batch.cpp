@@ -0,0 +1,59 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+}
+
+namespace {
+
+// Converts every color, one value of hue and saturation at a time
+void expect_same_as_hsv_to_rgb(uint8_t brightness) {
+    std::vector<hsv_t> hsv(256);
+    std::vector<rgb_t> rgb(256);
+
+    for (int h = 0; h < 256; h++) {
+        for (int s = 0; s < 256; s++) {
+            for (int v = 0; v < 256; v++) {
+                hsv[v] = {(uint8_t)h, (uint8_t)s, (uint8_t)v};
+            }
+            // Not a multiple of the batch size of the runners, nor of any vector width
+            hsv_to_rgb_batch(hsv.data(), rgb.data(), 255, brightness);
+            hsv_to_rgb_batch(&hsv[255], &rgb[255], 1, brightness);
+
+            for (int v = 0; v < 256; v++) {
+                hsv_t scaled = {(uint8_t)h, (uint8_t)s, (uint8_t)((v * (brightness + 1)) >> 8)};
+                rgb_t expected = hsv_to_rgb(scaled);
+                if (rgb[v].r != expected.r || rgb[v].g != expected.g || rgb[v].b != expected.b) {
+                    FAIL() << "hsv " << h << "," << s << "," << v << " at brightness " << (int)brightness << ": got " << (int)rgb[v].r << "," << (int)rgb[v].g << "," << (int)rgb[v].b << ", expected " << (int)expected.r << "," << (int)expected.g << "," << (int)expected.b;
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST(HsvToRgbBatch, MatchesHsvToRgb) {
+    expect_same_as_hsv_to_rgb(255);
+}
+
+TEST(HsvToRgbBatch, ScalesBrightness) {
+    expect_same_as_hsv_to_rgb(0);
+    expect_same_as_hsv_to_rgb(127);
+    expect_same_as_hsv_to_rgb(200);
+}
+
+TEST(HsvToRgbBatch, ConvertsNothing) {
+    hsv_t hsv = {HSV_RED};
+    rgb_t rgb = {1, 2, 3};
+
+    hsv_to_rgb_batch(&hsv, &rgb, 0, 255);
+
+    EXPECT_EQ(rgb.r, 1);
+    EXPECT_EQ(rgb.g, 2);
+    EXPECT_EQ(rgb.b, 3);
+}
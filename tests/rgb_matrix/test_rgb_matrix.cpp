@@ -0,0 +1,152 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+
+extern rgb_t    test_leds[RGB_MATRIX_LED_COUNT];
+extern uint32_t test_set_color_count;
+extern uint32_t test_flush_count;
+extern bool     test_indicator;
+}
+
+namespace {
+bool halve_value = false;
+}
+
+// A keyboard limiting the brightness, without overriding rgb_matrix_hsv_to_rgb_batch()
+extern "C" rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
+    if (halve_value) {
+        hsv.v /= 2;
+    }
+    return hsv_to_rgb(hsv);
+}
+
+class RgbMatrix : public TestFixture {
+   protected:
+    void SetUp() override {
+        TestDriver driver;
+        test_indicator = false;
+        halve_value    = false;
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(HSV_GREEN);
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+        idle_for(100);
+        reset_counts();
+    }
+
+    void reset_counts() {
+        test_set_color_count = 0;
+        test_flush_count     = 0;
+    }
+
+    void expect_leds(rgb_t expected, uint8_t from = 0) {
+        for (uint8_t i = from; i < RGB_MATRIX_LED_COUNT; i++) {
+            EXPECT_EQ(test_leds[i].r, expected.r) << "LED " << (int)i;
+            EXPECT_EQ(test_leds[i].g, expected.g) << "LED " << (int)i;
+            EXPECT_EQ(test_leds[i].b, expected.b) << "LED " << (int)i;
+        }
+    }
+};
+
+TEST_F(RgbMatrix, SkipsStaticFrames) {
+    TestDriver driver;
+
+    idle_for(500);
+
+    EXPECT_EQ(test_set_color_count, 0u);
+    EXPECT_EQ(test_flush_count, 0u);
+    expect_leds(hsv_to_rgb((hsv_t){HSV_GREEN}));
+}
+
+TEST_F(RgbMatrix, RedrawsOnConfigChange) {
+    TestDriver driver;
+
+    rgb_matrix_sethsv_noeeprom(HSV_RED);
+    idle_for(100);
+
+    EXPECT_GE(test_set_color_count, (uint32_t)RGB_MATRIX_LED_COUNT);
+    EXPECT_GE(test_flush_count, 1u);
+    expect_leds(hsv_to_rgb((hsv_t){HSV_RED}));
+
+    reset_counts();
+    idle_for(500);
+    EXPECT_EQ(test_set_color_count, 0u);
+    EXPECT_EQ(test_flush_count, 0u);
+}
+
+TEST_F(RgbMatrix, RestoresEffectUnderIndicators) {
+    TestDriver driver;
+    rgb_t      green = hsv_to_rgb((hsv_t){HSV_GREEN});
+
+    test_indicator = true;
+    idle_for(100);
+    EXPECT_EQ(test_leds[0].b, 255);
+    EXPECT_EQ(test_leds[0].g, 0);
+    expect_leds(green, 1);
+
+    // The effect is drawn again once the indicator stops setting the LED
+    test_indicator = false;
+    idle_for(100);
+    expect_leds(green);
+
+    reset_counts();
+    idle_for(500);
+    EXPECT_EQ(test_set_color_count, 0u);
+    EXPECT_EQ(test_flush_count, 0u);
+}
+
+TEST_F(RgbMatrix, RedrawsReactiveEffectsUntilHitsAreForgotten) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+    idle_for(100);
+    reset_counts();
+    idle_for(500);
+    EXPECT_EQ(test_flush_count, 0u);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    idle_for(500);
+    EXPECT_GE(test_flush_count, 10u);
+
+    // Hits are kept for up to UINT16_MAX ms
+    idle_for(UINT16_MAX);
+    reset_counts();
+    idle_for(500);
+    EXPECT_EQ(test_set_color_count, 0u);
+    EXPECT_EQ(test_flush_count, 0u);
+}
+
+TEST_F(RgbMatrix, RedrawsAnimatedEffects) {
+    TestDriver driver;
+
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_BREATHING);
+    idle_for(500);
+
+    EXPECT_GE(test_flush_count, 10u);
+    EXPECT_GE(test_set_color_count, 10u * RGB_MATRIX_LED_COUNT);
+}
+
+TEST_F(RgbMatrix, BatchesGoThroughHsvToRgb) {
+    halve_value = true;
+
+    rgb_matrix_hsv_batch_t batch = {0};
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_matrix_hsv_batch_add(&batch, i, (hsv_t){(uint8_t)(i * 25), 255, 255});
+    }
+    rgb_matrix_hsv_batch_flush(&batch);
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_t expected = hsv_to_rgb((hsv_t){(uint8_t)(i * 25), 255, 127});
+        EXPECT_EQ(test_leds[i].r, expected.r) << "LED " << (int)i;
+        EXPECT_EQ(test_leds[i].g, expected.g) << "LED " << (int)i;
+        EXPECT_EQ(test_leds[i].b, expected.b) << "LED " << (int)i;
+    }
+}
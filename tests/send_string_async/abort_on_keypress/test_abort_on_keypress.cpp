@@ -0,0 +1,49 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class SendStringAsyncAbortOnKeypress : public TestFixture {
+   public:
+    void SetUp() override {
+        send_string_async_abort();
+    }
+};
+
+TEST_F(SendStringAsyncAbortOnKeypress, KeypressAbortsAndReleasesHeldKeys) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_z = KeymapKey(0, 0, 0, KC_Z);
+    set_keymap({key_z});
+
+    SEND_STRING_ASYNC(SS_DOWN(X_LCTL) "AAAAAAAA");
+    SEND_STRING_ASYNC("queued");
+
+    // ctrl, then shift and a
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_LEFT_SHIFT, KC_A));
+    idle_for(4);
+    VERIFY_AND_CLEAR(driver);
+
+    // everything the macro held is released before the key goes through
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_Z));
+    key_z.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_FALSE(send_string_async_is_active());
+
+    // neither the rest of the string, nor the queued one are typed
+    EXPECT_EMPTY_REPORT(driver);
+    key_z.release();
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,160 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class SendStringAsync : public TestFixture {
+   public:
+    void SetUp() override {
+        send_string_async_abort();
+    }
+};
+
+TEST_F(SendStringAsync, ReturnsWithoutTyping) {
+    TestDriver driver;
+
+    uint32_t start = timer_read32();
+    EXPECT_NO_REPORT(driver);
+    EXPECT_TRUE(send_string_async_with_delay("hello world", 20));
+    EXPECT_EQ(timer_read32(), start);
+    EXPECT_TRUE(send_string_async_is_active());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(22);
+    idle_for(22 * 20 + 5);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_FALSE(send_string_async_is_active());
+}
+
+TEST_F(SendStringAsync, OneKeyChangePerStep) {
+    TestDriver driver;
+
+    SEND_STRING_ASYNC("aB");
+
+    // nothing is sent from within the call itself
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_B));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_FALSE(send_string_async_is_active());
+}
+
+TEST_F(SendStringAsync, IntervalSpacesKeyChanges) {
+    TestDriver driver;
+
+    send_string_async_with_delay("x", 30);
+    idle_for(1);
+
+    EXPECT_REPORT(driver, (KC_X));
+    idle_for(1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(29);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, DelayKeepsScanning) {
+    TestDriver driver;
+    auto       key_z = KeymapKey(0, 0, 0, KC_Z);
+    set_keymap({key_z});
+
+    SEND_STRING_ASYNC(SS_TAP(X_A) SS_DELAY(100) SS_TAP(X_B));
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(3);
+    VERIFY_AND_CLEAR(driver);
+
+    // well within the delay, the matrix is still being scanned
+    EXPECT_REPORT(driver, (KC_Z));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_z);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(90);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, StringsAreQueuedInOrder) {
+    TestDriver driver;
+    InSequence s;
+
+    char buffer[] = "a";
+    EXPECT_TRUE(send_string_async_with_delay(buffer, 0));
+    EXPECT_TRUE(SEND_STRING_ASYNC("b"));
+    EXPECT_TRUE(send_string_async_with_delay(buffer, 0));
+    // the RAM copy is taken when queueing
+    buffer[0] = 'c';
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, RejectsWhatDoesNotFit) {
+    TestDriver driver;
+
+    char long_string[SEND_STRING_ASYNC_BUFFER_SIZE + 1];
+    memset(long_string, 'a', sizeof(long_string) - 1);
+    long_string[sizeof(long_string) - 1] = 0;
+
+    EXPECT_NO_REPORT(driver);
+    EXPECT_FALSE(send_string_async(long_string));
+    EXPECT_FALSE(send_string_async_is_active());
+
+    for (int i = 0; i < SEND_STRING_ASYNC_QUEUE_SIZE - 1; i++) {
+        EXPECT_TRUE(SEND_STRING_ASYNC(""));
+    }
+    EXPECT_FALSE(SEND_STRING_ASYNC(""));
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_FALSE(send_string_async_is_active());
+}
@@ -317,6 +317,28 @@ TEST_F(TapDance, QuadFunction) {
     run_one_scan_loop();
 }
 
+TEST_F(TapDance, TimeoutRestartsOnEachTap) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_quad = KeymapKey{0, 1, 0, TD(X_CTL)};
+
+    set_keymap({key_quad});
+
+    /* A second tap just before the timeout keeps the dance going */
+    tap_key(key_quad);
+    EXPECT_NO_REPORT(driver);
+    idle_for(TAPPING_TERM - 10);
+    tap_key(key_quad);
+    idle_for(TAPPING_TERM - 10);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    /* It times out relative to the last tap */
+    EXPECT_REPORT(driver, (KC_ESC));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(10);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
 TEST_F(TapDance, DanceFnAdvancedWithRelease) {
     TestDriver driver;
     InSequence s;
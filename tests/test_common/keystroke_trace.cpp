@@ -0,0 +1,132 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keystroke_trace.hpp"
+#include <fstream>
+#include "test_matrix.h"
+#include "timer.h"
+
+extern "C" {
+#include "host.h"
+#include "keystroke_trace/keystroke_trace.h"
+}
+
+KeystrokeTrace decode_keystroke_trace(const std::vector<uint8_t>& data) {
+    KeystrokeTrace trace;
+    uint64_t       time  = 0;
+    bool           first = true;
+    size_t         i     = 0;
+
+    while (i < data.size()) {
+        uint64_t value = 0;
+        unsigned shift = 0;
+        while (i < data.size()) {
+            uint8_t byte = data[i++];
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            shift += 7;
+            if (!(byte & 0x80)) {
+                break;
+            }
+        }
+        if (i + 2 > data.size()) {
+            // Cut off in the middle of an event
+            trace.lost = true;
+            break;
+        }
+
+        uint8_t row = data[i++];
+        uint8_t col = data[i++];
+        time += first ? 0 : value >> 1;
+        first = false;
+
+        if (row == KEYSTROKE_TRACE_LOST && col == KEYSTROKE_TRACE_LOST) {
+            trace.lost = true;
+            continue;
+        }
+        trace.events.push_back({(uint32_t)time, {.col = col, .row = row}, (value & 1) != 0});
+    }
+
+    return trace;
+}
+
+KeystrokeTrace read_keystroke_trace(std::istream& log) {
+    std::vector<uint8_t> data;
+    std::string          line;
+
+    while (std::getline(log, line)) {
+        size_t start = line.find("kt:");
+        if (start == std::string::npos) {
+            continue;
+        }
+        for (size_t i = start + 3; i + 1 < line.size() && isxdigit(line[i]) && isxdigit(line[i + 1]); i += 2) {
+            data.push_back(std::stoi(line.substr(i, 2), nullptr, 16));
+        }
+    }
+
+    return decode_keystroke_trace(data);
+}
+
+KeystrokeTrace load_keystroke_trace(const std::string& path) {
+    std::ifstream log(path);
+    EXPECT_TRUE(log.is_open()) << "could not open " << path;
+    return read_keystroke_trace(log);
+}
+
+void replay_keystroke_trace(TestFixture& fixture, const KeystrokeTrace& trace, unsigned settle_ms) {
+    uint32_t start = timer_read32();
+
+    for (size_t i = 0; i < trace.events.size();) {
+        uint32_t elapsed = timer_read32() - start;
+        uint32_t time    = trace.events[i].time_ms;
+        if (time > elapsed) {
+            fixture.idle_for(time - elapsed);
+        }
+
+        // Everything recorded within the same millisecond is found by the same scan, unless a key changes twice
+        std::vector<keypos_t> changed;
+        for (; i < trace.events.size() && trace.events[i].time_ms == time; i++) {
+            const KeystrokeEvent& event = trace.events[i];
+            for (auto& position : changed) {
+                if (position.row == event.position.row && position.col == event.position.col) {
+                    fixture.run_one_scan_loop();
+                    changed.clear();
+                    break;
+                }
+            }
+
+            if (event.pressed) {
+                press_key(event.position.col, event.position.row);
+            } else {
+                release_key(event.position.col, event.position.row);
+            }
+            changed.push_back(event.position);
+        }
+    }
+
+    fixture.idle_for(settle_ms);
+}
+
+ReportRecorder* ReportRecorder::m_this = nullptr;
+
+ReportRecorder::ReportRecorder() : m_driver{&ReportRecorder::keyboard_leds, &ReportRecorder::send_keyboard, &ReportRecorder::send_nkro, &ReportRecorder::send_mouse, &ReportRecorder::send_extra} {
+    host_set_driver(&m_driver);
+    m_this = this;
+}
+
+ReportRecorder::~ReportRecorder() {
+    m_this = nullptr;
+}
+
+uint8_t ReportRecorder::keyboard_leds(void) {
+    return 0;
+}
+
+void ReportRecorder::send_keyboard(report_keyboard_t* report) {
+    m_this->reports.push_back({timer_read32(), *report});
+}
+
+void ReportRecorder::send_nkro(report_nkro_t* report) {}
+
+void ReportRecorder::send_mouse(report_mouse_t* report) {}
+
+void ReportRecorder::send_extra(report_extra_t* report) {}
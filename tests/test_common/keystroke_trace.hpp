@@ -0,0 +1,79 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "host.h"
+#include "report.h"
+}
+
+/* Replays typing sessions recorded with KEYSTROKE_TRACE_ENABLE, see quantum/keystroke_trace/keystroke_trace.h.
+ *
+ *   KeystrokeTrace trace = load_keystroke_trace("session.log");
+ *   ReportRecorder recorder;
+ *   replay_keystroke_trace(*this, trace);
+ *
+ * after which `recorder.reports` holds every keyboard report the keymap of the fixture sent, and when. */
+
+struct KeystrokeEvent {
+    uint32_t time_ms;
+    keypos_t position;
+    bool     pressed;
+};
+
+struct KeystrokeTrace {
+    std::vector<KeystrokeEvent> events;
+    /* Events were dropped by the keyboard, so the trace does not match what was typed. */
+    bool lost = false;
+};
+
+/**
+ * @brief Decodes the bytes of a recording, with times relative to the first event.
+ */
+KeystrokeTrace decode_keystroke_trace(const std::vector<uint8_t>& data);
+
+/**
+ * @brief Decodes the "kt:" lines of a console log, skipping anything else.
+ */
+KeystrokeTrace read_keystroke_trace(std::istream& log);
+KeystrokeTrace load_keystroke_trace(const std::string& path);
+
+/**
+ * @brief Plays back the events at their recorded times, then idles for `settle_ms`.
+ *
+ * The keys are pressed and released in the test matrix, so each event reaches action_exec() from
+ * the same matrix scan as on the keyboard, with keyboard_task() running every millisecond in between.
+ */
+void replay_keystroke_trace(TestFixture& fixture, const KeystrokeTrace& trace, unsigned settle_ms = 1000);
+
+/**
+ * @brief A host driver keeping every keyboard report, with the time it was sent at.
+ */
+class ReportRecorder {
+   public:
+    struct Report {
+        uint32_t          time_ms;
+        report_keyboard_t report;
+    };
+
+    ReportRecorder();
+    ~ReportRecorder();
+
+    std::vector<Report> reports;
+
+   private:
+    static uint8_t         keyboard_leds(void);
+    static void            send_keyboard(report_keyboard_t* report);
+    static void            send_nkro(report_nkro_t* report);
+    static void            send_mouse(report_mouse_t* report);
+    static void            send_extra(report_extra_t* report);
+    host_driver_t          m_driver;
+    static ReportRecorder* m_this;
+};
@@ -0,0 +1,209 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "via.h"
+#include "dynamic_keymap.h"
+#include "raw_hid.h"
+}
+
+namespace {
+
+constexpr uint8_t  PACKET_SIZE  = 32;
+constexpr uint8_t  PAYLOAD_SIZE = PACKET_SIZE - 4;
+constexpr uint16_t KEYMAP_SIZE  = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+
+std::vector<std::vector<uint8_t>> replies;
+
+// Reference encoder, as a host would implement it
+std::vector<std::vector<uint8_t>> encode(const std::vector<uint8_t> &data) {
+    std::vector<std::vector<uint8_t>> payloads(1);
+    size_t                            i = 0;
+    while (i < data.size()) {
+        std::vector<uint8_t> chunk;
+        size_t               zeros = 0;
+        while (i + zeros < data.size() && data[i + zeros] == 0 && zeros < 64) {
+            zeros++;
+        }
+        size_t words = 0;
+        bool   first = payloads.back().empty();
+        while (!first && i >= 2 && i + 2 * words + 1 < data.size() && data[i + 2 * words] == data[i - 2] && data[i + 2 * words + 1] == data[i - 1] && words < 64) {
+            words++;
+        }
+        if (words >= 1 && words * 2 >= zeros) {
+            chunk = {(uint8_t)(0xC0 | (words - 1))};
+            i += words * 2;
+        } else if (zeros >= 2) {
+            chunk = {(uint8_t)(0x80 | (zeros - 1))};
+            i += zeros;
+        } else {
+            // Two literal bytes at a time, so a following repeat has its pattern within the payload
+            size_t count = std::min<size_t>(2, data.size() - i);
+            chunk        = {(uint8_t)(count - 1)};
+            chunk.insert(chunk.end(), data.begin() + i, data.begin() + i + count);
+            i += count;
+        }
+        if (payloads.back().size() + chunk.size() > PAYLOAD_SIZE) {
+            // Repeats only refer to bytes in the same payload, so start the new one with the bytes themselves
+            i -= (chunk[0] >= 0xC0) ? ((chunk[0] & 0x3F) + 1) * 2 : (chunk[0] >= 0x80 ? (chunk[0] & 0x3F) + 1 : chunk[0] + 1);
+            payloads.emplace_back();
+            continue;
+        }
+        payloads.back().insert(payloads.back().end(), chunk.begin(), chunk.end());
+    }
+    return payloads;
+}
+
+} // namespace
+
+extern "C" void raw_hid_send(uint8_t *data, uint8_t length) {
+    replies.emplace_back(data, data + length);
+}
+
+class ViaBulkTransfer : public TestFixture {
+   protected:
+    void SetUp() override {
+        replies.clear();
+        dynamic_keymap_reset();
+    }
+
+    std::vector<uint8_t> command(std::vector<uint8_t> bytes) {
+        bytes.resize(PACKET_SIZE);
+        raw_hid_receive(bytes.data(), PACKET_SIZE);
+        return replies.empty() ? std::vector<uint8_t>{} : replies.back();
+    }
+
+    std::vector<uint8_t> start(uint8_t target, uint16_t offset, uint16_t size) {
+        return command({id_bulk_transfer, id_bulk_transfer_start, target, (uint8_t)(offset >> 8), (uint8_t)offset, (uint8_t)(size >> 8), (uint8_t)size});
+    }
+
+    void send_data(uint8_t sequence, const std::vector<uint8_t> &payload) {
+        std::vector<uint8_t> packet = {id_bulk_transfer, id_bulk_transfer_data, sequence, (uint8_t)payload.size()};
+        packet.insert(packet.end(), payload.begin(), payload.end());
+        command(packet);
+    }
+
+    // Sends the whole transfer, returning the number of times the host waits for the keyboard
+    size_t transfer(uint8_t target, const std::vector<uint8_t> &data) {
+        auto payloads = encode(data);
+        auto reply    = start(target, 0, data.size());
+        EXPECT_EQ(reply[2], id_bulk_transfer_ok);
+        size_t round_trips = 1;
+
+        uint8_t window = reply[3];
+        size_t  next   = 0;
+        while (next < payloads.size()) {
+            replies.clear();
+            size_t end = std::min(next + window, payloads.size());
+            for (size_t seq = next; seq < end; seq++) {
+                send_data(seq, payloads[seq]);
+            }
+            round_trips++;
+            EXPECT_EQ(replies.size(), 1u);
+            EXPECT_EQ(replies.back()[2], id_bulk_transfer_ok);
+            next = replies.back()[3];
+        }
+
+        reply = command({id_bulk_transfer, id_bulk_transfer_commit});
+        EXPECT_EQ(reply[2], id_bulk_transfer_ok);
+        return round_trips + 1;
+    }
+};
+
+std::vector<uint8_t> test_keymap() {
+    std::vector<uint8_t> keymap;
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t key = 0; key < MATRIX_ROWS * MATRIX_COLS; key++) {
+            uint16_t keycode = KC_TRNS;
+            if (layer == 0) {
+                keycode = KC_A + key;
+            } else if (layer == 1 && key % 7 == 0) {
+                keycode = LCTL(KC_F1 + key % 12);
+            } else if (layer == DYNAMIC_KEYMAP_LAYER_COUNT - 1) {
+                keycode = KC_NO;
+            }
+            keymap.push_back(keycode >> 8);
+            keymap.push_back(keycode & 0xFF);
+        }
+    }
+    return keymap;
+}
+
+TEST_F(ViaBulkTransfer, KeymapRoundTrip) {
+    auto   keymap      = test_keymap();
+    size_t round_trips = transfer(id_bulk_transfer_keymap, keymap);
+
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                size_t i = ((layer * MATRIX_ROWS + row) * MATRIX_COLS + col) * 2;
+                EXPECT_EQ(dynamic_keymap_get_keycode(layer, row, col), (keymap[i] << 8) | keymap[i + 1]);
+            }
+        }
+    }
+
+    // id_dynamic_keymap_set_buffer takes one round trip per 28 bytes, at least four times as many
+    EXPECT_LE(round_trips * 4, (KEYMAP_SIZE + 27) / 28);
+}
+
+TEST_F(ViaBulkTransfer, NothingIsWrittenBeforeCommit) {
+    auto     keymap   = test_keymap();
+    auto     payloads = encode(keymap);
+    uint16_t keycode  = dynamic_keymap_get_keycode(0, 0, 0);
+    start(id_bulk_transfer_keymap, 0, keymap.size());
+    for (size_t seq = 0; seq < payloads.size(); seq++) {
+        send_data(seq, payloads[seq]);
+    }
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), keycode);
+}
+
+TEST_F(ViaBulkTransfer, MissedPacketIsResent) {
+    auto     keymap   = test_keymap();
+    auto     payloads = encode(keymap);
+    uint16_t keycode  = dynamic_keymap_get_keycode(0, 0, 0);
+    ASSERT_GT(payloads.size(), 3u);
+    start(id_bulk_transfer_keymap, 0, keymap.size());
+
+    // Packet 1 goes missing, the keyboard asks for it straight away
+    replies.clear();
+    send_data(0, payloads[0]);
+    send_data(2, payloads[2]);
+    ASSERT_EQ(replies.size(), 1u);
+    EXPECT_EQ(replies.back()[2], id_bulk_transfer_sequence_error);
+    EXPECT_EQ(replies.back()[3], 1);
+
+    // A commit now would write half a keymap
+    EXPECT_EQ(command({id_bulk_transfer, id_bulk_transfer_commit})[2], id_bulk_transfer_incomplete);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), keycode);
+}
+
+TEST_F(ViaBulkTransfer, MacroRoundTrip) {
+    const char           macros[] = "hello\0world\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0!";
+    std::vector<uint8_t> data(macros, macros + sizeof(macros));
+    transfer(id_bulk_transfer_macros, data);
+
+    std::vector<uint8_t> stored(data.size());
+    dynamic_keymap_macro_get_buffer(0, stored.size(), stored.data());
+    EXPECT_EQ(stored, data);
+}
+
+TEST_F(ViaBulkTransfer, RejectsMalformedTransfers) {
+    EXPECT_EQ(start(id_bulk_transfer_keymap, 0, VIA_BULK_TRANSFER_BUFFER_SIZE + 1)[2], id_bulk_transfer_invalid);
+    EXPECT_EQ(start(0x42, 0, 16)[2], id_bulk_transfer_invalid);
+
+    // Decodes to more than the 4 bytes announced
+    start(id_bulk_transfer_keymap, 0, 4);
+    replies.clear();
+    send_data(0, {0x80 | 7});
+    ASSERT_EQ(replies.size(), 1u);
+    EXPECT_EQ(replies.back()[2], id_bulk_transfer_invalid);
+
+    // A repeat needs two bytes to repeat
+    send_data(0, {0xC0, 0x00});
+    EXPECT_EQ(replies.back()[2], id_bulk_transfer_invalid);
+}
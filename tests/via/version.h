@@ -0,0 +1,7 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Test builds do not generate version.h, VIA only needs the build date for its EEPROM magic
+#define QMK_BUILDDATE "2026-01-01-00:00:00"
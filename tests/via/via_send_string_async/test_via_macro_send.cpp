@@ -0,0 +1,69 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "send_string_async.h"
+#include "raw_hid.h"
+}
+
+// No host on the other end
+extern "C" void raw_hid_send(uint8_t *data, uint8_t length) {}
+
+using testing::_;
+using testing::InSequence;
+
+class ViaMacroSend : public TestFixture {
+   protected:
+    void TearDown() override {
+        send_string_async_abort();
+    }
+};
+
+TEST_F(ViaMacroSend, IsQueued) {
+    TestDriver driver;
+    InSequence s;
+    uint8_t    macros[] = "a";
+    dynamic_keymap_macro_set_buffer(0, sizeof(macros), macros);
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(0);
+    EXPECT_TRUE(send_string_async_is_active());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ViaMacroSend, IsDroppedWhenTheQueueIsFull) {
+    TestDriver driver;
+    InSequence s;
+    uint8_t    macros[] = "a";
+    dynamic_keymap_macro_set_buffer(0, sizeof(macros), macros);
+
+    // Holding shift down, which the macro must not be typed under
+    send_string_async(SS_DOWN(X_LSFT));
+    int queued = 0;
+    while (send_string_async("z")) {
+        queued++;
+    }
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(0);
+    VERIFY_AND_CLEAR(driver);
+
+    // Only the queued strings are typed
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    for (int i = 0; i < queued; i++) {
+        EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_Z));
+        EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    }
+    idle_for(100);
+    EXPECT_FALSE(send_string_async_is_active());
+    VERIFY_AND_CLEAR(driver);
+}
@@ -12,6 +12,10 @@
 #include "usb_driver.h"
 #include "util.h"
 
+#if defined(POLL_GOVERNOR_ENABLE)
+#    include "usb_main.h"
+#endif
+
 /*===========================================================================*/
 /* Driver local functions.                                                   */
 /*===========================================================================*/
@@ -197,6 +201,13 @@ void usb_endpoint_in_tx_complete_cb(USBDriver *usbp, usbep_t ep) {
     /* Sending succeded, so we can reset the timed out state. */
     endpoint->timed_out = false;
 
+#if defined(POLL_GOVERNOR_ENABLE)
+    /* A report was just picked up, which marks the time of the host's poll. */
+    if (usbp->epc[ep]->in_state->txsize > 0U) {
+        usb_poll_governor_in_cb(endpoint);
+    }
+#endif
+
     /* Freeing the buffer just transmitted, if it was not a zero size packet.*/
     if (!obqIsEmptyI(&endpoint->obqueue) && usbp->epc[ep]->in_state->txsize > 0U) {
         /* Store the last send report in the endpoint to be retrieved by a
@@ -31,6 +31,7 @@
 #include "usb_descriptor.h"
 #include "usb_driver.h"
 #include "usb_types.h"
+#include "spsc_ring.h"
 
 #ifdef NKRO_ENABLE
 #    include "keycode_config.h"
@@ -38,6 +39,10 @@
 extern keymap_config_t keymap_config;
 #endif
 
+#ifdef POLL_GOVERNOR_ENABLE
+#    include "poll_governor.h"
+#endif
+
 /* ---------------------------------------------------------
  *       Global interface variables and declarations
  * ---------------------------------------------------------
@@ -95,34 +100,20 @@ static const USBDescriptor *usb_get_descriptor_cb(USBDriver *usbp, uint8_t dtype
  */
 
 #define USB_EVENT_QUEUE_SIZE 16
-usbevent_t event_queue[USB_EVENT_QUEUE_SIZE];
-uint8_t    event_queue_head;
-uint8_t    event_queue_tail;
+SPSC_RING_DECLARE(usb_event_ring, usbevent_t, USB_EVENT_QUEUE_SIZE)
+static usb_event_ring_t usb_events;
 
 void usb_event_queue_init(void) {
     // Initialise the event queue
-    memset(&event_queue, 0, sizeof(event_queue));
-    event_queue_head = 0;
-    event_queue_tail = 0;
+    usb_event_ring_init(&usb_events);
 }
 
 static inline bool usb_event_queue_enqueue(usbevent_t event) {
-    uint8_t next = (event_queue_head + 1) % USB_EVENT_QUEUE_SIZE;
-    if (next == event_queue_tail) {
-        return false;
-    }
-    event_queue[event_queue_head] = event;
-    event_queue_head              = next;
-    return true;
+    return usb_event_ring_push(&usb_events, event);
 }
 
 static inline bool usb_event_queue_dequeue(usbevent_t *event) {
-    if (event_queue_head == event_queue_tail) {
-        return false;
-    }
-    *event           = event_queue[event_queue_tail];
-    event_queue_tail = (event_queue_tail + 1) % USB_EVENT_QUEUE_SIZE;
-    return true;
+    return usb_event_ring_pop(&usb_events, event);
 }
 
 static inline void usb_event_suspend_handler(void) {
@@ -198,6 +189,9 @@ static void usb_event_cb(USBDriver *usbp, usbevent_t event) {
         case USB_EVENT_UNCONFIGURED:
             /* Falls into.*/
         case USB_EVENT_RESET:
+#ifdef POLL_GOVERNOR_ENABLE
+            poll_governor_reset();
+#endif
             usb_event_queue_enqueue(event);
             chSysLockFromISR();
             for (int i = 0; i < USB_ENDPOINT_IN_COUNT; i++) {
@@ -325,10 +319,65 @@ static bool usb_requests_hook_cb(USBDriver *usbp) {
     return false;
 }
 
+/* ---------------------------------------------------------
+ *                     Poll governor
+ * ---------------------------------------------------------
+ */
+
+#ifdef POLL_GOVERNOR_ENABLE
+
+static uint32_t  poll_governor_us;
+static systime_t poll_governor_last_ticks;
+
+/*
+ * Microsecond time base for the poll governor, usable from both thread and ISR
+ * context. Extends the system time, which may only be 16 bits wide, and is
+ * kept up to date by the SOF interrupts while the bus is active.
+ */
+uint32_t poll_governor_timestamp_us(void) {
+    syssts_t  sts   = chSysGetStatusAndLockX();
+    systime_t now   = chVTGetSystemTimeX();
+    uint32_t  ticks = chTimeDiffX(poll_governor_last_ticks, now);
+#    if (1000000 % CH_CFG_ST_FREQUENCY) == 0
+    poll_governor_us += ticks * (1000000 / CH_CFG_ST_FREQUENCY);
+    poll_governor_last_ticks = now;
+#    else
+    /* only consume whole microseconds, so the remainder does not get lost */
+    uint32_t us = (uint32_t)(((uint64_t)ticks * 1000000) / CH_CFG_ST_FREQUENCY);
+    poll_governor_us += us;
+    poll_governor_last_ticks += (systime_t)(((uint64_t)us * CH_CFG_ST_FREQUENCY) / 1000000);
+#    endif
+    uint32_t timestamp = poll_governor_us;
+    chSysRestoreStatusX(sts);
+    return timestamp;
+}
+
+/* Handles the Start-of-Frame interrupt */
+static void usb_sof_cb(USBDriver *usbp) {
+    (void)usbp;
+    poll_governor_sof(poll_governor_timestamp_us());
+}
+
+void usb_poll_governor_in_cb(usb_endpoint_in_t *endpoint) {
+    /* Only the endpoints carrying the keyboard reports are of interest */
+    if (endpoint == &usb_endpoints_in[USB_ENDPOINT_IN_KEYBOARD]
+#    if defined(NKRO_ENABLE)
+        || endpoint == &usb_endpoints_in[USB_ENDPOINT_IN_SHARED]
+#    endif
+    ) {
+        poll_governor_poll(poll_governor_timestamp_us());
+    }
+}
+
+#endif
+
 static const USBConfig usbcfg = {
     usb_event_cb,          /* USB events callback */
     usb_get_descriptor_cb, /* Device GET_DESCRIPTOR request callback */
     usb_requests_hook_cb,  /* Requests hook callback */
+#ifdef POLL_GOVERNOR_ENABLE
+    usb_sof_cb, /* Start-of-Frame callback */
+#endif
 };
 
 void init_usb_driver(USBDriver *usbp) {
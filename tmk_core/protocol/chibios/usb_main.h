@@ -45,6 +45,18 @@ void usb_event_queue_init(void);
 /* Task to dequeue and execute any handlers for the USB events on the main thread */
 void usb_event_queue_task(void);
 
+/* --------------------
+ * Poll governor header
+ * --------------------
+ */
+
+#ifdef POLL_GOVERNOR_ENABLE
+
+/* Called when the host has picked up a report from an IN endpoint */
+void usb_poll_governor_in_cb(usb_endpoint_in_t *endpoint);
+
+#endif /* POLL_GOVERNOR_ENABLE */
+
 /* --------------
  * Console header
  * --------------
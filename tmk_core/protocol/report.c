@@ -23,37 +23,106 @@
 #include "util.h"
 #include <string.h>
 
-/** \brief has_anykey
+#ifdef NKRO_ENABLE
+#    ifdef NKRO_EXTENDED_REPORT
+// the last byte of the bitmap holds the modifiers, which are not scanned as keys
+#        define NKRO_KEY_BYTES (NKRO_REPORT_BITS - 1)
+#    else
+#        define NKRO_KEY_BYTES NKRO_REPORT_BITS
+#    endif
+
+// set when keys were added to/removed from nkro_report, see nkro_report_take_changes
+static bool nkro_keys_changed = false;
+
+static inline uint32_t nkro_load_word(const uint8_t* p) {
+    uint32_t word;
+    memcpy(&word, p, sizeof(word)); // the report is packed, avoid unaligned accesses
+    return word;
+}
+
+/** \brief Checks if any key bit is set in the NKRO report
  *
- * FIXME: Needs doc
+ * Scans the bitmap a word at a time, ignoring the modifiers.
+ */
+bool nkro_bits_any(const report_nkro_t* nkro_report) {
+    uint8_t i = 0;
+    for (; i + sizeof(uint32_t) <= NKRO_KEY_BYTES; i += sizeof(uint32_t)) {
+        if (nkro_load_word(&nkro_report->bits[i])) return true;
+    }
+    for (; i < NKRO_KEY_BYTES; i++) {
+        if (nkro_report->bits[i]) return true;
+    }
+    return false;
+}
+
+/** \brief Counts the keys set in the NKRO report, ignoring the modifiers
+ */
+uint8_t nkro_bits_count(const report_nkro_t* nkro_report) {
+    uint8_t cnt = 0;
+    uint8_t i   = 0;
+    for (; i + sizeof(uint32_t) <= NKRO_KEY_BYTES; i += sizeof(uint32_t)) {
+        uint32_t word = nkro_load_word(&nkro_report->bits[i]);
+        if (word) cnt += __builtin_popcountl(word);
+    }
+    for (; i < NKRO_KEY_BYTES; i++) {
+        cnt += __builtin_popcount(nkro_report->bits[i]);
+    }
+    return cnt;
+}
+
+/** \brief Returns the lowest keycode set in the NKRO report, or KC_NO if there is none
+ */
+uint8_t nkro_bits_first(const report_nkro_t* nkro_report) {
+    uint8_t i = 0;
+    // skip over empty words, then settle on the first non-empty byte
+    for (; i + sizeof(uint32_t) <= NKRO_KEY_BYTES && !nkro_load_word(&nkro_report->bits[i]); i += sizeof(uint32_t))
+        ;
+    for (; i < NKRO_KEY_BYTES; i++) {
+        if (nkro_report->bits[i]) {
+            return i << 3 | __builtin_ctz(nkro_report->bits[i]);
+        }
+    }
+    return KC_NO;
+}
+
+/** \brief Compares the key bits of two NKRO reports, ignoring the modifiers
+ */
+bool nkro_bits_equal(const report_nkro_t* a, const report_nkro_t* b) {
+    return memcmp(a->bits, b->bits, NKRO_KEY_BYTES) == 0;
+}
+
+/** \brief Returns whether keys were added to or removed from nkro_report since the last call
+ *
+ * Only tracks changes made through add_key_to_report/del_key_from_report/clear_keys_from_report.
+ */
+bool nkro_report_take_changes(void) {
+    bool changed      = nkro_keys_changed;
+    nkro_keys_changed = false;
+    return changed;
+}
+#endif
+
+/** \brief Returns the number of keys pressed in the current report, ignoring the modifiers
  */
 uint8_t has_anykey(void) {
-    uint8_t  cnt = 0;
-    uint8_t* p   = keyboard_report->keys;
-    uint8_t  lp  = sizeof(keyboard_report->keys);
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        p  = nkro_report->bits;
-        lp = sizeof(nkro_report->bits);
+        return nkro_bits_count(nkro_report);
     }
 #endif
-    while (lp--) {
-        if (*p++) cnt++;
+    uint8_t cnt = 0;
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keyboard_report->keys[i]) cnt++;
     }
     return cnt;
 }
 
-/** \brief get_first_key
- *
- * FIXME: Needs doc
+/** \brief Returns the first key in the current report, or KC_NO if there is none
  */
 uint8_t get_first_key(void) {
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        uint8_t i = 0;
-        for (; i < NKRO_REPORT_BITS && !nkro_report->bits[i]; i++)
-            ;
-        return i << 3 | biton(nkro_report->bits[i]);
+        return nkro_bits_first(nkro_report);
     }
 #endif
     return keyboard_report->keys[0];
@@ -70,7 +139,7 @@ bool is_key_pressed(uint8_t key) {
     }
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        if ((key >> 3) < NKRO_REPORT_BITS) {
+        if ((key >> 3) < NKRO_KEY_BYTES) {
             return nkro_report->bits[key >> 3] & 1 << (key & 7);
         } else {
             return false;
@@ -122,25 +191,37 @@ void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
 #ifdef NKRO_ENABLE
 /** \brief add key bit
  *
- * FIXME: Needs doc
+ * Returns true if the bit was not set before.
  */
-void add_key_bit(report_nkro_t* nkro_report, uint8_t code) {
+bool add_key_bit(report_nkro_t* nkro_report, uint8_t code) {
     if ((code >> 3) < NKRO_REPORT_BITS) {
-        nkro_report->bits[code >> 3] |= 1 << (code & 7);
+        uint8_t mask = 1 << (code & 7);
+        if (nkro_report->bits[code >> 3] & mask) {
+            return false;
+        }
+        nkro_report->bits[code >> 3] |= mask;
+        return true;
     } else {
         dprintf("add_key_bit: can't add: %02X\n", code);
+        return false;
     }
 }
 
 /** \brief del key bit
  *
- * FIXME: Needs doc
+ * Returns true if the bit was set before.
  */
-void del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
+bool del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
     if ((code >> 3) < NKRO_REPORT_BITS) {
-        nkro_report->bits[code >> 3] &= ~(1 << (code & 7));
+        uint8_t mask = 1 << (code & 7);
+        if (!(nkro_report->bits[code >> 3] & mask)) {
+            return false;
+        }
+        nkro_report->bits[code >> 3] &= ~mask;
+        return true;
     } else {
         dprintf("del_key_bit: can't del: %02X\n", code);
+        return false;
     }
 }
 #endif
@@ -152,7 +233,9 @@ void del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
 void add_key_to_report(uint8_t key) {
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        add_key_bit(nkro_report, key);
+        if (add_key_bit(nkro_report, key)) {
+            nkro_keys_changed = true;
+        }
         return;
     }
 #endif
@@ -166,7 +249,9 @@ void add_key_to_report(uint8_t key) {
 void del_key_from_report(uint8_t key) {
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        del_key_bit(nkro_report, key);
+        if (del_key_bit(nkro_report, key)) {
+            nkro_keys_changed = true;
+        }
         return;
     }
 #endif
@@ -181,7 +266,10 @@ void clear_keys_from_report(void) {
     // not clear mods
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        memset(nkro_report->bits, 0, sizeof(nkro_report->bits));
+        if (nkro_bits_any(nkro_report)) {
+            memset(nkro_report->bits, 0, NKRO_KEY_BYTES);
+            nkro_keys_changed = true;
+        }
         return;
     }
 #endif
@@ -134,7 +134,12 @@ enum desktop_usages {
 
 // clang-format on
 
-#define NKRO_REPORT_BITS 30
+#ifdef NKRO_EXTENDED_REPORT
+// one contiguous bitmap for usages 0x00-0xE7, the last byte doubling as the modifiers
+#    define NKRO_REPORT_BITS 29
+#else
+#    define NKRO_REPORT_BITS 30
+#endif
 
 #ifdef KEYBOARD_SHARED_EP
 #    define KEYBOARD_REPORT_SIZE 9
@@ -161,6 +166,14 @@ extern "C" {
  * -----+--------+--------+--------+--------+--------+--------+--------+--------     +--------
  * desc |mods    |bits[0] |bits[1] |bits[2] |bits[3] |bits[4] |bits[5] |bits[6]  ... |bit[14]
  *
+ * With NKRO_EXTENDED_REPORT, the separate mods byte is dropped in favour of a
+ * single bitmap covering usages 0x00-0xE7; the modifiers then live in its last
+ * byte, with the same bit layout as below.
+ *
+ * byte |0       |1       |2       ... |27      |28
+ * -----+--------+--------+--------     +--------+--------
+ * desc |bits[0] |bits[1] |bits[2] ... |bits[27]|mods
+ *
  * mods retains state of 8 modifiers.
  *
  *  bit |0       |1       |2       |3       |4       |5       |6       |7
@@ -179,8 +192,18 @@ typedef struct {
 
 typedef struct {
     uint8_t report_id;
+#ifdef NKRO_EXTENDED_REPORT
+    union {
+        uint8_t bits[NKRO_REPORT_BITS];
+        struct {
+            uint8_t reserved[NKRO_REPORT_BITS - 1];
+            uint8_t mods;
+        };
+    };
+#else
     uint8_t mods;
     uint8_t bits[NKRO_REPORT_BITS];
+#endif
 } PACKED report_nkro_t;
 
 typedef struct {
@@ -339,8 +362,13 @@ bool    is_key_pressed(uint8_t key);
 void add_key_byte(report_keyboard_t* keyboard_report, uint8_t code);
 void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code);
 #ifdef NKRO_ENABLE
-void add_key_bit(report_nkro_t* nkro_report, uint8_t code);
-void del_key_bit(report_nkro_t* nkro_report, uint8_t code);
+bool    add_key_bit(report_nkro_t* nkro_report, uint8_t code);
+bool    del_key_bit(report_nkro_t* nkro_report, uint8_t code);
+bool    nkro_bits_any(const report_nkro_t* nkro_report);
+uint8_t nkro_bits_count(const report_nkro_t* nkro_report);
+uint8_t nkro_bits_first(const report_nkro_t* nkro_report);
+bool    nkro_bits_equal(const report_nkro_t* a, const report_nkro_t* b);
+bool    nkro_report_take_changes(void);
 #endif
 
 void add_key_to_report(uint8_t key);
@@ -196,11 +196,8 @@ void console_task(void) {
     }
 
     // Send in chunks of 8 padded to 32
-    char    send_buf[CONSOLE_BUFFER_SIZE] = {0};
-    uint8_t send_buf_count                = 0;
-    while (rbuf_has_data() && send_buf_count < CONSOLE_EPSIZE) {
-        send_buf[send_buf_count++] = rbuf_dequeue();
-    }
+    uint8_t send_buf[CONSOLE_BUFFER_SIZE] = {0};
+    rbuf_dequeue_bulk(send_buf, CONSOLE_EPSIZE);
 
     send_report(3, send_buf, CONSOLE_BUFFER_SIZE);
 }
@@ -445,6 +442,7 @@ const PROGMEM uchar shared_hid_report[] = {
     0x09, 0x06,           // Usage (Keyboard)
     0xA1, 0x01,           // Collection (Application)
     0x85, REPORT_ID_NKRO, //   Report ID
+#    ifndef NKRO_EXTENDED_REPORT
     // Modifiers (8 bits)
     0x05, 0x07, //   Usage Page (Keyboard/Keypad)
     0x19, 0xE0, //   Usage Minimum (Keyboard Left Control)
@@ -454,7 +452,8 @@ const PROGMEM uchar shared_hid_report[] = {
     0x95, 0x08, //   Report Count (8)
     0x75, 0x01, //   Report Size (1)
     0x81, 0x02, //   Input (Data, Variable, Absolute)
-    // Keycodes
+#    endif
+    // Keycodes (extended report: 0x00-0xE7, including the modifiers)
     0x05, 0x07,                     //   Usage Page (Keyboard/Keypad)
     0x19, 0x00,                     //   Usage Minimum (0)
     0x29, NKRO_REPORT_BITS * 8 - 1, //   Usage Maximum
@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+"""Compares the results of `make bench:<suite>` against an earlier run.
+
+    util/bench_compare.py baseline.jsonl .build/bench/keyboard.jsonl
+
+Exits with an error when a benchmark got slower by more than the threshold, or started allocating.
+"""
+import argparse
+import json
+import sys
+
+
+def load(path):
+    results = {}
+    with open(path) as f:
+        for line in f:
+            if line.strip():
+                result = json.loads(line)
+                results[(result['suite'], result['benchmark'])] = result
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compares two sets of benchmark results.')
+    parser.add_argument('baseline', help='results to compare against')
+    parser.add_argument('current', help='new results')
+    parser.add_argument('-t', '--threshold', type=float, default=10, help='slowdown in percent that counts as a regression (default: 10)')
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+    regressions = 0
+
+    for key, result in sorted(current.items()):
+        name = f'{key[0]}/{key[1]}'
+        if key not in baseline:
+            print(f'{name}: {result["ns_per_event"]} ns/event (new)')
+            continue
+
+        before = baseline[key]
+        change = (result['ns_per_event'] / before['ns_per_event'] - 1) * 100 if before['ns_per_event'] else 0
+        regressed = change > args.threshold or result['allocations'] > before['allocations']
+        regressions += regressed
+
+        print(f'{name}: {before["ns_per_event"]} -> {result["ns_per_event"]} ns/event ({change:+.1f}%), {before["allocations"]} -> {result["allocations"]} allocations{" REGRESSION" if regressed else ""}')
+
+    return 1 if regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())